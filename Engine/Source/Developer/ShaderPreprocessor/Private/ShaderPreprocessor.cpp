@@ -6,6 +6,13 @@
 
 IMPLEMENT_MODULE(FDefaultModuleImpl, ShaderPreprocessor);
 
+static TAutoConsoleVariable<int32> CVarPreprocessedShaderCacheSize(
+	TEXT("r.Shaders.PreprocessCacheSizeMB"),
+	64,
+	TEXT("Size in megabytes of the in-memory cache of preprocessed shader source, kept by each shader compiling process.\n")
+	TEXT("Identical permutation inputs (same source, includes and defines) skip running the preprocessor.\n")
+	TEXT("0 disables the cache."));
+
 /**
  * Append defines to an MCPP command line.
  * @param OutOptions - Upon return contains MCPP command line parameters as a string appended to the current string.
@@ -51,6 +58,26 @@ public:
 		return InputShaderFile;
 	}
 
+	/**
+	 * Hashes the current contents of the given file, as MCPP would see them.
+	 * @returns false if the file could not be loaded.
+	 */
+	bool GetFileContentsHash(const FString& Filename, FSHAHash& OutHash)
+	{
+		const FShaderContents* Contents = FindOrLoadFileContents(Filename);
+		if (Contents)
+		{
+			FSHA1::HashBuffer(Contents->GetData(), Contents->Num() * sizeof(ANSICHAR), OutHash.Hash);
+		}
+		return Contents != NULL;
+	}
+
+	/** Returns the names of all files that have been loaded so far, which after preprocessing are the input file and everything it included. */
+	void GetLoadedFilenames(TArray<FString>& OutFilenames) const
+	{
+		CachedFileContents.GenerateKeyArray(OutFilenames);
+	}
+
 	/** Retrieves the MCPP file loader interface. */
 	file_loader GetMcppInterface()
 	{
@@ -70,13 +97,30 @@ private:
 		FMcppFileLoader* This = (FMcppFileLoader*)InUserData;
 		FString Filename = GetRelativeShaderFilename(ANSI_TO_TCHAR(InFilename));
 
-		FShaderContents* CachedContents = This->CachedFileContents.Find(Filename);
+		const FShaderContents* CachedContents = This->FindOrLoadFileContents(Filename);
+
+		if (OutContents)
+		{
+			*OutContents = CachedContents ? CachedContents->GetData() : NULL;
+		}
+		if (OutContentSize)
+		{
+			*OutContentSize = CachedContents ? CachedContents->Num() : 0;
+		}
+
+		return !!CachedContents;
+	}
+
+	/** Returns the contents of the given file, loading them if this is the first time the file is requested. */
+	const FShaderContents* FindOrLoadFileContents(const FString& Filename)
+	{
+		FShaderContents* CachedContents = CachedFileContents.Find(Filename);
 		if (!CachedContents)
 		{
 			FString FileContents;
-			if (This->ShaderInput.Environment.IncludeFileNameToContentsMap.Contains(Filename))
+			if (ShaderInput.Environment.IncludeFileNameToContentsMap.Contains(Filename))
 			{
-				FileContents = This->ShaderInput.Environment.IncludeFileNameToContentsMap.FindRef(Filename);
+				FileContents = ShaderInput.Environment.IncludeFileNameToContentsMap.FindRef(Filename);
 			}
 			else
 			{
@@ -85,20 +129,10 @@ private:
 
 			if (FileContents.Len() > 0)
 			{
-				CachedContents = &This->CachedFileContents.Add(Filename,StringToArray<ANSICHAR>(*FileContents, FileContents.Len()));
+				CachedContents = &CachedFileContents.Add(Filename,StringToArray<ANSICHAR>(*FileContents, FileContents.Len()));
 			}
 		}
-
-		if (OutContents)
-		{
-			*OutContents = CachedContents ? CachedContents->GetData() : NULL;
-		}
-		if (OutContentSize)
-		{
-			*OutContentSize = CachedContents ? CachedContents->Num() : 0;
-		}
-
-		return !!CachedContents;
+		return CachedContents;
 	}
 
 	/** Shader input data. */
@@ -109,6 +143,170 @@ private:
 	FString InputShaderFile;
 };
 
+/**
+ * Cache of preprocessed shader source, so that compiling the same permutation input again doesn't run MCPP.
+ * Entries are looked up by a hash of everything that is known before preprocessing (source file, prefix, defines and
+ * generated includes), and are only used if every file that was read while preprocessing still has the same contents.
+ * Must only be accessed with the MCPP lock held.
+ */
+class FPreprocessedShaderCache
+{
+public:
+	FPreprocessedShaderCache()
+		: CachedSize(0)
+	{
+	}
+
+	/** Builds the lookup key for the given input. */
+	static FSHAHash GetKey(const FShaderCompilerInput& ShaderInput, const FShaderCompilerDefinitions& AdditionalDefines)
+	{
+		FSHA1 HashState;
+		HashState.UpdateWithString(*ShaderInput.SourceFilename, ShaderInput.SourceFilename.Len());
+		HashState.UpdateWithString(*ShaderInput.SourceFilePrefix, ShaderInput.SourceFilePrefix.Len());
+		HashDefinitions(HashState, ShaderInput.Environment.GetDefinitions());
+		HashDefinitions(HashState, AdditionalDefines.GetDefinitionMap());
+
+		TArray<FString> GeneratedFilenames;
+		ShaderInput.Environment.IncludeFileNameToContentsMap.GenerateKeyArray(GeneratedFilenames);
+		GeneratedFilenames.Sort();
+		for (int32 FileIndex = 0; FileIndex < GeneratedFilenames.Num(); FileIndex++)
+		{
+			const FString& Contents = ShaderInput.Environment.IncludeFileNameToContentsMap.FindChecked(GeneratedFilenames[FileIndex]);
+			HashState.UpdateWithString(*GeneratedFilenames[FileIndex], GeneratedFilenames[FileIndex].Len());
+			HashState.UpdateWithString(*Contents, Contents.Len());
+		}
+
+		HashState.Final();
+		FSHAHash Key;
+		HashState.GetHash(Key.Hash);
+		return Key;
+	}
+
+	/** 
+	 * Looks for a cached result whose dependencies match their current contents. 
+	 * @param OutWarnings - Upon return contains the warnings reported when the source was preprocessed.
+	 * @returns the cached source and the time it originally took to preprocess, or NULL if nothing valid was found.
+	 */
+	const FString* Find(const FSHAHash& Key, FMcppFileLoader& FileLoader, double& OutPreprocessTime, const TArray<FShaderCompilerError>*& OutWarnings)
+	{
+		FEntry* Entry = Entries.Find(Key);
+		if (Entry)
+		{
+			for (int32 DependencyIndex = 0; DependencyIndex < Entry->Dependencies.Num(); DependencyIndex++)
+			{
+				const FDependency& Dependency = Entry->Dependencies[DependencyIndex];
+				FSHAHash CurrentHash;
+				if (!FileLoader.GetFileContentsHash(Dependency.Filename, CurrentHash) || CurrentHash != Dependency.Hash)
+				{
+					// A file changed since this entry was created, it will be replaced once the shader has been preprocessed again
+					return NULL;
+				}
+			}
+
+			OutPreprocessTime = Entry->PreprocessTime;
+			OutWarnings = &Entry->Warnings;
+			return &Entry->PreprocessedShader;
+		}
+		return NULL;
+	}
+
+	/** Adds the result of preprocessing and its warnings, using the files that were read by FileLoader as dependencies. */
+	void Add(const FSHAHash& Key, FMcppFileLoader& FileLoader, const FString& PreprocessedShader, const TArray<FShaderCompilerError>& Warnings, double PreprocessTime)
+	{
+		const int64 MaxSize = (int64)CVarPreprocessedShaderCacheSize.GetValueOnAnyThread() * 1024 * 1024;
+
+		FEntry NewEntry;
+		NewEntry.PreprocessedShader = PreprocessedShader;
+		NewEntry.Warnings = Warnings;
+		NewEntry.PreprocessTime = PreprocessTime;
+
+		TArray<FString> Filenames;
+		FileLoader.GetLoadedFilenames(Filenames);
+		for (int32 FileIndex = 0; FileIndex < Filenames.Num(); FileIndex++)
+		{
+			FDependency& Dependency = *new(NewEntry.Dependencies) FDependency;
+			Dependency.Filename = Filenames[FileIndex];
+			verify(FileLoader.GetFileContentsHash(Dependency.Filename, Dependency.Hash));
+		}
+
+		Remove(Key);
+
+		// Evict the oldest entries to make room
+		const int64 EntrySize = NewEntry.GetSize();
+		int32 NumToEvict = 0;
+		while (NumToEvict < InsertionOrder.Num() && CachedSize + EntrySize > MaxSize)
+		{
+			const FSHAHash& OldestKey = InsertionOrder[NumToEvict++];
+			CachedSize -= Entries.FindChecked(OldestKey).GetSize();
+			Entries.Remove(OldestKey);
+		}
+		InsertionOrder.RemoveAt(0, NumToEvict);
+
+		if (EntrySize <= MaxSize)
+		{
+			CachedSize += EntrySize;
+			Entries.Add(Key, NewEntry);
+			InsertionOrder.Add(Key);
+		}
+	}
+
+	/** Removes any existing entry for the key. */
+	void Remove(const FSHAHash& Key)
+	{
+		FEntry* Entry = Entries.Find(Key);
+		if (Entry)
+		{
+			CachedSize -= Entry->GetSize();
+			Entries.Remove(Key);
+			InsertionOrder.Remove(Key);
+		}
+	}
+
+private:
+	struct FDependency
+	{
+		FString Filename;
+		FSHAHash Hash;
+	};
+
+	struct FEntry
+	{
+		FString PreprocessedShader;
+		/** Warnings MCPP reported for a successful run, they are reported again on every hit. */
+		TArray<FShaderCompilerError> Warnings;
+		TArray<FDependency> Dependencies;
+		double PreprocessTime;
+
+		int64 GetSize() const
+		{
+			return PreprocessedShader.GetAllocatedSize() + Warnings.GetAllocatedSize() + Dependencies.GetAllocatedSize();
+		}
+	};
+
+	static void HashDefinitions(FSHA1& HashState, const TMap<FString,FString>& Definitions)
+	{
+		// Hash in a stable order, the map order depends on how the definitions were added
+		TArray<FString> Names;
+		Definitions.GenerateKeyArray(Names);
+		Names.Sort();
+		for (int32 NameIndex = 0; NameIndex < Names.Num(); NameIndex++)
+		{
+			const FString& Value = Definitions.FindChecked(Names[NameIndex]);
+			HashState.UpdateWithString(*Names[NameIndex], Names[NameIndex].Len() + 1);
+			HashState.UpdateWithString(*Value, Value.Len() + 1);
+		}
+		// Separate the two sets of definitions
+		const uint8 Terminator = 0;
+		HashState.Update(&Terminator, 1);
+	}
+
+	TMap<FSHAHash, FEntry> Entries;
+	/** Keys in the order they were added, oldest first. */
+	TArray<FSHAHash> InsertionOrder;
+	/** Approximate memory used by Entries. */
+	int64 CachedSize;
+};
+
 /**
  * Preprocess a shader.
  * @param OutPreprocessedShader - Upon return contains the preprocessed source code.
@@ -136,6 +334,29 @@ bool PreprocessShader(
 
 	FMcppFileLoader FileLoader(ShaderInput);
 
+	static FPreprocessedShaderCache PreprocessedShaderCache;
+	const bool bUseCache = CVarPreprocessedShaderCacheSize.GetValueOnAnyThread() > 0;
+	FSHAHash CacheKey;
+
+	if (bUseCache)
+	{
+		CacheKey = FPreprocessedShaderCache::GetKey(ShaderInput, AdditionalDefines);
+
+		double SavedTime = 0;
+		const TArray<FShaderCompilerError>* CachedWarnings = NULL;
+		const FString* CachedShader = PreprocessedShaderCache.Find(CacheKey, FileLoader, SavedTime, CachedWarnings);
+		if (CachedShader)
+		{
+			OutPreprocessedShader = *CachedShader;
+			ShaderOutput.Errors.Append(*CachedWarnings);
+			ShaderOutput.bPreprocessCacheHit = true;
+			ShaderOutput.PreprocessTime = (float)SavedTime;
+			return true;
+		}
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+
 	AddMcppDefines(McppOptions, ShaderInput.Environment.GetDefinitions());
 	AddMcppDefines(McppOptions, AdditionalDefines.GetDefinitionMap());
 
@@ -150,6 +371,7 @@ bool PreprocessShader(
 	McppOutput = McppOutAnsi;
 	McppErrors = McppErrAnsi;
 
+	const int32 FirstNewError = ShaderOutput.Errors.Num();
 	if (ParseMcppErrors(ShaderOutput.Errors, McppErrors, true))
 	{
 		// exchange strings
@@ -157,5 +379,17 @@ bool PreprocessShader(
 		bSuccess = true;
 	}
 
+	const double PreprocessTime = FPlatformTime::Seconds() - StartTime;
+	ShaderOutput.bPreprocessCacheHit = false;
+	ShaderOutput.PreprocessTime = (float)PreprocessTime;
+
+	// Only successful results are cached, so errors are always reported
+	if (bUseCache && bSuccess)
+	{
+		TArray<FShaderCompilerError> Warnings;
+		Warnings.Append(ShaderOutput.Errors.GetData() + FirstNewError, ShaderOutput.Errors.Num() - FirstNewError);
+		PreprocessedShaderCache.Add(CacheKey, FileLoader, OutPreprocessedShader, Warnings, PreprocessTime);
+	}
+
 	return bSuccess;
 }
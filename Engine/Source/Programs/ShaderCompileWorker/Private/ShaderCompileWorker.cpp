@@ -14,7 +14,7 @@
 #define DEBUG_USING_CONSOLE	0
 
 const int32 ShaderCompileWorkerInputVersion = 2;
-const int32 ShaderCompileWorkerOutputVersion = 1;
+const int32 ShaderCompileWorkerOutputVersion = 2;
 
 double LastCompileTime = 0.0;
 
@@ -128,9 +128,10 @@ public:
 
 		while(true)
 		{
+			TArray<FShaderCompilerInput> JobInputs;
 			TArray<FJobResult> JobResults;
 
-			// Read & Process Input
+			// Read Input
 			{
 				FArchive* InputFilePtr = OpenInputFile();
 				if(!InputFilePtr)
@@ -141,15 +142,24 @@ public:
 				UE_LOG(LogShaders, Log, TEXT("Processing shader"));
 				LastCompileTime = FPlatformTime::Seconds();
 
-				ProcessInputFromArchive(InputFilePtr, JobResults);
+				ReadInputFromArchive(InputFilePtr, JobInputs);
 
 				// Close the input file.
 				delete InputFilePtr;
 			}
 
+			// Let the manager know the batch has been picked up, so it can queue up the next one while we compile this one
+			AcknowledgeInput();
+
+			// Process Input
+			ProcessInputs(JobInputs, JobResults);
+
 			// Prepare for output
 			FArchive* OutputFilePtr = CreateOutputArchive();
-			check(OutputFilePtr);
+			if (!OutputFilePtr)
+			{
+				break;
+			}
 			WriteToOutputArchive(OutputFilePtr, JobResults);
 
 			// Close the output file.
@@ -266,7 +276,7 @@ private:
 		return InputFile;
 	}
 
-	void ProcessInputFromArchive(FArchive* InputFilePtr, TArray<FJobResult>& OutJobResults)
+	void ReadInputFromArchive(FArchive* InputFilePtr, TArray<FShaderCompilerInput>& OutJobInputs)
 	{
 		int32 NumBatches = 0;
 
@@ -277,15 +287,24 @@ private:
 
 		InputFile << NumBatches;
 
+		// Deserialize all of the job inputs up front, so that the input file can be released before compiling
+		OutJobInputs.Empty(NumBatches);
+		for (int32 BatchIndex = 0; BatchIndex < NumBatches; BatchIndex++)
+		{
+			FShaderCompilerInput& CompilerInput = *new(OutJobInputs) FShaderCompilerInput;
+			InputFile << CompilerInput;
+		}
+	}
+
+	void ProcessInputs(TArray<FShaderCompilerInput>& JobInputs, TArray<FJobResult>& OutJobResults)
+	{
 		// Flush cache, to make sure we load the latest version of the input file.
 		// (Otherwise quick changes to a shader file can result in the wrong output.)
 		FlushShaderFileCache();
 
-		for (int32 BatchIndex = 0; BatchIndex < NumBatches; BatchIndex++)
+		for (int32 BatchIndex = 0; BatchIndex < JobInputs.Num(); BatchIndex++)
 		{
-			// Deserialize the job's inputs.
-			FShaderCompilerInput CompilerInput;
-			InputFile << CompilerInput;
+			FShaderCompilerInput& CompilerInput = JobInputs[BatchIndex];
 
 			if (IsValidRef(CompilerInput.SharedEnvironment))
 			{
@@ -303,9 +322,9 @@ private:
 		}
 	}
 
-	FArchive* CreateOutputArchive()
+	/** Removes the input file once it has been read, which tells the manager that it can write out the next batch. */
+	void AcknowledgeInput()
 	{
-		FArchive* OutputFilePtr = nullptr;
 		if (CommunicationMode == ThroughFile)
 		{
 			const double StartTime = FPlatformTime::Seconds();
@@ -322,6 +341,39 @@ private:
 			{
 				UE_LOG(LogShaders, Fatal,TEXT("Couldn't delete input file %s, is it readonly?"), *InputFilePath);
 			}
+		}
+	}
+
+	/** 
+	 * Waits for the manager to consume the output of the previous batch, since it may have queued up the next batch before reading it.
+	 * Returns false if the parent process went away while waiting.
+	 */
+	bool WaitForOutputConsumed()
+	{
+		while (IFileManager::Get().FileSize(*OutputFilePath) != INDEX_NONE)
+		{
+			if (ParentProcessId > 0 && !FPlatformProcess::IsApplicationRunning(ParentProcessId))
+			{
+				UE_LOG(LogShaders, Log, TEXT("Parent process no longer running while waiting to write output, exiting"));
+				FPlatformMisc::RequestExit(false);
+				return false;
+			}
+
+			// Give up CPU time while we are waiting
+			FPlatformProcess::Sleep(0.01f);
+		}
+		return true;
+	}
+
+	FArchive* CreateOutputArchive()
+	{
+		FArchive* OutputFilePtr = nullptr;
+		if (CommunicationMode == ThroughFile)
+		{
+			if (!WaitForOutputConsumed())
+			{
+				return nullptr;
+			}
 
 #if PLATFORM_MAC || PLATFORM_LINUX
 			// To make sure that the process waiting for results won't read unfinished output file,
@@ -41,6 +41,9 @@ class AIMODULE_API UBTAuxiliaryNode : public UBTNode
 	/** wrapper for node instancing: TickNode */
 	void WrappedTickNode(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float DeltaSeconds) const;
 
+	/** @return time left until node needs to be ticked: 0 if it ticks every frame, FLT_MAX if it doesn't tick at all */
+	float GetNextNeededDeltaTime(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory) const;
+
 	virtual void DescribeRuntimeValues(const UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, EBTDescriptionVerbosity::Type Verbosity, TArray<FString>& Values) const override;
 	virtual uint16 GetSpecialMemorySize() const override;
 
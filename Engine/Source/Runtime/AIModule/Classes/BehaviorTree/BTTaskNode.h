@@ -54,6 +54,9 @@ class AIMODULE_API UBTTaskNode : public UBTNode
 	/** wrapper for node instancing: TickTask */
 	void WrappedTickTask(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory, float DeltaSeconds) const;
 
+	/** @return time left until task needs to be ticked: 0 if it ticks every frame, FLT_MAX if it doesn't tick at all */
+	float GetNextNeededDeltaTime(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory) const;
+
 	/** helper function: finish latent executing */
 	void FinishLatentTask(UBehaviorTreeComponent& OwnerComp, EBTNodeResult::Type TaskResult) const;
 
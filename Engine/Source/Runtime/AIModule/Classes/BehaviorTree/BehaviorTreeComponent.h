@@ -127,6 +127,12 @@ public:
 	virtual void TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction *ThisTickFunction) override;
 	/** END UActorComponent overrides */
 
+	virtual void HandleMessage(const FAIMessage& Message) override;
+
+	/** wakes up tree, making sure it will be ticked within NextNeededDeltaTime
+	 *	use it when node's tick requirements change outside of tree's tick and execution flow */
+	void ScheduleNextTick(float NextNeededDeltaTime = 0.0f);
+
 	/** process execution flow */
 	void ProcessExecutionRequest();
 
@@ -214,6 +220,12 @@ protected:
 	/** index of last active instance on stack */
 	uint16 ActiveInstanceIdx;
 
+	/** time left until any of active nodes needs to be ticked, FLT_MAX if none of them ticks */
+	float NextTickDeltaTime;
+
+	/** time passed since last tick of nodes, passed to them when tree wakes up */
+	float AccumulatedTickDeltaTime;
+
 	/** loops tree execution */
 	uint8 bLoopExecution : 1;
 
@@ -229,6 +241,9 @@ protected:
 	/** if set, execution requests will be postponed */
 	uint8 bIsPaused : 1;
 
+	/** set when component's tick was disabled because none of active nodes needs it */
+	uint8 bTickSuspended : 1;
+
 	/** push behavior tree instance on execution stack
 	 *	@NOTE: should never be called out-side of BT execution, meaning only BT tasks can push another BT instance! */
 	bool PushInstance(UBehaviorTree& TreeAsset);
@@ -272,6 +287,10 @@ protected:
 	/** update state of aborting tasks */
 	void UpdateAbortingTasks();
 
+	/** tick active auxiliary nodes, parallel tasks and active task
+	 *	@return time until any of them needs to be ticked again, FLT_MAX if none of them ticks */
+	float TickActiveNodes(float DeltaTime);
+
 	/** apply pending execution from last task search */
 	void ProcessPendingExecution();
 
@@ -55,6 +55,10 @@ class AIMODULE_API UEnvQueryTest : public UObject
 	/** Cost of test */
 	TEnumAsByte<EEnvTestCost::Type> Cost;
 
+	/** Set by tests that only read item data and prepared contexts in RunTest, 
+	 *  allowing item ranges to be scored on worker threads at the same time */
+	uint32 bCanRunInParallel : 1;
+
 	/** How should the lower bound for normalization of the raw test value before applying the scoring formula be determined?
 	    Should it use the lowest value found (tested), the lower threshold for filtering, or a separate specified normalization minimum? */
 	UPROPERTY(EditDefaultsOnly, Category=Score)
@@ -161,6 +165,9 @@ public:
 	/** normalize scores in range */
 	void NormalizeItemScores(FEnvQueryInstance& QueryInstance);
 
+	/** check if test can score items on worker threads, dynamic data bindings may need game thread */
+	bool CanRunInParallel() const;
+
 	FORCEINLINE bool IsScoring() const { return (TestPurpose != EEnvTestPurpose::Filter); } 
 	FORCEINLINE bool IsFiltering() const { return (TestPurpose != EEnvTestPurpose::Score); }
 
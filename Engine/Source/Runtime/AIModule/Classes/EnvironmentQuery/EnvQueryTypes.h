@@ -677,6 +677,12 @@ protected:
 	/** pick one of items with highest score */
 	void PickBestItem();
 
+	/** runs thread safe test on remaining items, splitting them between game thread and task graph workers */
+	void RunTestInParallel(const UEnvQueryTest* TestObject);
+
+	/** runs test on items in [StartItem, EndItem) range, may be called from worker threads */
+	void RunTestOnItemRange(const UEnvQueryTest* TestObject, int32 StartItem, int32 EndItem);
+
 	/** discard all items but one */
 	void PickSingleItem(int32 ItemIndex);
 
@@ -730,7 +736,15 @@ public:
 
 		~ItemIterator()
 		{
-			Instance->CurrentTestStartingItem = CurrentItem;
+			if (bInParallelRange)
+			{
+				// other ranges are being processed at the same time, they own the resume point
+				FPlatformAtomics::InterlockedAdd(&Instance->NumValidItems, -NumDiscardedItems);
+			}
+			else
+			{
+				Instance->CurrentTestStartingItem = CurrentItem;
+			}
 		}
 
 		void SetScore(EEnvTestPurpose::Type TestPurpose, EEnvTestFilterType::Type FilterType, float Score, float Min, float Max)
@@ -862,7 +876,7 @@ public:
 
 		operator bool() const
 		{
-			return CurrentItem < Instance->Items.Num() && !Instance->bFoundSingleResult && (Deadline < 0 || FPlatformTime::Seconds() < Deadline);
+			return CurrentItem < Instance->Items.Num() && CurrentItem < EndItem && !Instance->bFoundSingleResult && (Deadline < 0 || FPlatformTime::Seconds() < Deadline);
 		}
 
 		int32 operator*() const
@@ -884,11 +898,16 @@ public:
 
 		FEnvQueryInstance* Instance;
 		int32 CurrentItem;
+		/** first item past the range processed by this iterator */
+		int32 EndItem;
 		int32 NumPartialScores;
+		/** items discarded by iterator running in parallel, removed from NumValidItems when it's done */
+		int32 NumDiscardedItems;
 		double Deadline;
 		float ItemScore;
 		uint32 bPassed : 1;
 		uint32 bSkipped : 1;
+		uint32 bInParallelRange : 1;
 
 		void InitItemScore()
 		{
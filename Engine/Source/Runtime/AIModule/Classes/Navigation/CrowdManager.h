@@ -280,6 +280,9 @@ protected:
 	/** debug data */
 	dtCrowdAgentDebugInfo* DetourAgentDebug;
 	dtObstacleAvoidanceDebugData* DetourAvoidanceDebug;
+
+	/** velocity samples taken by each task of parallel avoidance step */
+	TArray<int32> TaskVelocitySampleCounts;
 #endif
 
 #if WITH_EDITOR
@@ -312,6 +315,20 @@ protected:
 	/** switch debugger to object selected in PIE */
 	void UpdateSelectedDebug(const ICrowdAgentInterface* Agent, int32 AgentIndex) const;
 
+	typedef void (UCrowdManager::*FAgentRangeStep)(int32 TaskIdx, int32 StartIdx, int32 EndIdx);
+
+	/** number of tasks simulating NumActiveAgents, 1 if whole simulation should run on game thread */
+	int32 GetNumParallelTasks(int32 NumActiveAgents) const;
+
+	/** splits active agents between task graph workers and game thread, waits until step is done */
+	void RunParallelStep(FAgentRangeStep Step, int32 NumActiveAgents, int32 NumTasks);
+
+	/** gather neighbours of active agents from given range, runs on worker threads */
+	void UpdateNeighboursRange(int32 TaskIdx, int32 StartIdx, int32 EndIdx);
+
+	/** sample avoidance velocity of active agents from given range, runs on worker threads */
+	void UpdateAvoidanceRange(int32 TaskIdx, int32 StartIdx, int32 EndIdx);
+
 	void CreateCrowdManager();
 	void DestroyCrowdManager();
 
@@ -53,6 +53,8 @@ struct FAISightTarget
 	IAISightTargetInterface* SightTargetInterface;
 	FGenericTeamId TeamId;
 	FTargetId TargetId;
+	/** cell of UAISense_Sight::TargetGrid target is currently stored in */
+	FIntPoint GridCell;
 
 	FAISightTarget(AActor* InTarget = NULL, FGenericTeamId InTeamId = FGenericTeamId::NoTeam);
 
@@ -122,10 +124,21 @@ public:
 
 	TArray<FAISightQuery> SightQueryQueue;
 
+	/** Queries of targets too far from their listeners to be seen, grouped by listener.
+	 *	They are not processed until TargetGrid reports their target near the listener */
+	TMap<FPerceptionListenerID, TMap<FAISightTarget::FTargetId, FAISightQuery> > SightQueriesOutOfRange;
+
+	/** Observed targets bucketed by their 2D location */
+	TMap<FIntPoint, TArray<FAISightTarget::FTargetId> > TargetGrid;
+
 protected:
 	UPROPERTY(config)
 	int32 MaxTracesPerTick;
 
+	/** Size of TargetGrid cells */
+	UPROPERTY(config)
+	float TargetGridCellSize;
+
 	UPROPERTY(config)
 	float HighImportanceQueryDistanceThreshold;
 
@@ -167,6 +180,16 @@ protected:
 
 	FORCEINLINE void SortQueries() { SightQueryQueue.Sort(FAISightQuery::FSortPredicate()); }
 
+	/** adds query to SightQueryQueue, or to SightQueriesOutOfRange if target is too far from listener */
+	void AddQuery(const FPerceptionListener& Listener, const FDigestedSightProperties& PropDigest, const FAISightQuery& SightQuery, const FVector& TargetLocation);
+
+	/** moves targets between TargetGrid cells, collects targets that are no longer valid */
+	void UpdateTargetGrid(TArray<FAISightTarget::FTargetId>& OutInvalidTargets);
+	void RemoveTargetFromGrid(const FAISightTarget& Target);
+
+	/** moves queries of targets that got close to their listeners back to SightQueryQueue, returns number of pairs checked */
+	int32 RestoreQueriesInRange();
+
 	float CalcQueryImportance(const FPerceptionListener& Listener, const FVector& TargetLocation, const float SightRadiusSq) const;
 
 public:
@@ -152,6 +152,7 @@ UPawnActionsComponent::UPawnActionsComponent(const FObjectInitializer& ObjectIni
 {
 	PrimaryComponentTick.bCanEverTick = true;
 	PrimaryComponentTick.bStartWithTickEnabled = true;
+	PrimaryComponentTick.bAllowTickBatching = true;
 
 	bAutoActivate = true;
 	bLockedAILogic = false;
@@ -43,6 +43,14 @@ void UBTTaskNode::WrappedTickTask(UBehaviorTreeComponent& OwnerComp, uint8* Node
 	}
 }
 
+float UBTTaskNode::GetNextNeededDeltaTime(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory) const
+{
+	// tasks don't have tick intervals, they are ticked every frame while active
+	// instanced tasks can change bNotifyTick at runtime, so ask the instance
+	const UBTNode* NodeOb = HasInstance() ? GetNodeInstance(OwnerComp, NodeMemory) : this;
+	return (NodeOb && ((const UBTTaskNode*)NodeOb)->bNotifyTick) ? 0.0f : FLT_MAX;
+}
+
 void UBTTaskNode::ReceivedMessage(UBrainComponent* BrainComp, const FAIMessage& Message)
 {
 	UBehaviorTreeComponent* OwnerComp = (UBehaviorTreeComponent*)BrainComp;
@@ -9,6 +9,17 @@
 #include "BehaviorTree/BlackboardComponent.h"
 #include "BehaviorTree/BehaviorTreeComponent.h"
 
+DECLARE_DWORD_COUNTER_STAT(TEXT("Num Trees Ticked"), STAT_AI_BehaviorTree_NumTicked, STATGROUP_AIBehaviorTree);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Num Trees Sleeping"), STAT_AI_BehaviorTree_NumSleeping, STATGROUP_AIBehaviorTree);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Num Trees Suspended"), STAT_AI_BehaviorTree_NumSuspended, STATGROUP_AIBehaviorTree);
+
+static TAutoConsoleVariable<int32> CVarScheduledTicking(
+	TEXT("ai.bt.ScheduledTicking"),
+	1,
+	TEXT("If 1, behavior trees tick their nodes only when any of them needs it, or after execution flow changes.\n")
+	TEXT("If 0, active behavior trees tick their nodes every frame."),
+	ECVF_Default);
+
 //----------------------------------------------------------------------//
 // UBehaviorTreeComponent
 //----------------------------------------------------------------------//
@@ -25,6 +36,9 @@ UBehaviorTreeComponent::UBehaviorTreeComponent(const FObjectInitializer& ObjectI
 	bWantsInitializeComponent = true; 
 	bIsRunning = false;
 	bIsPaused = false;
+	bTickSuspended = false;
+	NextTickDeltaTime = 0.0f;
+	AccumulatedTickDeltaTime = 0.0f;
 }
 
 void UBehaviorTreeComponent::BeginDestroy()
@@ -35,6 +49,12 @@ void UBehaviorTreeComponent::BeginDestroy()
 		BTManager->RemoveActiveComponent(*this);
 	}
 
+	if (bTickSuspended)
+	{
+		DEC_DWORD_STAT(STAT_AI_BehaviorTree_NumSuspended);
+		bTickSuspended = false;
+	}
+
 	RemoveAllInstances();
 	Super::BeginDestroy();
 }
@@ -501,6 +521,27 @@ static void FindCommonParent(const TArray<FBehaviorTreeInstance>& Instances, con
 void UBehaviorTreeComponent::ScheduleExecutionUpdate()
 {
 	bRequestedFlowUpdate = true;
+	ScheduleNextTick();
+}
+
+void UBehaviorTreeComponent::ScheduleNextTick(float NextNeededDeltaTime)
+{
+	NextTickDeltaTime = FMath::Min(NextTickDeltaTime, NextNeededDeltaTime);
+
+	if (bTickSuspended)
+	{
+		bTickSuspended = false;
+		SetComponentTickEnabled(true);
+		DEC_DWORD_STAT(STAT_AI_BehaviorTree_NumSuspended);
+	}
+}
+
+void UBehaviorTreeComponent::HandleMessage(const FAIMessage& Message)
+{
+	Super::HandleMessage(Message);
+
+	// messages are dispatched to observers in tick
+	ScheduleNextTick();
 }
 
 void UBehaviorTreeComponent::RequestExecution(UBTCompositeNode* RequestedOn, int32 InstanceIdx, const UBTNode* RequestedBy,
@@ -740,6 +781,7 @@ void UBehaviorTreeComponent::ApplySearchUpdates(const TArray<FBehaviorTreeSearch
 			{
 				UpdateInstance.ActiveAuxNodes.Add(UpdateInfo.AuxNode);
 				UpdateInfo.AuxNode->WrappedOnBecomeRelevant(*this, NodeMemory);
+				ScheduleNextTick();
 			}
 		}
 		else if (UpdateInfo.TaskNode)
@@ -771,6 +813,7 @@ void UBehaviorTreeComponent::ApplySearchUpdates(const TArray<FBehaviorTreeSearch
 					*UBehaviorTreeTypes::DescribeNodeHelper(UpdateInfo.TaskNode));
 
 				UpdateInstance.ParallelTasks.Add(FBehaviorTreeParallelTask(UpdateInfo.TaskNode, EBTTaskStatus::Active));
+				ScheduleNextTick();
 			}
 		}
 	}
@@ -812,8 +855,25 @@ void UBehaviorTreeComponent::TickComponent(float DeltaTime, enum ELevelTick Tick
 
 	check(this && this->IsPendingKill() == false);
 		
+	const bool bScheduledTicking = CVarScheduledTicking.GetValueOnGameThread() != 0;
+	if (bScheduledTicking)
+	{
+		// sleep until any of active nodes needs to tick, they will receive whole time that passed since then
+		AccumulatedTickDeltaTime += DeltaTime;
+		NextTickDeltaTime -= DeltaTime;
+	}
+
 	if (bRequestedFlowUpdate)
 	{
+		// nodes active while tree was sleeping are owed that time, give it to them before execution flow replaces them
+		// nodes activated by this request will receive only time of current frame
+		const float SleepingDeltaTime = AccumulatedTickDeltaTime - DeltaTime;
+		if (bScheduledTicking && SleepingDeltaTime > 0.0f && InstanceStack.Num() && bIsRunning)
+		{
+			TickActiveNodes(SleepingDeltaTime);
+			AccumulatedTickDeltaTime = DeltaTime;
+		}
+
 		ProcessExecutionRequest();
 	}
 	
@@ -822,6 +882,39 @@ void UBehaviorTreeComponent::TickComponent(float DeltaTime, enum ELevelTick Tick
 		return;
 	}
 
+	if (bScheduledTicking)
+	{
+		if (NextTickDeltaTime > 0.0f)
+		{
+			INC_DWORD_STAT(STAT_AI_BehaviorTree_NumSleeping);
+			return;
+		}
+
+		DeltaTime = AccumulatedTickDeltaTime;
+		AccumulatedTickDeltaTime = 0.0f;
+	}
+
+	INC_DWORD_STAT(STAT_AI_BehaviorTree_NumTicked);
+
+	// nodes ticked below can still wake tree up with ScheduleNextTick
+	NextTickDeltaTime = FLT_MAX;
+	const float NextNeededDeltaTime = TickActiveNodes(DeltaTime);
+
+	NextTickDeltaTime = bScheduledTicking ? FMath::Min(NextTickDeltaTime, NextNeededDeltaTime) : 0.0f;
+
+	// nothing to tick until execution flow changes or message arrives, both will enable tick again
+	if (bScheduledTicking && NextTickDeltaTime == FLT_MAX && !bRequestedFlowUpdate && ThisTickFunction != NULL)
+	{
+		bTickSuspended = true;
+		SetComponentTickEnabled(false);
+		INC_DWORD_STAT(STAT_AI_BehaviorTree_NumSuspended);
+	}
+}
+
+float UBehaviorTreeComponent::TickActiveNodes(float DeltaTime)
+{
+	float NextNeededDeltaTime = FLT_MAX;
+
 	// tick active auxiliary nodes and parallel tasks (in execution order, before task)
 	for (int32 InstanceIndex = 0; InstanceIndex < InstanceStack.Num(); InstanceIndex++)
 	{
@@ -831,6 +924,7 @@ void UBehaviorTreeComponent::TickComponent(float DeltaTime, enum ELevelTick Tick
 			const UBTAuxiliaryNode* AuxNode = InstanceInfo.ActiveAuxNodes[AuxIndex];
 			uint8* NodeMemory = AuxNode->GetNodeMemory<uint8>(InstanceInfo);
 			AuxNode->WrappedTickNode(*this, NodeMemory, DeltaTime);
+			NextNeededDeltaTime = FMath::Min(NextNeededDeltaTime, AuxNode->GetNextNeededDeltaTime(*this, NodeMemory));
 		}
 
 		for (int32 TaskIndex = 0; TaskIndex < InstanceInfo.ParallelTasks.Num(); TaskIndex++)
@@ -838,6 +932,7 @@ void UBehaviorTreeComponent::TickComponent(float DeltaTime, enum ELevelTick Tick
 			const UBTTaskNode* ParallelTask = InstanceInfo.ParallelTasks[TaskIndex].TaskNode;
 			uint8* NodeMemory = ParallelTask->GetNodeMemory<uint8>(InstanceInfo);
 			ParallelTask->WrappedTickTask(*this, NodeMemory, DeltaTime);
+			NextNeededDeltaTime = FMath::Min(NextNeededDeltaTime, ParallelTask->GetNextNeededDeltaTime(*this, NodeMemory));
 		}
 	}
 
@@ -849,7 +944,10 @@ void UBehaviorTreeComponent::TickComponent(float DeltaTime, enum ELevelTick Tick
 		UBTTaskNode* ActiveTask = (UBTTaskNode*)ActiveInstance.ActiveNode;
 		uint8* NodeMemory = ActiveTask->GetNodeMemory<uint8>(ActiveInstance);
 		ActiveTask->WrappedTickTask(*this, NodeMemory, DeltaTime);
+		NextNeededDeltaTime = FMath::Min(NextNeededDeltaTime, ActiveTask->GetNextNeededDeltaTime(*this, NodeMemory));
 	}
+
+	return NextNeededDeltaTime;
 }
 
 void UBehaviorTreeComponent::ProcessExecutionRequest()
@@ -1153,6 +1251,9 @@ void UBehaviorTreeComponent::ExecuteTask(UBTTaskNode* TaskNode)
 	ActiveInstance.ActiveNode = TaskNode;
 	ActiveInstance.ActiveNodeType = EBTActiveNode::ActiveTask;
 
+	// new task may need to be ticked
+	ScheduleNextTick();
+
 	// make a snapshot for debugger
 	StoreDebuggerExecutionStep(EBTExecutionSnap::Regular);
 
@@ -1272,6 +1373,7 @@ void UBehaviorTreeComponent::RegisterParallelTask(const UBTTaskNode* TaskNode)
 {
 	FBehaviorTreeInstance& InstanceInfo = InstanceStack[ActiveInstanceIdx];
 	AUX_NODE_WRAPPER(InstanceInfo.ParallelTasks.Add( FBehaviorTreeParallelTask(TaskNode, EBTTaskStatus::Active) ));
+	ScheduleNextTick();
 	
 	UE_VLOG(GetOwner(), LogBehaviorTree, Verbose, TEXT("Parallel task: %s added to active list"),
 		*UBehaviorTreeTypes::DescribeNodeHelper(TaskNode));
@@ -1405,6 +1507,7 @@ bool UBehaviorTreeComponent::PushInstance(UBehaviorTree& TreeAsset)
 			InstanceStack[ActiveInstanceIdx].ActiveAuxNodes.Add(ServiceNode);
 			ServiceNode->WrappedOnBecomeRelevant(*this, NodeMemory);
 		}
+		ScheduleNextTick();
 
 		FBehaviorTreeDelegates::OnTreeStarted.Broadcast(*this, TreeAsset);
 
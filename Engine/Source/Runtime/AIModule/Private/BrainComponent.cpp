@@ -180,6 +180,7 @@ FString FAIMessageObserver::DescribeObservedMessage() const
 UBrainComponent::UBrainComponent(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
 {
 	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bAllowTickBatching = true;
 	bDoLogicRestartOnUnlock = false;
 }
 
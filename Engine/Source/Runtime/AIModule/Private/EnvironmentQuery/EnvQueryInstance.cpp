@@ -5,6 +5,33 @@
 #include "EnvironmentQuery/Contexts/EnvQueryContext_Item.h"
 #include "EnvironmentQuery/Items/EnvQueryItemType_ActorBase.h"
 #include "EnvironmentQuery/Items/EnvQueryItemType_VectorBase.h"
+#include "EnvironmentQuery/EnvQueryTest.h"
+
+static TAutoConsoleVariable<int32> CVarParallelTests(
+	TEXT("ai.eqs.ParallelTests"),
+	1,
+	TEXT("If 1, tests that support it score items of a query on task graph worker threads.\n")
+	TEXT("If 0, all tests run on game thread."),
+	ECVF_Default);
+
+/** Minimal number of items worth scoring in a separate task */
+static const int32 MinItemsPerParallelTest = 64;
+
+/** Item range of test running in parallel, ItemIterators created on the same thread are limited to it */
+class FEnvQueryParallelItemRange : public TThreadSingleton<FEnvQueryParallelItemRange>
+{
+	friend class TThreadSingleton<FEnvQueryParallelItemRange>;
+
+	FEnvQueryParallelItemRange()
+		: StartItem(INDEX_NONE)
+		, EndItem(INDEX_NONE)
+	{
+	}
+
+public:
+	int32 StartItem;
+	int32 EndItem;
+};
 
 //----------------------------------------------------------------------//
 // FEQSQueryDebugData
@@ -239,7 +266,16 @@ void FEnvQueryInstance::ExecuteOneStep(double InTimeLimit)
 		}
 
 		const int32 ItemsAlreadyProcessed = CurrentTestStartingItem;
-		TestObject->RunTest(*this);
+		const int32 NumItemsToProcess = Items.Num() - CurrentTestStartingItem;
+		if (CanBatchTest() && TestObject->CanRunInParallel() && NumItemsToProcess >= MinItemsPerParallelTest * 2
+			&& CVarParallelTests.GetValueOnGameThread() != 0 && FApp::ShouldUseThreadingForPerformance())
+		{
+			RunTestInParallel(TestObject);
+		}
+		else
+		{
+			TestObject->RunTest(*this);
+		}
 		bStepDone = CurrentTestStartingItem >= Items.Num() || bFoundSingleResult
 			// or no items processed ==> this means error
 			|| (ItemsAlreadyProcessed == CurrentTestStartingItem);
@@ -312,11 +348,97 @@ void FEnvQueryInstance::ReserveItemData(int32 NumAdditionalItems)
 }
 
 
+void FEnvQueryInstance::RunTestInParallel(const UEnvQueryTest* TestObject)
+{
+	const double StartTime = FPlatformTime::Seconds();
+	const int32 NumItems = Items.Num();
+	const int32 FirstItem = CurrentTestStartingItem;
+	int32 StartItem = FirstItem;
+
+	// first range runs alone on game thread, it fills context cache and binds data used by the others.
+	// Contexts are prepared only for valid items (e.g. per item lines of dot test), so it has to include at least one of them
+	int32 FirstValidItem = FirstItem;
+	while (FirstValidItem < NumItems && !Items[FirstValidItem].IsValid())
+	{
+		FirstValidItem++;
+	}
+	const int32 NumWarmupItems = FMath::Min(FMath::Max(MinItemsPerParallelTest, FirstValidItem - FirstItem + 1), NumItems - FirstItem);
+	RunTestOnItemRange(TestObject, StartItem, StartItem + NumWarmupItems);
+	StartItem += NumWarmupItems;
+
+	// workers can't stop in the middle of their range, so hand out only as many items as the time left in this step allows,
+	// judging by the cost of warmup range. Remaining items are scored in the next steps.
+	const int32 NumThreads = FTaskGraphInterface::Get().GetNumWorkerThreads() + 1;
+	int32 EndItem = NumItems;
+	if (TimeLimit > 0.0)
+	{
+		const double WarmupTime = FPlatformTime::Seconds() - StartTime;
+		const double TimePerItem = WarmupTime / NumWarmupItems;
+		if (TimePerItem > 0.0)
+		{
+			const double NumAffordableItems = FMath::Max(TimeLimit - WarmupTime, 0.0) / TimePerItem * NumThreads;
+			EndItem = StartItem + (int32)FMath::Min(NumAffordableItems, (double)(NumItems - StartItem));
+		}
+	}
+
+	DECLARE_CYCLE_STAT(TEXT("FSimpleDelegateGraphTask.EQS parallel test"),
+		STAT_FSimpleDelegateGraphTask_EnvQueryParallelTest,
+		STATGROUP_TaskGraphTasks);
+
+	// game thread scores the last range while waiting for workers
+	const int32 NumTasks = FMath::Clamp((EndItem - StartItem) / MinItemsPerParallelTest, 1, NumThreads);
+	const int32 ItemsPerTask = FMath::DivideAndRoundUp(EndItem - StartItem, NumTasks);
+
+	FGraphEventArray TestTasks;
+	for (; StartItem + ItemsPerTask < EndItem; StartItem += ItemsPerTask)
+	{
+		TestTasks.Add(FSimpleDelegateGraphTask::CreateAndDispatchWhenReady(
+			FSimpleDelegateGraphTask::FDelegate::CreateRaw(this, &FEnvQueryInstance::RunTestOnItemRange, TestObject, StartItem, StartItem + ItemsPerTask),
+			GET_STATID(STAT_FSimpleDelegateGraphTask_EnvQueryParallelTest)));
+	}
+
+	if (StartItem < EndItem)
+	{
+		RunTestOnItemRange(TestObject, StartItem, EndItem);
+	}
+	FTaskGraphInterface::Get().WaitUntilTasksComplete(TestTasks, ENamedThreads::GameThread_Local);
+
+	// every item writes only its own results, so they don't depend on order in which ranges finished
+	CurrentTestStartingItem = EndItem;
+}
+
+void FEnvQueryInstance::RunTestOnItemRange(const UEnvQueryTest* TestObject, int32 StartItem, int32 EndItem)
+{
+	FEnvQueryParallelItemRange& ItemRange = FEnvQueryParallelItemRange::Get();
+	ItemRange.StartItem = StartItem;
+	ItemRange.EndItem = EndItem;
+
+	TestObject->RunTest(*this);
+
+	ItemRange.StartItem = INDEX_NONE;
+	ItemRange.EndItem = INDEX_NONE;
+}
+
 FEnvQueryInstance::ItemIterator::ItemIterator(const UEnvQueryTest* QueryTest, FEnvQueryInstance& QueryInstance, int32 StartingItemIndex)
 	: Instance(&QueryInstance)
 	, CurrentItem(StartingItemIndex != INDEX_NONE ? StartingItemIndex : QueryInstance.CurrentTestStartingItem)
+	, EndItem(QueryInstance.Items.Num())
+	, NumDiscardedItems(0)
+	, bInParallelRange(false)
 {
-	Deadline = QueryInstance.TimeLimit > 0.0 ? (FPlatformTime::Seconds() + QueryInstance.TimeLimit) : -1.0;
+	const FEnvQueryParallelItemRange& ItemRange = FEnvQueryParallelItemRange::Get();
+	if (ItemRange.EndItem != INDEX_NONE)
+	{
+		// whole range has to be processed, there's no resume point for it
+		bInParallelRange = true;
+		CurrentItem = ItemRange.StartItem;
+		EndItem = ItemRange.EndItem;
+		Deadline = -1.0;
+	}
+	else
+	{
+		Deadline = QueryInstance.TimeLimit > 0.0 ? (FPlatformTime::Seconds() + QueryInstance.TimeLimit) : -1.0;
+	}
 	// it's possible item 'CurrentItem' has been already discarded. Find a valid starting index
 	--CurrentItem;
 	FindNextValidIndex();
@@ -330,7 +452,14 @@ void FEnvQueryInstance::ItemIterator::HandleFailedTestResult()
 #if USE_EQS_DEBUGGER
 	Instance->ItemDetails[CurrentItem].FailedTestIndex = Instance->CurrentTest;
 #endif
-	Instance->NumValidItems--;
+	if (bInParallelRange)
+	{
+		NumDiscardedItems++;
+	}
+	else
+	{
+		Instance->NumValidItems--;
+	}
 }
 
 void FEnvQueryInstance::ItemIterator::StoreTestResult()
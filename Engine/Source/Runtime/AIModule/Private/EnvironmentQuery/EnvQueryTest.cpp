@@ -15,6 +15,7 @@ UEnvQueryTest::UEnvQueryTest(const FObjectInitializer& ObjectInitializer) : Supe
 {
 	TestPurpose = EEnvTestPurpose::FilterAndScore;
 	Cost = EEnvTestCost::Low;
+	bCanRunInParallel = false;
 	FilterType = EEnvTestFilterType::Range;
 	ScoringEquation = EEnvTestScoreEquation::Linear;
 	ClampMinType = EEnvQueryTestClamping::None;
@@ -29,6 +30,12 @@ UEnvQueryTest::UEnvQueryTest(const FObjectInitializer& ObjectInitializer) : Supe
 	Weight.Value = 1.0f;
 }
 
+bool UEnvQueryTest::CanRunInParallel() const
+{
+	// bound data providers are read while running test and may call into game code
+	return bCanRunInParallel && !BoolValue.IsDynamic() && !FloatValueMin.IsDynamic() && !FloatValueMax.IsDynamic();
+}
+
 void UEnvQueryTest::NormalizeItemScores(FEnvQueryInstance& QueryInstance)
 {
 	if (!IsScoring())
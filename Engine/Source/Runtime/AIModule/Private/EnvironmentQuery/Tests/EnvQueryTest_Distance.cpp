@@ -28,6 +28,7 @@ UEnvQueryTest_Distance::UEnvQueryTest_Distance(const FObjectInitializer& ObjectI
 	DistanceTo = UEnvQueryContext_Querier::StaticClass();
 	Cost = EEnvTestCost::Low;
 	ValidItemType = UEnvQueryItemType_VectorBase::StaticClass();
+	bCanRunInParallel = true;
 }
 
 void UEnvQueryTest_Distance::RunTest(FEnvQueryInstance& QueryInstance) const
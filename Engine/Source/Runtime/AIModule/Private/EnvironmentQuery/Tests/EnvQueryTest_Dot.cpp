@@ -10,6 +10,7 @@ UEnvQueryTest_Dot::UEnvQueryTest_Dot(const FObjectInitializer& ObjectInitializer
 {
 	Cost = EEnvTestCost::Low;
 	ValidItemType = UEnvQueryItemType_VectorBase::StaticClass();
+	bCanRunInParallel = true;
 	LineA.DirMode = EEnvDirection::Rotation;
 	LineA.Rotation = UEnvQueryContext_Querier::StaticClass();
 	LineB.DirMode = EEnvDirection::TwoPoints;
@@ -29,6 +29,17 @@ DECLARE_CYCLE_STAT(TEXT("Step: navlinks"), STAT_AI_Crowd_StepNavLinkTime, STATGR
 DECLARE_CYCLE_STAT(TEXT("Step: movement"), STAT_AI_Crowd_StepMovementTime, STATGROUP_AICrowd);
 DECLARE_CYCLE_STAT(TEXT("Agent Update Time"), STAT_AI_Crowd_AgentUpdateTime, STATGROUP_AICrowd);
 DECLARE_DWORD_COUNTER_STAT(TEXT("Num Agents"), STAT_AI_Crowd_NumAgents, STATGROUP_AICrowd);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Num Parallel Tasks"), STAT_AI_Crowd_NumParallelTasks, STATGROUP_AICrowd);
+
+static TAutoConsoleVariable<int32> CVarParallelCrowdUpdate(
+	TEXT("ai.crowd.ParallelUpdate"),
+	1,
+	TEXT("If 1, neighbour gathering and avoidance of crowd agents run on task graph worker threads.\n")
+	TEXT("If 0, whole crowd simulation runs on game thread."),
+	ECVF_Default);
+
+/** Minimal number of crowd agents worth simulating in a separate task */
+static const int32 MinAgentsPerParallelTask = 64;
 
 DEFINE_LOG_CATEGORY_STATIC(LogEngineCrowdFollowing, Warning, All)
 
@@ -217,9 +228,20 @@ void UCrowdManager::Tick(float DeltaTime)
 				SCOPE_CYCLE_COUNTER(STAT_AI_Crowd_StepPathsTime);
 				DetourCrowd->updateStepPaths(DeltaTime, DetourAgentDebug);
 			}
+			const int32 NumTasks = GetNumParallelTasks(NumActive);
+			INC_DWORD_STAT_BY(STAT_AI_Crowd_NumParallelTasks, NumTasks);
 			{
 				SCOPE_CYCLE_COUNTER(STAT_AI_Crowd_StepProximityTime);
-				DetourCrowd->updateStepProximityData(DeltaTime, DetourAgentDebug);
+				if (NumTasks > 1)
+				{
+					// boundaries use crowd's navmesh query, only neighbours can be gathered in parallel
+					DetourCrowd->updateStepBoundaries(DeltaTime, DetourAgentDebug);
+					RunParallelStep(&UCrowdManager::UpdateNeighboursRange, NumActive, NumTasks);
+				}
+				else
+				{
+					DetourCrowd->updateStepProximityData(DeltaTime, DetourAgentDebug);
+				}
 				PostProximityUpdate();
 			}
 			{
@@ -232,7 +254,23 @@ void UCrowdManager::Tick(float DeltaTime)
 			}
 			{
 				SCOPE_CYCLE_COUNTER(STAT_AI_Crowd_StepAvoidanceTime);
-				DetourCrowd->updateStepAvoidance(DeltaTime, DetourAgentDebug);
+				if (NumTasks > 1)
+				{
+					TaskVelocitySampleCounts.Reset();
+					TaskVelocitySampleCounts.AddZeroed(NumTasks);
+					RunParallelStep(&UCrowdManager::UpdateAvoidanceRange, NumActive, NumTasks);
+
+					int32 NumVelocitySamples = 0;
+					for (int32 Idx = 0; Idx < NumTasks; Idx++)
+					{
+						NumVelocitySamples += TaskVelocitySampleCounts[Idx];
+					}
+					DetourCrowd->setVelocitySampleCount(NumVelocitySamples);
+				}
+				else
+				{
+					DetourCrowd->updateStepAvoidance(DeltaTime, DetourAgentDebug);
+				}
 			}
 			{
 				SCOPE_CYCLE_COUNTER(STAT_AI_Crowd_StepComponentsTime);
@@ -853,6 +891,9 @@ void UCrowdManager::CreateCrowdManager()
 			}
 		}
 
+		// game thread and every worker can run avoidance at the same time
+		DetourCrowd->initParallelAvoidance(FApp::ShouldUseThreadingForPerformance() ? FTaskGraphInterface::Get().GetNumWorkerThreads() + 1 : 1);
+
 		UpdateAvoidanceConfig();
 
 		for (auto It = ActiveAgents.CreateIterator(); It; ++It)
@@ -1160,6 +1201,54 @@ void UCrowdManager::PostProximityUpdate()
 	// empty in base class
 }
 
+#if WITH_RECAST
+int32 UCrowdManager::GetNumParallelTasks(int32 NumActiveAgents) const
+{
+	if (CVarParallelCrowdUpdate.GetValueOnGameThread() == 0 || !FApp::ShouldUseThreadingForPerformance())
+	{
+		return 1;
+	}
+
+	// every task needs its own avoidance query
+	return FMath::Clamp(NumActiveAgents / MinAgentsPerParallelTask, 1, DetourCrowd->getNumAvoidanceQueries());
+}
+
+void UCrowdManager::RunParallelStep(FAgentRangeStep Step, int32 NumActiveAgents, int32 NumTasks)
+{
+	DECLARE_CYCLE_STAT(TEXT("FSimpleDelegateGraphTask.Crowd parallel step"),
+		STAT_FSimpleDelegateGraphTask_CrowdParallelStep,
+		STATGROUP_TaskGraphTasks);
+
+	const int32 AgentsPerTask = FMath::DivideAndRoundUp(NumActiveAgents, NumTasks);
+
+	// game thread simulates the last range while waiting for workers
+	FGraphEventArray StepTasks;
+	int32 StartIdx = 0;
+	int32 TaskIdx = 0;
+	for (; StartIdx + AgentsPerTask < NumActiveAgents; StartIdx += AgentsPerTask, TaskIdx++)
+	{
+		StepTasks.Add(FSimpleDelegateGraphTask::CreateAndDispatchWhenReady(
+			FSimpleDelegateGraphTask::FDelegate::CreateUObject(this, Step, TaskIdx, StartIdx, StartIdx + AgentsPerTask),
+			GET_STATID(STAT_FSimpleDelegateGraphTask_CrowdParallelStep)));
+	}
+
+	(this->*Step)(TaskIdx, StartIdx, NumActiveAgents);
+	FTaskGraphInterface::Get().WaitUntilTasksComplete(StepTasks, ENamedThreads::GameThread_Local);
+}
+
+void UCrowdManager::UpdateNeighboursRange(int32 TaskIdx, int32 StartIdx, int32 EndIdx)
+{
+	DetourCrowd->updateStepNeighbours(StartIdx, EndIdx);
+}
+
+void UCrowdManager::UpdateAvoidanceRange(int32 TaskIdx, int32 StartIdx, int32 EndIdx)
+{
+	// agents read only their neighbours' positions and velocities and write their own new velocity,
+	// so results don't depend on how agents were split between tasks
+	TaskVelocitySampleCounts[TaskIdx] = DetourCrowd->updateStepAvoidanceRange(StartIdx, EndIdx, TaskIdx, DetourAgentDebug);
+}
+#endif // WITH_RECAST
+
 UWorld* UCrowdManager::GetWorld() const
 {
 	UNavigationSystem* NavSys = Cast<UNavigationSystem>(GetOuter());
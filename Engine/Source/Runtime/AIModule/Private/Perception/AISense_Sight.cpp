@@ -7,8 +7,13 @@
 
 DECLARE_CYCLE_STAT(TEXT("Perception Sense: Sight"),STAT_AI_Sense_Sight,STATGROUP_AI);
 DECLARE_CYCLE_STAT(TEXT("Perception Sense: Sight, Listener Update"), STAT_AI_Sense_Sight_ListenerUpdate, STATGROUP_AI);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Perception Sense: Sight, pairs considered"), STAT_AI_Sense_Sight_PairsConsidered, STATGROUP_AI);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Perception Sense: Sight, pairs traced"), STAT_AI_Sense_Sight_PairsTraced, STATGROUP_AI);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Perception Sense: Sight, out of range pairs"), STAT_AI_Sense_Sight_OutOfRangePairs, STATGROUP_AI);
 
 static const int32 DefaultMaxTracesPerTick = 6;
+static const float DefaultTargetGridCellSize = 2000.f;
+static const float MinTargetGridCellSize = 100.f;
 
 //----------------------------------------------------------------------//
 // helpers
@@ -24,13 +29,23 @@ FORCEINLINE_DEBUGGABLE bool CheckIsTargetInSightPie(const FPerceptionListener& L
 	return false;
 }
 
+FORCEINLINE float GetMaxSightRadiusSq(const UAISense_Sight::FDigestedSightProperties& DigestedProps)
+{
+	return FMath::Max(DigestedProps.SightRadiusSq, DigestedProps.LoseSightRadiusSq);
+}
+
+FORCEINLINE FIntPoint GetTargetGridCell(const FVector& Location, const float CellSize)
+{
+	return FIntPoint(FMath::FloorToInt(Location.X / CellSize), FMath::FloorToInt(Location.Y / CellSize));
+}
+
 //----------------------------------------------------------------------//
 // FAISightTarget
 //----------------------------------------------------------------------//
 const FAISightTarget::FTargetId FAISightTarget::InvalidTargetId = NAME_None;
 
 FAISightTarget::FAISightTarget(AActor* InTarget, FGenericTeamId InTeamId)
-	: Target(InTarget), SightTargetInterface(NULL), TeamId(InTeamId)
+	: Target(InTarget), SightTargetInterface(NULL), TeamId(InTeamId), GridCell(FIntPoint::NoneValue)
 {
 	if (InTarget)
 	{
@@ -63,6 +78,7 @@ UAISense_Sight::FDigestedSightProperties::FDigestedSightProperties()
 UAISense_Sight::UAISense_Sight(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 	, MaxTracesPerTick(DefaultMaxTracesPerTick)
+	, TargetGridCellSize(DefaultTargetGridCellSize)
 	, HighImportanceQueryDistanceThreshold(300.f)
 	, MaxQueryImportance(60.f)
 	, SightLimitQueryImportance(10.f)
@@ -89,6 +105,141 @@ void UAISense_Sight::PostInitProperties()
 {
 	Super::PostInitProperties();
 	HighImportanceDistanceSquare = FMath::Square(HighImportanceQueryDistanceThreshold);
+	TargetGridCellSize = FMath::Max(TargetGridCellSize, MinTargetGridCellSize);
+}
+
+void UAISense_Sight::AddQuery(const FPerceptionListener& Listener, const FDigestedSightProperties& PropDigest, const FAISightQuery& SightQuery, const FVector& TargetLocation)
+{
+	if (FVector::DistSquared(Listener.CachedLocation, TargetLocation) > GetMaxSightRadiusSq(PropDigest))
+	{
+		SightQueriesOutOfRange.FindOrAdd(SightQuery.ObserverId).Add(SightQuery.TargetId, SightQuery);
+	}
+	else
+	{
+		SightQueryQueue.Add(SightQuery);
+	}
+}
+
+void UAISense_Sight::UpdateTargetGrid(TArray<FAISightTarget::FTargetId>& OutInvalidTargets)
+{
+	for (TMap<FName, FAISightTarget>::TIterator ItTarget(ObservedTargets); ItTarget; ++ItTarget)
+	{
+		FAISightTarget& Target = ItTarget->Value;
+		if (Target.Target.IsValid() == false)
+		{
+			// queries to this target may all be out of range, so it would never be found invalid by Update's main loop
+			OutInvalidTargets.AddUnique(Target.TargetId);
+			continue;
+		}
+
+		const FIntPoint Cell = GetTargetGridCell(Target.Target->GetActorLocation(), TargetGridCellSize);
+		if (Cell != Target.GridCell)
+		{
+			RemoveTargetFromGrid(Target);
+			TargetGrid.FindOrAdd(Cell).Add(Target.TargetId);
+			Target.GridCell = Cell;
+		}
+	}
+}
+
+void UAISense_Sight::RemoveTargetFromGrid(const FAISightTarget& Target)
+{
+	TArray<FAISightTarget::FTargetId>* CellTargets = TargetGrid.Find(Target.GridCell);
+	if (CellTargets != NULL)
+	{
+		CellTargets->RemoveSingleSwap(Target.TargetId);
+		if (CellTargets->Num() == 0)
+		{
+			TargetGrid.Remove(Target.GridCell);
+		}
+	}
+}
+
+int32 UAISense_Sight::RestoreQueriesInRange()
+{
+	AIPerception::FListenerMap& ListenersMap = *GetListeners();
+	int32 NumPairsChecked = 0;
+	bool bQueriesRestored = false;
+
+	for (TMap<FPerceptionListenerID, TMap<FAISightTarget::FTargetId, FAISightQuery> >::TIterator ItListener(SightQueriesOutOfRange); ItListener; ++ItListener)
+	{
+		TMap<FAISightTarget::FTargetId, FAISightQuery>& ListenerQueries = ItListener->Value;
+		const FPerceptionListener* Listener = ListenersMap.Find(ItListener->Key);
+		const FDigestedSightProperties* PropDigest = DigestedProperties.Find(ItListener->Key);
+		if (Listener == NULL || PropDigest == NULL)
+		{
+			continue;
+		}
+
+		const float MaxRadiusSq = GetMaxSightRadiusSq(*PropDigest);
+		auto IsInRange = [&](const FAISightTarget::FTargetId& TargetId) -> bool
+		{
+			++NumPairsChecked;
+			const FAISightTarget* Target = ObservedTargets.Find(TargetId);
+			return Target != NULL && Target->Target.IsValid() && FVector::DistSquared(Listener->CachedLocation, Target->GetLocationSimple()) <= MaxRadiusSq;
+		};
+		auto RestoreQuery = [&](FAISightQuery& SightQuery)
+		{
+			SightQuery.Importance = CalcQueryImportance(*Listener, ObservedTargets[SightQuery.TargetId].GetLocationSimple(), PropDigest->SightRadiusSq);
+			SightQuery.RecalcScore();
+			SightQueryQueue.Add(SightQuery);
+			bQueriesRestored = true;
+		};
+
+		const float MaxRadius = FMath::Sqrt(MaxRadiusSq);
+		const FIntPoint MinCell = GetTargetGridCell(Listener->CachedLocation - FVector(MaxRadius), TargetGridCellSize);
+		const FIntPoint MaxCell = GetTargetGridCell(Listener->CachedLocation + FVector(MaxRadius), TargetGridCellSize);
+		const int32 NumCells = (MaxCell.X - MinCell.X + 1) * (MaxCell.Y - MinCell.Y + 1);
+
+		if (NumCells > ListenerQueries.Num())
+		{
+			// few parked queries for a big sight range, cheaper to test them directly
+			for (TMap<FAISightTarget::FTargetId, FAISightQuery>::TIterator ItQuery(ListenerQueries); ItQuery; ++ItQuery)
+			{
+				if (IsInRange(ItQuery->Key))
+				{
+					RestoreQuery(ItQuery->Value);
+					ItQuery.RemoveCurrent();
+				}
+			}
+		}
+		else
+		{
+			for (int32 CellY = MinCell.Y; CellY <= MaxCell.Y; ++CellY)
+			{
+				for (int32 CellX = MinCell.X; CellX <= MaxCell.X; ++CellX)
+				{
+					const TArray<FAISightTarget::FTargetId>* CellTargets = TargetGrid.Find(FIntPoint(CellX, CellY));
+					if (CellTargets == NULL)
+					{
+						continue;
+					}
+
+					for (const FAISightTarget::FTargetId& TargetId : *CellTargets)
+					{
+						FAISightQuery* SightQuery = ListenerQueries.Find(TargetId);
+						if (SightQuery != NULL && IsInRange(TargetId))
+						{
+							RestoreQuery(*SightQuery);
+							ListenerQueries.Remove(TargetId);
+						}
+					}
+				}
+			}
+		}
+
+		if (ListenerQueries.Num() == 0)
+		{
+			ItListener.RemoveCurrent();
+		}
+	}
+
+	if (bQueriesRestored)
+	{
+		SortQueries();
+	}
+
+	return NumPairsChecked;
 }
 
 float UAISense_Sight::Update()
@@ -106,11 +257,14 @@ float UAISense_Sight::Update()
 
 	int32 TracesCount = 0;
 	static const int32 InitialInvalidItemsSize = 16;
-	TArray<int32> InvalidQueries;
+	TArray<int32> QueriesToRemove;
 	TArray<FAISightTarget::FTargetId> InvalidTargets;
-	InvalidQueries.Reserve(InitialInvalidItemsSize);
+	QueriesToRemove.Reserve(InitialInvalidItemsSize);
 	InvalidTargets.Reserve(InitialInvalidItemsSize);
 
+	UpdateTargetGrid(InvalidTargets);
+	int32 PairsConsidered = RestoreQueriesInRange();
+
 	AIPerception::FListenerMap& ListenersMap = *GetListeners();
 
 	FAISightQuery* SightQuery = SightQueryQueue.GetData();
@@ -193,11 +347,19 @@ float UAISense_Sight::Update()
 
 				// restart query
 				SightQuery->Age = 0.f;
+				++PairsConsidered;
+
+				// target can't be seen from this far, park the query until the target grid brings them close again
+				if (SightQuery->bLastResult == false && FVector::DistSquared(Listener.CachedLocation, TargetLocation) > GetMaxSightRadiusSq(PropDigest))
+				{
+					SightQueriesOutOfRange.FindOrAdd(SightQuery->ObserverId).Add(SightQuery->TargetId, *SightQuery);
+					QueriesToRemove.Add(QueryIndex);
+				}
 			}
 			else
 			{
 				// put this index to "to be removed" array
-				InvalidQueries.Add(QueryIndex);
+				QueriesToRemove.Add(QueryIndex);
 				if (bTargetValid == false)
 				{
 					InvalidTargets.AddUnique(SightQuery->TargetId);
@@ -213,32 +375,41 @@ float UAISense_Sight::Update()
 		SightQuery->RecalcScore();
 	}
 
-	if (InvalidQueries.Num() > 0)
+	for (int32 Index = QueriesToRemove.Num() - 1; Index >= 0; --Index)
 	{
-		for (int32 Index = InvalidQueries.Num() - 1; Index >= 0; --Index)
-		{
-			// removing with swapping here, since queue is going to be sorted anyway
-			SightQueryQueue.RemoveAtSwap(InvalidQueries[Index], 1, /*bAllowShrinking*/false);
-		}
+		// removing with swapping here, since queue is going to be sorted anyway
+		SightQueryQueue.RemoveAtSwap(QueriesToRemove[Index], 1, /*bAllowShrinking*/false);
+	}
 
-		if (InvalidTargets.Num() > 0)
+	if (InvalidTargets.Num() > 0)
+	{
+		for (const auto& TargetId : InvalidTargets)
 		{
-			for (const auto& TargetId : InvalidTargets)
-			{
-				// remove affected queries
-				RemoveAllQueriesToTarget(TargetId, DontSort);
-				// remove target itself
-				ObservedTargets.Remove(TargetId);
-			}
-
-			// remove holes
-			ObservedTargets.Compact();
+			// remove affected queries
+			RemoveAllQueriesToTarget(TargetId, DontSort);
+			// remove target itself
+			RemoveTargetFromGrid(ObservedTargets[TargetId]);
+			ObservedTargets.Remove(TargetId);
 		}
+
+		// remove holes
+		ObservedTargets.Compact();
 	}
 
 	// sort Sight Queries
 	SortQueries();
 
+	INC_DWORD_STAT_BY(STAT_AI_Sense_Sight_PairsConsidered, PairsConsidered);
+	INC_DWORD_STAT_BY(STAT_AI_Sense_Sight_PairsTraced, TracesCount);
+#if STATS
+	int32 NumOutOfRangePairs = 0;
+	for (const auto& ListenerQueries : SightQueriesOutOfRange)
+	{
+		NumOutOfRangePairs += ListenerQueries.Value.Num();
+	}
+	SET_DWORD_STAT(STAT_AI_Sense_Sight_OutOfRangePairs, NumOutOfRangePairs);
+#endif // STATS
+
 	//return SightQueryQueue.Num() > 0 ? 1.f/6 : FLT_MAX;
 	return 0.f;
 }
@@ -288,7 +459,7 @@ bool UAISense_Sight::RegisterTarget(AActor& TargetActor, FQueriesOperationPostPr
 			const FDigestedSightProperties& PropDigest = DigestedProperties[Listener.GetListenerID()];
 			SightQuery.Importance = CalcQueryImportance(ItListener->Value, TargetLocation, PropDigest.SightRadiusSq);
 
-			SightQueryQueue.Add(SightQuery);
+			AddQuery(Listener, PropDigest, SightQuery, TargetLocation);
 			bNewQueriesAdded = true;
 		}
 	}
@@ -333,9 +504,10 @@ void UAISense_Sight::GenerateQueriesForListener(const FPerceptionListener& Liste
 		{
 			// create a sight query		
 			FAISightQuery SightQuery(Listener.GetListenerID(), ItTarget->Key);
-			SightQuery.Importance = CalcQueryImportance(Listener, ItTarget->Value.GetLocationSimple(), PropertyDigest.SightRadiusSq);
+			const FVector TargetLocation = ItTarget->Value.GetLocationSimple();
+			SightQuery.Importance = CalcQueryImportance(Listener, TargetLocation, PropertyDigest.SightRadiusSq);
 
-			SightQueryQueue.Add(SightQuery);
+			AddQuery(Listener, PropertyDigest, SightQuery, TargetLocation);
 			bNewQueriesAdded = true;
 		}
 	}
@@ -414,12 +586,14 @@ void UAISense_Sight::RemoveAllQueriesByListener(const FPerceptionListener& Liste
 {
 	SCOPE_CYCLE_COUNTER(STAT_AI_Sense_Sight);
 
+	const uint32 ListenerId = Listener.GetListenerID();
+	SightQueriesOutOfRange.Remove(ListenerId);
+
 	if (SightQueryQueue.Num() == 0)
 	{
 		return;
 	}
 
-	const uint32 ListenerId = Listener.GetListenerID();
 	bool bQueriesRemoved = false;
 	
 	const FAISightQuery* SightQuery = &SightQueryQueue[SightQueryQueue.Num() - 1];
@@ -442,6 +616,11 @@ void UAISense_Sight::RemoveAllQueriesToTarget(const FName& TargetId, FQueriesOpe
 {
 	SCOPE_CYCLE_COUNTER(STAT_AI_Sense_Sight);
 
+	for (auto& ListenerQueries : SightQueriesOutOfRange)
+	{
+		ListenerQueries.Value.Remove(TargetId);
+	}
+
 	if (SightQueryQueue.Num() == 0)
 	{
 		return;
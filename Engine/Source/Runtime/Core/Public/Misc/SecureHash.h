@@ -135,6 +135,14 @@ public:
 		return FMemory::Memcmp(&X.Hash, &Y.Hash, sizeof(X.Hash)) != 0;
 	}
 
+	friend uint32 GetTypeHash(const FSHAHash& InKey)
+	{
+		// The bytes of a SHA hash are already well distributed, so just use the first four
+		uint32 Result;
+		FMemory::Memcpy(&Result, InKey.Hash, sizeof(Result));
+		return Result;
+	}
+
 	friend CORE_API FArchive& operator<<( FArchive& Ar, FSHAHash& G );
 };
 
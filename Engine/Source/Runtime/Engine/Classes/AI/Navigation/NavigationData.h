@@ -806,14 +806,17 @@ struct FAsyncPathFindingQuery : public FPathFindingQuery
 	const uint32 QueryID;
 	const FNavPathQueryDelegate OnDoneDelegate;
 	const TEnumAsByte<EPathFindingMode::Type> Mode;
+	/** queries with higher priority are processed first when there are more pending than allowed per frame */
+	const uint8 Priority;
 	FPathFindingResult Result;
 
 	FAsyncPathFindingQuery()
 		: QueryID(INVALID_NAVQUERYID)
+		, Priority(0)
 	{ }
 
 	FAsyncPathFindingQuery(const UObject* InOwner, const ANavigationData* InNavData, const FVector& Start, const FVector& End, const FNavPathQueryDelegate& Delegate, TSharedPtr<const FNavigationQueryFilter> SourceQueryFilter);
-	FAsyncPathFindingQuery(const FPathFindingQuery& Query, const FNavPathQueryDelegate& Delegate, const EPathFindingMode::Type QueryMode);
+	FAsyncPathFindingQuery(const FPathFindingQuery& Query, const FNavPathQueryDelegate& Delegate, const EPathFindingMode::Type QueryMode, const uint8 QueryPriority = 0);
 
 protected:
 	FORCEINLINE static uint32 GetUniqueID()
@@ -341,9 +341,10 @@ public:
 	 *	@param PathToFill if points to an actual navigation path instance than this instance will be filled with resulting path. Otherwise a new instance will be created and 
 	 *		used in call to ResultDelegate
 	 *  @param Mode switch between normal and hierarchical path finding algorithms
+	 *  @param Priority requests with higher priority are processed first when more are pending than ai.nav.MaxAsyncPathQueriesPerFrame allows
 	 *	@return request ID
 	 */
-	uint32 FindPathAsync(const FNavAgentProperties& AgentProperties, FPathFindingQuery Query, const FNavPathQueryDelegate& ResultDelegate, EPathFindingMode::Type Mode = EPathFindingMode::Regular);
+	uint32 FindPathAsync(const FNavAgentProperties& AgentProperties, FPathFindingQuery Query, const FNavPathQueryDelegate& ResultDelegate, EPathFindingMode::Type Mode = EPathFindingMode::Regular, uint8 Priority = 0);
 
 	/** Removes query indicated by given ID from queue of path finding requests to process. */
 	void AbortAsyncFindPathRequest(uint32 AsynPathQueryID);
@@ -812,10 +813,13 @@ private:
 	/** Adds given request to requests queue. Note it's to be called only on game thread only */
 	void AddAsyncQuery(const FAsyncPathFindingQuery& Query);
 		 
-	/** spawns a non-game-thread task to process requests given in PathFindingQueries.
+	/** spawns non-game-thread tasks to process requests given in PathFindingQueries, splitting them between worker threads.
 	 *	In the process PathFindingQueries gets copied. */
 	void TriggerAsyncQueries(TArray<FAsyncPathFindingQuery>& PathFindingQueries);
 
+	/** Moves up to MaxQueries of the pending async requests, highest priority first, to OutQueries. The rest stays queued in original order. */
+	void PopAsyncQueries(TArray<FAsyncPathFindingQuery>& OutQueries, int32 MaxQueries);
+
 	/** Processes pathfinding requests given in PathFindingQueries.*/
 	void PerformAsyncQueries(TArray<FAsyncPathFindingQuery> PathFindingQueries);
 };
@@ -610,6 +610,11 @@ public:
 	UPROPERTY(EditAnywhere, Category=Pathfinding, config, meta=(ClampMin = "0.1"))
 	float HeuristicScale;
 
+	/** if set, path corridors found between the same start and end polys with the same filter will be reused.
+	 *	Cached corridors get dropped when any tile they go through is rebuilt, added or removed */
+	UPROPERTY(EditAnywhere, Category=Pathfinding, config)
+	uint32 bCachePathCorridors:1;
+
 	/** broadcast for navmesh updates */
 	FOnNavMeshUpdate OnNavMeshUpdate;
 
@@ -266,6 +266,22 @@ public:
 		const TArray<FRotationTrack>& RotationData,
 		const TArray<FScaleTrack>& ScaleData,
 		bool IncludeKeyTable = false);
+
+	/**
+	 * Encodes individual key arrays into an AnimSequence interleaved by key frame, so the keys of every
+	 * animated track for a given frame are contiguous. Animated rotations are packed as ACF_Fixed48NoW,
+	 * animated translations and scales as ACF_Float96NoW, and single key tracks are stored once uncompressed.
+	 *
+	 * @param	Seq					Pointer to an Animation Sequence which will contain the interleaved data.
+	 * @param	TranslationData		Translation Tracks to pack into the Animation Sequence.
+	 * @param	RotationData		Rotation Tracks to pack into the Animation Sequence.
+	 * @param	ScaleData			Scale Tracks to pack into the Animation Sequence.
+	 */
+	static void InterleaveAnimationTracks(
+		class UAnimSequence* Seq,
+		const TArray<FTranslationTrack>& TranslationData,
+		const TArray<FRotationTrack>& RotationData,
+		const TArray<FScaleTrack>& ScaleData);
 };
 
 
@@ -31,6 +31,9 @@ class UAnimCompress_Automatic : public UAnimCompress
 	UPROPERTY(EditAnywhere, Category=AnimationCompressionAlgorithm_Automatic)
 	uint32 bTryIntervalKeyRemoval:1;
 
+	UPROPERTY(EditAnywhere, Category=AnimationCompressionAlgorithm_Automatic)
+	uint32 bTryInterleavedKeyLerp:1;
+
 	UPROPERTY(EditAnywhere, Category=AnimationCompressionAlgorithm_Automatic)
 	uint32 bRunCurrentDefaultCompressor:1;
 
@@ -0,0 +1,25 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+/**
+ * Bitwise animation compression with the keys of all tracks interleaved by key frame; performs no key reduction.
+ * All the data needed to sample a pose at a given time is contiguous, which makes decompression cheaper.
+ */
+
+#pragma once
+#include "Animation/AnimCompress.h"
+#include "AnimCompress_InterleavedKeyLerp.generated.h"
+
+UCLASS(MinimalAPI)
+class UAnimCompress_InterleavedKeyLerp : public UAnimCompress
+{
+	GENERATED_UCLASS_BODY()
+
+
+protected:
+	// Begin UAnimCompress Interface
+	virtual void DoReduction(class UAnimSequence* AnimSeq, const TArray<class FBoneData>& BoneData) override;
+	// Begin UAnimCompress Interface
+};
+
+
+
@@ -39,6 +39,7 @@ enum AnimationKeyFormat
 	AKF_ConstantKeyLerp,
 	AKF_VariableKeyLerp,
 	AKF_PerTrackCompression,
+	AKF_InterleavedKeyLerp,
 	AKF_MAX,
 };
 
@@ -43,6 +43,7 @@ public:
 
 	// Begin USceneComponent interface
 	virtual FBoxSphereBounds CalcBounds(const FTransform& LocalToWorld) const override;
+	virtual bool CanUpdateBoundsInParallel() const override { return GetClass() == UBoxComponent::StaticClass(); }
 	// End USceneComponent interface
 
 	// Begin UShapeComponent interface
@@ -68,6 +68,7 @@ public:
 
 	// Begin USceneComponent interface
 	virtual FBoxSphereBounds CalcBounds(const FTransform& LocalToWorld) const override;
+	virtual bool CanUpdateBoundsInParallel() const override { return GetClass() == UCapsuleComponent::StaticClass(); }
 	virtual void CalcBoundingCylinder(float& CylinderRadius, float& CylinderHalfHeight) const override;
 	// End USceneComponent interface
 
@@ -543,6 +543,28 @@ private:
 	void PropagateTransformUpdate(bool bTransformChanged, bool bSkipPhysicsMove = false);
 	void UpdateComponentToWorldWithParent(USceneComponent * Parent, bool bSkipPhysicsMove);
 
+	/**
+	 * Updates all descendants of this component in two phases: ComponentToWorld (and bounds, when CanUpdateBoundsInParallel)
+	 * is computed level by level on worker threads, then bounds, physics, rendering and navigation are updated depth first on the game thread.
+	 * @return false if the hierarchy can't or shouldn't be batched, in which case nothing was updated.
+	 */
+	bool UpdateChildTransformsBatched();
+
+	/**
+	 * Transform part of a batched update, see UpdateChildTransformsBatched. Only touches this component.
+	 * @param bDefaultTransforms - neither this component nor its parent override the transform math, so it may run on a worker thread
+	 * @return true if ComponentToWorld changed.
+	 */
+	bool UpdateComponentToWorldConcurrent(bool bDefaultTransforms, bool bUpdateBounds);
+
+	/** Game thread part of a batched update, the equivalent of PropagateTransformUpdate for this component and its descendants in the batch. */
+	void FinishBatchedTransformUpdate(const TArray<struct FBatchedTransformUpdate>& Updates, int32 UpdateIndex);
+
+	/** Applies the relative transform and the absolute flags of this component to the transform of its parent socket. */
+	FTransform ComposeComponentToWorld(const FTransform& NewRelativeTransform, const FTransform& ParentToWorld) const;
+
+	friend class FBatchedTransformPropagationTask;
+
 
 public:
 
@@ -650,6 +672,15 @@ public:
 	/** Update the Bounds of this component.*/
 	virtual void UpdateBounds();
 
+	/**
+	 * Whether UpdateBounds only reads this component and the assets it references, so batched transform propagation may call it from a worker thread.
+	 * Implementations only answer for the class they audited, subclasses opt in by overriding this again.
+	 */
+	virtual bool CanUpdateBoundsInParallel() const
+	{
+		return false;
+	}
+
 	/** If true, bounds should be used when placing component/actor in level, and spawning may fail */
 	virtual bool ShouldCollideWhenPlacing() const
 	{
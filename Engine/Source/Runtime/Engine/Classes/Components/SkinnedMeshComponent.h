@@ -635,9 +635,14 @@ public:
 	UPROPERTY(EditAnywhere, AdvancedDisplay, BlueprintReadWrite, Category=Optimization)
 	bool bEnableUpdateRateOptimizations;
 
-	/** Enable on screen debugging of update rate optimization. 
-	 * Red = Skipping 0 frames, Green = skipping 1 frame, Blue = skipping 2 frames, black = skipping more than 2 frames. 
-	 * @todo: turn this into a console command. */
+	/** If TRUE, the Owner's animation is updated and evaluated every frame regardless of its size on screen or LOD.
+	 * Use this when gameplay depends on accurate poses, e.g. during a cinematic or a melee exchange. 
+	 * Applies to all SkinnedMeshComponents of the Owner. */
+	UPROPERTY(EditAnywhere, AdvancedDisplay, BlueprintReadWrite, Category=Optimization)
+	bool bForceFullUpdateRate;
+
+	/** Enable on screen debugging of update rate optimization. Can also be enabled for all components with a.URO.Draw.
+	 * Red = Skipping 0 frames, Green = skipping 1 frame, Blue = skipping 2 frames, black = skipping more than 2 frames. */
 	UPROPERTY(EditAnywhere, AdvancedDisplay, BlueprintReadWrite, Category=Optimization)
 	bool bDisplayDebugUpdateRateOptimizations;
 
@@ -916,8 +921,11 @@ public:
 
 	/** Updates AnimUpdateRateParams, used by SkinnedMeshComponents.
 	* @param bRecentlyRendered : true if at least one SkinnedMeshComponent on this Actor has been rendered in the last second.
-	* @param MaxDistanceFactor : Largest SkinnedMeshComponent of this Actor drawn on screen. */
-	void AnimUpdateRateSetParams(const bool & bRecentlyRendered, const float& MaxDistanceFactor, const bool & bPlayingRootMotion);
+	* @param MaxDistanceFactor : Largest SkinnedMeshComponent of this Actor drawn on screen.
+	* @param bPlayingRootMotion : true if at least one SkinnedMeshComponent on this Actor is playing root motion.
+	* @param MinLODLevel : Most detailed LOD any SkinnedMeshComponent of this Actor is using.
+	* @param bForceFullRate : true if gameplay requested full rate updates on at least one SkinnedMeshComponent of this Actor. */
+	void AnimUpdateRateSetParams(const bool & bRecentlyRendered, const float& MaxDistanceFactor, const bool & bPlayingRootMotion, const int32& MinLODLevel, const bool & bForceFullRate);
 
 	virtual bool IsPlayingRootMotion(){ return false; }
 };
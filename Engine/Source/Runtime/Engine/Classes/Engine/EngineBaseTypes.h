@@ -160,6 +160,20 @@ public:
 	/** If false, this tick will run on the game thread, otherwise it will run on any thread in parallel with the game thread and in parallel with other "async ticks" **/
 	uint32 bRunOnAnyThread:1;
 
+	/** 
+	 * If true, frames where this tick function has no prerequisites may tick it together with other such tick functions of the same tick group in a single task,
+	 * instead of dispatching a task per tick function. Batches of tick functions that also run on any thread are ticked in parallel with each other.
+	 **/
+	UPROPERTY(EditDefaultsOnly, Category="Tick", AdvancedDisplay)
+	uint32 bAllowTickBatching:1;
+
+	/** 
+	 * The frequency in seconds at which this tick function will be executed. If less than or equal to 0 then it will tick every frame.
+	 * Read when the tick function is registered or enabled, and after each of its ticks to schedule the next one.
+	 **/
+	UPROPERTY(EditDefaultsOnly, Category="Tick", meta=(DisplayName="Tick Interval (secs)"))
+	float TickInterval;
+
 private:
 	/** If true, means that this tick function is in the master array of tick functions **/
 	uint32 bRegistered:1;
@@ -170,12 +184,18 @@ private:
 	 **/
 	uint32 bTickEnabled:1;
 
+	/** If true, this tick function is waiting for its next tick interval in the tick level and will not be queued until it is due **/
+	uint32 bTickCoolingDown:1;
+
 	/** Internal data to track if we have started visiting this tick function yet this frame **/
 	int32 TickVisitedGFrameCounter;
 
 	/** Internal data to track if we have finshed visiting this tick function yet this frame **/
 	int32 TickQueuedGFrameCounter;
 
+	/** Internal data holding the time elapsed since the previous tick of a tick function with a tick interval, 0 for tick functions ticking every frame **/
+	float TickIntervalDeltaSeconds;
+
 protected:
 	/** Internal data that indicates the tick group we actually executed in (it may have been delayed due to prerequisites) **/
 	TEnumAsByte<enum ETickingGroup> ActualTickGroup;
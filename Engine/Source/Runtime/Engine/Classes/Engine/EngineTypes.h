@@ -1694,6 +1694,10 @@ private:
 	UPROPERTY()
 	bool bSkipEvaluation;
 
+	/** Number of frames elapsed since the last evaluation. 0 on evaluation frames, EvaluationRate - 1 right before the next one. */
+	UPROPERTY()
+	int32 FramesSinceEvaluation;
+
 public:
 	/** Default constructor */
 	FAnimUpdateRateParameters()
@@ -1702,6 +1706,7 @@ public:
 		, bInterpolateSkippedFrames(false)
 		, bSkipUpdate(false)
 		, bSkipEvaluation(false)
+		, FramesSinceEvaluation(0)
 	{
 	}
 
@@ -1742,6 +1747,13 @@ public:
 	{
 		return bInterpolateSkippedFrames;
 	}
+
+	/** Alpha to move the displayed pose towards the last evaluated pose this frame, 
+	 * so that it is reached linearly by the time the next evaluation happens. */
+	float GetInterpolationAlpha() const
+	{
+		return 1.f / float(FMath::Max(EvaluationRate - FramesSinceEvaluation, 1));
+	}
 };
 
 /**
@@ -1222,6 +1222,64 @@ public:
 	 */
 	bool SweepMultiByProfile(TArray<FHitResult>& OutHits, const FVector& Start, const FVector& End, const FQuat& Rot, FName ProfileName, const struct FCollisionShape& CollisionShape, const struct FCollisionQueryParams& Params) const;
 
+	// BATCHED TRACE
+
+	/**
+	 *  Trace a batch of rays sharing the same channel and params against the world, and return which ones hit a blocking object.
+	 *  Filter data is set up once for the whole batch and large batches are split across task graph threads.
+	 *  @param  Starts          Start location of each ray
+	 *  @param  Ends            End location of each ray, must have as many elements as Starts
+	 *  @param  TraceChannel    The 'channel' that the rays are in, used to determine which components to hit
+	 *  @param  Params          Additional parameters used for every trace
+	 * 	@param 	ResponseParam	ResponseContainer to be used for every trace
+	 *  @param  OutBlockingHits Resized to the number of rays, element i is TRUE if ray i hit something blocking
+	 *  @return Number of rays that hit something blocking
+	 */
+	int32 BatchLineTraceTest(const TArray<FVector>& Starts, const TArray<FVector>& Ends, ECollisionChannel TraceChannel, const struct FCollisionQueryParams& Params, const struct FCollisionResponseParams& ResponseParam, TArray<bool>& OutBlockingHits) const;
+
+	/**
+	 *  Trace a batch of rays sharing the same channel and params against the world, and return the first blocking hit of each one.
+	 *  Filter data is set up once for the whole batch and large batches are split across task graph threads.
+	 *  @param  Starts          Start location of each ray
+	 *  @param  Ends            End location of each ray, must have as many elements as Starts
+	 *  @param  TraceChannel    The 'channel' that the rays are in, used to determine which components to hit
+	 *  @param  Params          Additional parameters used for every trace
+	 * 	@param 	ResponseParam	ResponseContainer to be used for every trace
+	 *  @param  OutHits         Resized to the number of rays, element i is the first blocking hit of ray i (bBlockingHit is false if there is none)
+	 *  @return Number of rays that hit something blocking
+	 */
+	int32 BatchLineTraceSingle(const TArray<FVector>& Starts, const TArray<FVector>& Ends, ECollisionChannel TraceChannel, const struct FCollisionQueryParams& Params, const struct FCollisionResponseParams& ResponseParam, TArray<struct FHitResult>& OutHits) const;
+
+	/**
+	 *  Sweep a batch of identical shapes sharing the same channel and params against the world, and return which ones hit a blocking object.
+	 *  Filter data and geometry are set up once for the whole batch and large batches are split across task graph threads.
+	 *  @param  Starts          Start location of each sweep
+	 *  @param  Ends            End location of each sweep, must have as many elements as Starts
+	 *  @param  Rot             Rotation of the shape for every sweep
+	 *  @param  TraceChannel    The 'channel' that the sweeps are in, used to determine which components to hit
+	 *  @param	CollisionShape	CollisionShape - supports Box, Sphere, Capsule
+	 *  @param  Params          Additional parameters used for every sweep
+	 * 	@param 	ResponseParam	ResponseContainer to be used for every sweep
+	 *  @param  OutBlockingHits Resized to the number of sweeps, element i is TRUE if sweep i hit something blocking
+	 *  @return Number of sweeps that hit something blocking
+	 */
+	int32 BatchSweepTest(const TArray<FVector>& Starts, const TArray<FVector>& Ends, const FQuat& Rot, ECollisionChannel TraceChannel, const struct FCollisionShape& CollisionShape, const struct FCollisionQueryParams& Params, const struct FCollisionResponseParams& ResponseParam, TArray<bool>& OutBlockingHits) const;
+
+	/**
+	 *  Sweep a batch of identical shapes sharing the same channel and params against the world, and return the first blocking hit of each one.
+	 *  Filter data and geometry are set up once for the whole batch and large batches are split across task graph threads.
+	 *  @param  Starts          Start location of each sweep
+	 *  @param  Ends            End location of each sweep, must have as many elements as Starts
+	 *  @param  Rot             Rotation of the shape for every sweep
+	 *  @param  TraceChannel    The 'channel' that the sweeps are in, used to determine which components to hit
+	 *  @param	CollisionShape	CollisionShape - supports Box, Sphere, Capsule
+	 *  @param  Params          Additional parameters used for every sweep
+	 * 	@param 	ResponseParam	ResponseContainer to be used for every sweep
+	 *  @param  OutHits         Resized to the number of sweeps, element i is the first blocking hit of sweep i (bBlockingHit is false if there is none)
+	 *  @return Number of sweeps that hit something blocking
+	 */
+	int32 BatchSweepSingle(const TArray<FVector>& Starts, const TArray<FVector>& Ends, const FQuat& Rot, ECollisionChannel TraceChannel, const struct FCollisionShape& CollisionShape, const struct FCollisionQueryParams& Params, const struct FCollisionResponseParams& ResponseParam, TArray<struct FHitResult>& OutHits) const;
+
 	/**
 	 *  Test the collision of an AABB at the supplied location using a specific channel, and return if any blocking overlap is found
 	 *  @param  Pos             Location of center of box to test against the world
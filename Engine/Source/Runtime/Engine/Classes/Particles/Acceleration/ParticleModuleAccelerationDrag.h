@@ -30,6 +30,8 @@ class UParticleModuleAccelerationDrag : public UParticleModuleAccelerationBase
 	//Begin UParticleModule Interface
 	virtual void CompileModule( struct FParticleEmitterBuildInfo& EmitterInfo ) override;
 	virtual void Update( FParticleEmitterInstance* Owner, int32 Offset, float DeltaTime ) override;
+	virtual bool CanUpdateStreams(FParticleEmitterInstance* Owner) override;
+	virtual void UpdateStreams(FParticleEmitterInstance* Owner, FParticleStreams& Streams, float DeltaTime) override;
 	//End UParticleModule Interface
 
 #if WITH_EDITOR
@@ -37,6 +37,8 @@ class UParticleModuleColorOverLife : public UParticleModuleColorBase
 	virtual	bool AddModuleCurvesToEditor(UInterpCurveEdSetup* EdSetup, TArray<const FCurveEdEntry*>& OutCurveEntries) override;
 	virtual void Spawn(FParticleEmitterInstance* Owner, int32 Offset, float SpawnTime, FBaseParticle* ParticleBase) override;
 	virtual void Update(FParticleEmitterInstance* Owner, int32 Offset, float DeltaTime) override;
+	virtual bool CanUpdateStreams(FParticleEmitterInstance* Owner) override;
+	virtual void UpdateStreams(FParticleEmitterInstance* Owner, FParticleStreams& Streams, float DeltaTime) override;
 	virtual void CompileModule( struct FParticleEmitterBuildInfo& EmitterInfo ) override;
 	virtual void SetToSensibleDefaults(UParticleEmitter* Owner) override;
 	//End UParticleModule Interface
@@ -237,6 +237,22 @@ class UParticleModule : public UObject
 	 *	@param	DeltaTime	The time since the last update.
 	 */
 	virtual void	Update(FParticleEmitterInstance* Owner, int32 Offset, float DeltaTime);
+	/**
+	 *	Whether UpdateStreams can be called instead of Update for the given emitter instance.
+	 *	Only modules that don't use a particle payload and only touch the members in FParticleStreams can support it.
+	 *
+	 *	@param	Owner		The FParticleEmitterInstance that 'owns' the particles.
+	 */
+	virtual bool	CanUpdateStreams(FParticleEmitterInstance* Owner) { return false; }
+	/**
+	 *	Same as Update, working on the structure of arrays copy of the active particles.
+	 *	Only called when CanUpdateStreams returned true.
+	 *
+	 *	@param	Owner		The FParticleEmitterInstance that 'owns' the particles.
+	 *	@param	Streams		The active particles of Owner.
+	 *	@param	DeltaTime	The time since the last update.
+	 */
+	virtual void	UpdateStreams(FParticleEmitterInstance* Owner, FParticleStreams& Streams, float DeltaTime) {}
 	/**
 	 *	Called on an emitter when all other update operations have taken place
 	 *	INCLUDING bounding box cacluations!
@@ -65,15 +65,17 @@ FAsyncPathFindingQuery::FAsyncPathFindingQuery(const UObject* InOwner, const ANa
 : FPathFindingQuery(InOwner, InNavData, Start, End, SourceQueryFilter)
 , QueryID(GetUniqueID())
 , OnDoneDelegate(Delegate)
+, Priority(0)
 {
 
 }
 
-FAsyncPathFindingQuery::FAsyncPathFindingQuery(const FPathFindingQuery& Query, const FNavPathQueryDelegate& Delegate, const EPathFindingMode::Type QueryMode)
+FAsyncPathFindingQuery::FAsyncPathFindingQuery(const FPathFindingQuery& Query, const FNavPathQueryDelegate& Delegate, const EPathFindingMode::Type QueryMode, const uint8 QueryPriority)
 : FPathFindingQuery(Query)
 , QueryID(GetUniqueID())
 , OnDoneDelegate(Delegate)
 , Mode(QueryMode)
+, Priority(QueryPriority)
 {
 
 }
@@ -46,6 +46,25 @@ DECLARE_CYCLE_STAT(TEXT("Nav Tick: mark dirty"), STAT_Navigation_TickMarkDirty,
 DECLARE_CYCLE_STAT(TEXT("Nav Tick: async build"), STAT_Navigation_TickAsyncBuild, STATGROUP_Navigation);
 DECLARE_CYCLE_STAT(TEXT("Nav Tick: async pathfinding"), STAT_Navigation_TickAsyncPathfinding, STATGROUP_Navigation);
 DECLARE_CYCLE_STAT(TEXT("Debug NavOctree Time"), STAT_DebugNavOctree, STATGROUP_Navigation);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Async path queries started"), STAT_Navigation_AsyncPathQueriesStarted, STATGROUP_Navigation);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Async path queries postponed"), STAT_Navigation_AsyncPathQueriesPostponed, STATGROUP_Navigation);
+
+static TAutoConsoleVariable<int32> CVarParallelAsyncPathfinding(
+	TEXT("ai.nav.ParallelAsyncPathfinding"),
+	1,
+	TEXT("If 1, async pathfinding requests gathered in a frame are split between task graph worker threads.\n")
+	TEXT("If 0, they are all processed by a single task."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarMaxAsyncPathQueriesPerFrame(
+	TEXT("ai.nav.MaxAsyncPathQueriesPerFrame"),
+	0,
+	TEXT("Maximum number of async pathfinding requests started every frame, highest priority first. The rest waits for the next frames.\n")
+	TEXT("0 means no limit."),
+	ECVF_Default);
+
+/** Smallest number of async pathfinding requests worth spawning a separate task for */
+static const int32 AsyncQueriesPerTask = 8;
 
 //----------------------------------------------------------------------//
 // Stats
@@ -681,8 +700,19 @@ void UNavigationSystem::Tick(float DeltaSeconds)
 	if (AsyncPathFindingQueries.Num() > 0)
 	{
 		SCOPE_CYCLE_COUNTER(STAT_Navigation_TickAsyncPathfinding);
-		TriggerAsyncQueries(AsyncPathFindingQueries);
-		AsyncPathFindingQueries.Reset();
+		const int32 MaxQueries = CVarMaxAsyncPathQueriesPerFrame.GetValueOnGameThread();
+		if (MaxQueries > 0 && AsyncPathFindingQueries.Num() > MaxQueries)
+		{
+			TArray<FAsyncPathFindingQuery> QueriesToRun;
+			PopAsyncQueries(QueriesToRun, MaxQueries);
+			TriggerAsyncQueries(QueriesToRun);
+		}
+		else
+		{
+			TriggerAsyncQueries(AsyncPathFindingQueries);
+			AsyncPathFindingQueries.Reset();
+		}
+		SET_DWORD_STAT(STAT_Navigation_AsyncPathQueriesPostponed, AsyncPathFindingQueries.Num());
 	}
 
 	if (CrowdManager.IsValid())
@@ -812,7 +842,7 @@ void UNavigationSystem::AddAsyncQuery(const FAsyncPathFindingQuery& Query)
 	AsyncPathFindingQueries.Add(Query);
 }
 
-uint32 UNavigationSystem::FindPathAsync(const FNavAgentProperties& AgentProperties, FPathFindingQuery Query, const FNavPathQueryDelegate& ResultDelegate, EPathFindingMode::Type Mode)
+uint32 UNavigationSystem::FindPathAsync(const FNavAgentProperties& AgentProperties, FPathFindingQuery Query, const FNavPathQueryDelegate& ResultDelegate, EPathFindingMode::Type Mode, uint8 Priority)
 {
 	SCOPE_CYCLE_COUNTER(STAT_Navigation_RequestingAsyncPathfinding);
 
@@ -823,7 +853,7 @@ uint32 UNavigationSystem::FindPathAsync(const FNavAgentProperties& AgentProperti
 
 	if (Query.NavData.IsValid())
 	{
-		FAsyncPathFindingQuery AsyncQuery(Query, ResultDelegate, Mode);
+		FAsyncPathFindingQuery AsyncQuery(Query, ResultDelegate, Mode, Priority);
 
 		if (AsyncQuery.QueryID != INVALID_NAVQUERYID)
 		{
@@ -850,15 +880,79 @@ void UNavigationSystem::AbortAsyncFindPathRequest(uint32 AsynPathQueryID)
 	}
 }
 
+void UNavigationSystem::PopAsyncQueries(TArray<FAsyncPathFindingQuery>& OutQueries, int32 MaxQueries)
+{
+	check(IsInGameThread());
+
+	const int32 NumQueries = AsyncPathFindingQueries.Num();
+	const int32 NumToPop = FMath::Min(MaxQueries, NumQueries);
+
+	// stable sort keeps requests of the same priority in the order they were made
+	TArray<int32> QueryOrder;
+	QueryOrder.AddUninitialized(NumQueries);
+	for (int32 Index = 0; Index < NumQueries; ++Index)
+	{
+		QueryOrder[Index] = Index;
+	}
+	const TArray<FAsyncPathFindingQuery>& Queries = AsyncPathFindingQueries;
+	QueryOrder.StableSort([&Queries](int32 A, int32 B) { return Queries[A].Priority > Queries[B].Priority; });
+
+	TBitArray<> PoppedQueries(false, NumQueries);
+	OutQueries.Reserve(OutQueries.Num() + NumToPop);
+	for (int32 OrderIndex = 0; OrderIndex < NumToPop; ++OrderIndex)
+	{
+		const int32 QueryIndex = QueryOrder[OrderIndex];
+		OutQueries.Add(AsyncPathFindingQueries[QueryIndex]);
+		PoppedQueries[QueryIndex] = true;
+	}
+
+	// FAsyncPathFindingQuery can't be assigned to, so the remaining queue gets rebuilt
+	TArray<FAsyncPathFindingQuery> RemainingQueries;
+	RemainingQueries.Reserve(FMath::Max(NumQueries - NumToPop, (int32)INITIAL_ASYNC_QUERIES_SIZE));
+	for (int32 Index = 0; Index < NumQueries; ++Index)
+	{
+		if (!PoppedQueries[Index])
+		{
+			RemainingQueries.Add(AsyncPathFindingQueries[Index]);
+		}
+	}
+	Exchange(AsyncPathFindingQueries, RemainingQueries);
+}
+
 void UNavigationSystem::TriggerAsyncQueries(TArray<FAsyncPathFindingQuery>& PathFindingQueries)
 {
 	DECLARE_CYCLE_STAT(TEXT("FSimpleDelegateGraphTask.NavigationSystem batched async queries"),
 		STAT_FSimpleDelegateGraphTask_NavigationSystemBatchedAsyncQueries,
 		STATGROUP_TaskGraphTasks);
 
-	FSimpleDelegateGraphTask::CreateAndDispatchWhenReady(
-		FSimpleDelegateGraphTask::FDelegate::CreateUObject(this, &UNavigationSystem::PerformAsyncQueries, PathFindingQueries),
-		GET_STATID(STAT_FSimpleDelegateGraphTask_NavigationSystemBatchedAsyncQueries));
+	const int32 NumQueries = PathFindingQueries.Num();
+	INC_DWORD_STAT_BY(STAT_Navigation_AsyncPathQueriesStarted, NumQueries);
+
+	int32 NumTasks = 1;
+	if (CVarParallelAsyncPathfinding.GetValueOnGameThread() != 0 && FApp::ShouldUseThreadingForPerformance())
+	{
+		NumTasks = FMath::Clamp(FMath::DivideAndRoundUp(NumQueries, AsyncQueriesPerTask), 1, FTaskGraphInterface::Get().GetNumWorkerThreads());
+	}
+
+	if (NumTasks <= 1)
+	{
+		FSimpleDelegateGraphTask::CreateAndDispatchWhenReady(
+			FSimpleDelegateGraphTask::FDelegate::CreateUObject(this, &UNavigationSystem::PerformAsyncQueries, PathFindingQueries),
+			GET_STATID(STAT_FSimpleDelegateGraphTask_NavigationSystemBatchedAsyncQueries));
+		return;
+	}
+
+	// navmeshes keep a separate search state for every worker thread, so slices can run side by side
+	const int32 QueriesPerTask = FMath::DivideAndRoundUp(NumQueries, NumTasks);
+	for (int32 FirstQuery = 0; FirstQuery < NumQueries; FirstQuery += QueriesPerTask)
+	{
+		TArray<FAsyncPathFindingQuery> TaskQueries;
+		TaskQueries.Append(PathFindingQueries.GetData() + FirstQuery, FMath::Min(QueriesPerTask, NumQueries - FirstQuery));
+
+		FSimpleDelegateGraphTask::CreateAndDispatchWhenReady(
+			FSimpleDelegateGraphTask::FDelegate::CreateUObject(this, &UNavigationSystem::PerformAsyncQueries, TaskQueries),
+			GET_STATID(STAT_FSimpleDelegateGraphTask_NavigationSystemBatchedAsyncQueries));
+	}
 }
 
 static void AsyncQueryDone(FAsyncPathFindingQuery Query)
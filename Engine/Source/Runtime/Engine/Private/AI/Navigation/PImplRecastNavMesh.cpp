@@ -34,15 +34,21 @@ static_assert(RECAST_UNWALKABLE_POLY_COST == DT_UNWALKABLE_POLY_COST, "Unwalkabl
 
 /// Helper for accessing navigation query from different threads
 #define INITIALIZE_NAVQUERY_SIMPLE(NavQueryVariable, NumNodes)	\
-	dtNavMeshQuery NavQueryVariable##Private;	\
-	dtNavMeshQuery& NavQueryVariable = IsInGameThread() ? SharedNavQuery : NavQueryVariable##Private; \
+	dtNavMeshQuery& NavQueryVariable = IsInGameThread() ? SharedNavQuery : FRecastNavQueryThreadCache::Get().NavQuery; \
 	NavQueryVariable.init(DetourNavMesh, NumNodes);
 
 #define INITIALIZE_NAVQUERY(NavQueryVariable, NumNodes, LinkFilter)	\
-	dtNavMeshQuery NavQueryVariable##Private;	\
-	dtNavMeshQuery& NavQueryVariable = IsInGameThread() ? SharedNavQuery : NavQueryVariable##Private; \
+	dtNavMeshQuery& NavQueryVariable = IsInGameThread() ? SharedNavQuery : FRecastNavQueryThreadCache::Get().NavQuery; \
 	NavQueryVariable.init(DetourNavMesh, NumNodes, &LinkFilter);
 
+DECLARE_DWORD_COUNTER_STAT(TEXT("Path cache hits"), STAT_Navigation_PathCacheHits, STATGROUP_Navigation);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Path cache misses"), STAT_Navigation_PathCacheMisses, STATGROUP_Navigation);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Path cache invalidated corridors"), STAT_Navigation_PathCacheInvalidated, STATGROUP_Navigation);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Path cache corridors"), STAT_Navigation_PathCacheSize, STATGROUP_Navigation);
+
+/** Cached corridors are all dropped when there's more of them than this */
+static const int32 MaxCachedPathCorridors = 4096;
+
 static void* DetourMalloc(int Size, dtAllocHint)
 {
 	void* Result = FMemory::Malloc(uint32(Size));
@@ -244,6 +250,9 @@ FPImplRecastNavMesh::FPImplRecastNavMesh(ARecastNavMesh* Owner)
 
 	INC_DWORD_STAT_BY( STAT_NavigationMemory
 		, Owner->HasAnyFlags(RF_ClassDefaultObject) == false ? sizeof(*this) : 0 );
+
+	// thread singletons need their first access on game thread
+	FRecastNavQueryThreadCache::Get();
 };
 
 FPImplRecastNavMesh::~FPImplRecastNavMesh()
@@ -261,6 +270,8 @@ void FPImplRecastNavMesh::ReleaseDetourNavMesh()
 		dtFreeNavMesh(DetourNavMesh);
 	}
 	DetourNavMesh = nullptr;
+
+	ClearCachedPaths();
 }
 
 /**
@@ -764,6 +775,16 @@ ENavigationQueryResult::Type FPImplRecastNavMesh::FindPath(const FVector& StartL
 	// initialize output
 	Path.Reset();
 
+	const bool bUsePathCache = NavMeshOwner->bCachePathCorridors && StartPolyID != EndPolyID;
+	const FRecastPathCacheKey CacheKey(StartPolyID, EndPolyID, *FilterImplementation, InQueryFilter.GetMaxSearchNodes());
+	if (bUsePathCache && FindCachedPathCorridor(CacheKey, *FilterImplementation, &Path))
+	{
+		PostProcessPathCorridor(DT_SUCCESS, Path, NavQuery, StartPolyID, EndPolyID, StartLoc, EndLoc, RecastEndPos);
+		Path.MarkReady();
+
+		return ENavigationQueryResult::Success;
+	}
+
 	// get path corridor
 	dtQueryResult PathResult;
 	const dtStatus FindPathStatus = NavQuery.findPath(StartPolyID, EndPolyID, &RecastStartPos.X, &RecastEndPos.X, QueryFilter, PathResult, 0);
@@ -788,6 +809,11 @@ ENavigationQueryResult::Type FPImplRecastNavMesh::FindPath(const FVector& StartL
 		PostProcessPath(FindPathStatus, Path, NavQuery, QueryFilter,
 			StartPolyID, EndPolyID, StartLoc, EndLoc, RecastStartPos, RecastEndPos,
 			PathResult);
+
+		if (bUsePathCache && dtStatusSucceed(FindPathStatus) && !dtStatusDetail(FindPathStatus, DT_PARTIAL_RESULT))
+		{
+			AddCachedPathCorridor(CacheKey, *FilterImplementation, Path);
+		}
 	}
 
 	if (dtStatusDetail(FindPathStatus, DT_PARTIAL_RESULT))
@@ -805,7 +831,8 @@ ENavigationQueryResult::Type FPImplRecastNavMesh::FindPath(const FVector& StartL
 
 ENavigationQueryResult::Type FPImplRecastNavMesh::TestPath(const FVector& StartLoc, const FVector& EndLoc, const FNavigationQueryFilter& InQueryFilter, const UObject* Owner, int32* NumVisitedNodes) const
 {
-	const dtQueryFilter* QueryFilter = ((const FRecastQueryFilter*)(InQueryFilter.GetImplementation()))->GetAsDetourQueryFilter();
+	const FRecastQueryFilter* FilterImplementation = (const FRecastQueryFilter*)(InQueryFilter.GetImplementation());
+	const dtQueryFilter* QueryFilter = FilterImplementation->GetAsDetourQueryFilter();
 	if (QueryFilter == NULL)
 	{
 		UE_VLOG(NavMeshOwner, LogNavigation, Warning, TEXT("FPImplRecastNavMesh::FindPath failing due to QueryFilter == NULL"));
@@ -823,6 +850,17 @@ ENavigationQueryResult::Type FPImplRecastNavMesh::TestPath(const FVector& StartL
 		return ENavigationQueryResult::Error;
 	}
 
+	// any complete corridor cached between the same polys proves the path exists
+	if (NavMeshOwner->bCachePathCorridors && StartPolyID != EndPolyID
+		&& FindCachedPathCorridor(FRecastPathCacheKey(StartPolyID, EndPolyID, *FilterImplementation, InQueryFilter.GetMaxSearchNodes()), *FilterImplementation, NULL))
+	{
+		if (NumVisitedNodes)
+		{
+			*NumVisitedNodes = 0;
+		}
+		return ENavigationQueryResult::Success;
+	}
+
 	// get path corridor
 	dtQueryResult PathResult;
 	const dtStatus FindPathStatus = NavQuery.findPath(StartPolyID, EndPolyID,
@@ -939,63 +977,172 @@ void FPImplRecastNavMesh::PostProcessPath(dtStatus FindPathStatus, FNavMeshPath&
 			*DestCorridorPoly = PathResult.getRef(i);
 		}
 
-		Path.OnPathCorridorUpdated(); 
+		PostProcessPathCorridor(FindPathStatus, Path, NavQuery, StartPolyID, EndPolyID, StartLoc, EndLoc, RecastEndPos);
+	}
+}
+
+void FPImplRecastNavMesh::PostProcessPathCorridor(dtStatus FindPathStatus, FNavMeshPath& Path,
+	const dtNavMeshQuery& NavQuery, NavNodeRef StartPolyID, NavNodeRef EndPolyID,
+	const FVector& StartLoc, const FVector& EndLoc, FVector& RecastEndPos) const
+{
+	Path.OnPathCorridorUpdated(); 
 
 #if STATS
-		if (dtStatusDetail(FindPathStatus, DT_OUT_OF_NODES))
-		{
-			INC_DWORD_STAT(STAT_Navigation_OutOfNodesPath);
-		}
+	if (dtStatusDetail(FindPathStatus, DT_OUT_OF_NODES))
+	{
+		INC_DWORD_STAT(STAT_Navigation_OutOfNodesPath);
+	}
 
+	if (dtStatusDetail(FindPathStatus, DT_PARTIAL_RESULT))
+	{
+		INC_DWORD_STAT(STAT_Navigation_PartialPath);
+	}
+#endif
+
+	if (Path.WantsStringPulling())
+	{
+		FVector UseEndLoc = EndLoc;
+		
+		// if path is partial (path corridor doesn't contain EndPolyID), find new RecastEndPos on last poly in corridor
 		if (dtStatusDetail(FindPathStatus, DT_PARTIAL_RESULT))
 		{
-			INC_DWORD_STAT(STAT_Navigation_PartialPath);
+			NavNodeRef LastPolyID = Path.PathCorridor.Last();
+			float NewEndPoint[3];
+
+			const dtStatus NewEndPointStatus = NavQuery.closestPointOnPoly(LastPolyID, &RecastEndPos.X, NewEndPoint);
+			if (dtStatusSucceed(NewEndPointStatus))
+			{
+				UseEndLoc = Recast2UnrealPoint(NewEndPoint);
+			}
 		}
-#endif
 
-		if (Path.WantsStringPulling())
+		Path.PerformStringPulling(StartLoc, UseEndLoc);
+	}
+	else
+	{
+		// make sure at least beginning and end of path are added
+		new(Path.GetPathPoints()) FNavPathPoint(StartLoc, StartPolyID);
+		new(Path.GetPathPoints()) FNavPathPoint(EndLoc, EndPolyID);
+
+		// collect all custom links Ids
+		for (int32 Idx = 0; Idx < Path.PathCorridor.Num(); Idx++)
 		{
-			FVector UseEndLoc = EndLoc;
-			
-			// if path is partial (path corridor doesn't contain EndPolyID), find new RecastEndPos on last poly in corridor
-			if (dtStatusDetail(FindPathStatus, DT_PARTIAL_RESULT))
+			const dtOffMeshConnection* OffMeshCon = DetourNavMesh->getOffMeshConnectionByRef(Path.PathCorridor[Idx]);
+			if (OffMeshCon)
 			{
-				NavNodeRef LastPolyID = Path.PathCorridor.Last();
-				float NewEndPoint[3];
-
-				const dtStatus NewEndPointStatus = NavQuery.closestPointOnPoly(LastPolyID, &RecastEndPos.X, NewEndPoint);
-				if (dtStatusSucceed(NewEndPointStatus))
-				{
-					UseEndLoc = Recast2UnrealPoint(NewEndPoint);
-				}
+				Path.CustomLinkIds.Add(OffMeshCon->userId);
 			}
-
-			Path.PerformStringPulling(StartLoc, UseEndLoc);
 		}
-		else
+	}
+
+	if (Path.WantsPathCorridor())
+	{
+		TArray<FNavigationPortalEdge> PathCorridorEdges;
+		GetEdgesForPathCorridorImpl(&Path.PathCorridor, &PathCorridorEdges, NavQuery);
+		Path.SetPathCorridorEdges(PathCorridorEdges);
+	}
+}
+
+bool FPImplRecastNavMesh::FindCachedPathCorridor(const FRecastPathCacheKey& Key, const FRecastQueryFilter& Filter, FNavMeshPath* Path) const
+{
+	FScopeLock CacheLock(&CachedPathsLock);
+
+	const FRecastCachedPathCorridor* CachedPath = CachedPaths.Find(Key);
+	if (CachedPath == NULL || FMemory::Memcmp(&CachedPath->FilterData, &Filter.GetFilterData(), sizeof(dtQueryFilterData)) != 0)
+	{
+		INC_DWORD_STAT(STAT_Navigation_PathCacheMisses);
+		return false;
+	}
+
+	INC_DWORD_STAT(STAT_Navigation_PathCacheHits);
+	if (Path)
+	{
+		Path->PathCorridor = CachedPath->PathCorridor;
+		Path->PathCorridorCost = CachedPath->PathCorridorCost;
+	}
+	return true;
+}
+
+void FPImplRecastNavMesh::AddCachedPathCorridor(const FRecastPathCacheKey& Key, const FRecastQueryFilter& Filter, const FNavMeshPath& Path) const
+{
+	// custom links can be allowed for some querier only, so corridors using them can't be shared
+	for (int32 Idx = 0; Idx < Path.PathCorridor.Num(); Idx++)
+	{
+		const dtOffMeshConnection* OffMeshCon = DetourNavMesh->getOffMeshConnectionByRef(Path.PathCorridor[Idx]);
+		if (OffMeshCon && OffMeshCon->userId != 0)
 		{
-			// make sure at least beginning and end of path are added
-			new(Path.GetPathPoints()) FNavPathPoint(StartLoc, StartPolyID);
-			new(Path.GetPathPoints()) FNavPathPoint(EndLoc, EndPolyID);
+			return;
+		}
+	}
 
-			// collect all custom links Ids
-			for (int32 Idx = 0; Idx < Path.PathCorridor.Num(); Idx++)
-			{
-				const dtOffMeshConnection* OffMeshCon = DetourNavMesh->getOffMeshConnectionByRef(Path.PathCorridor[Idx]);
-				if (OffMeshCon)
-				{
-					Path.CustomLinkIds.Add(OffMeshCon->userId);
-				}
-			}
+	FScopeLock CacheLock(&CachedPathsLock);
+
+	if (CachedPaths.Num() >= MaxCachedPathCorridors)
+	{
+		CachedPaths.Empty(MaxCachedPathCorridors);
+		CachedPathsByTile.Empty();
+	}
+	else if (CachedPaths.Contains(Key))
+	{
+		// filled by other thread in the meantime
+		return;
+	}
+
+	FRecastCachedPathCorridor& CachedPath = CachedPaths.Add(Key);
+	CachedPath.FilterData = Filter.GetFilterData();
+	CachedPath.PathCorridor = Path.PathCorridor;
+	CachedPath.PathCorridorCost = Path.PathCorridorCost;
+
+	uint32 LastTileIndex = uint32(INDEX_NONE);
+	for (int32 Idx = 0; Idx < Path.PathCorridor.Num(); Idx++)
+	{
+		const uint32 TileIndex = DetourNavMesh->decodePolyIdTile(Path.PathCorridor[Idx]);
+		if (TileIndex != LastTileIndex)
+		{
+			CachedPathsByTile.AddUnique(TileIndex, Key);
+			LastTileIndex = TileIndex;
 		}
+	}
+
+	SET_DWORD_STAT(STAT_Navigation_PathCacheSize, CachedPaths.Num());
+}
+
+void FPImplRecastNavMesh::InvalidateCachedPaths(const TArray<uint32>& ChangedTiles)
+{
+	FScopeLock CacheLock(&CachedPathsLock);
 
-		if (Path.WantsPathCorridor())
+	if (CachedPaths.Num() == 0)
+	{
+		return;
+	}
+
+	TArray<FRecastPathCacheKey> AffectedKeys;
+	for (int32 Idx = 0; Idx < ChangedTiles.Num(); Idx++)
+	{
+		AffectedKeys.Reset();
+		CachedPathsByTile.MultiFind(ChangedTiles[Idx], AffectedKeys);
+		CachedPathsByTile.Remove(ChangedTiles[Idx]);
+
+		// keys of corridors removed earlier through their other tiles can still be listed here
+		for (int32 KeyIdx = 0; KeyIdx < AffectedKeys.Num(); KeyIdx++)
 		{
-			TArray<FNavigationPortalEdge> PathCorridorEdges;
-			GetEdgesForPathCorridorImpl(&Path.PathCorridor, &PathCorridorEdges, NavQuery);
-			Path.SetPathCorridorEdges(PathCorridorEdges);
+			const int32 NumRemoved = CachedPaths.Remove(AffectedKeys[KeyIdx]);
+			INC_DWORD_STAT_BY(STAT_Navigation_PathCacheInvalidated, NumRemoved);
 		}
 	}
+
+	SET_DWORD_STAT(STAT_Navigation_PathCacheSize, CachedPaths.Num());
+}
+
+void FPImplRecastNavMesh::ClearCachedPaths()
+{
+	FScopeLock CacheLock(&CachedPathsLock);
+
+	INC_DWORD_STAT_BY(STAT_Navigation_PathCacheInvalidated, CachedPaths.Num());
+	CachedPaths.Empty();
+	CachedPathsByTile.Empty();
+
+	SET_DWORD_STAT(STAT_Navigation_PathCacheSize, 0);
 }
 
 bool FPImplRecastNavMesh::FindStraightPath(const FVector& StartLoc, const FVector& EndLoc, const TArray<NavNodeRef>& PathCorridor, TArray<FNavPathPoint>& PathPoints, TArray<uint32>* CustomLinks) const
@@ -26,13 +26,11 @@
 #if WITH_RECAST
 /// Helper for accessing navigation query from different threads
 #define INITIALIZE_NAVQUERY(NavQueryVariable, NumNodes)	\
-	dtNavMeshQuery NavQueryVariable##Private;	\
-	dtNavMeshQuery& NavQueryVariable = IsInGameThread() ? RecastNavMeshImpl->SharedNavQuery : NavQueryVariable##Private; \
+	dtNavMeshQuery& NavQueryVariable = IsInGameThread() ? RecastNavMeshImpl->SharedNavQuery : FRecastNavQueryThreadCache::Get().NavQuery; \
 	NavQueryVariable.init(RecastNavMeshImpl->DetourNavMesh, NumNodes);
 
 #define INITIALIZE_NAVQUERY_WLINKFILTER(NavQueryVariable, NumNodes, LinkFilter)	\
-	dtNavMeshQuery NavQueryVariable##Private;	\
-	dtNavMeshQuery& NavQueryVariable = IsInGameThread() ? RecastNavMeshImpl->SharedNavQuery : NavQueryVariable##Private; \
+	dtNavMeshQuery& NavQueryVariable = IsInGameThread() ? RecastNavMeshImpl->SharedNavQuery : FRecastNavQueryThreadCache::Get().NavQuery; \
 	NavQueryVariable.init(RecastNavMeshImpl->DetourNavMesh, NumNodes, &LinkFilter);
 
 #endif // WITH_RECAST
@@ -212,6 +210,7 @@ ARecastNavMesh::ARecastNavMesh(const FObjectInitializer& ObjectInitializer)
 	, RecastNavMeshImpl(NULL)
 {
 	HeuristicScale = 0.999f;
+	bCachePathCorridors = false;
 	RegionPartitioning = ERecastPartitioning::Watershed;
 	LayerPartitioning = ERecastPartitioning::Watershed;
 	RegionChunkSplits = 2;
@@ -1445,6 +1444,7 @@ void ARecastNavMesh::OnStreamingLevelAdded(ULevel* InLevel)
 			TArray<uint32> AttachedIndices = NavDataChunk->AttachTiles(RecastNavMeshImpl->DetourNavMesh);
 			if (AttachedIndices.Num() > 0)
 			{
+				RecastNavMeshImpl->InvalidateCachedPaths(AttachedIndices);
 				InvalidateAffectedPaths(AttachedIndices);
 				RequestDrawingUpdate();
 			}
@@ -1464,6 +1464,7 @@ void ARecastNavMesh::OnStreamingLevelRemoved(ULevel* InLevel)
 			TArray<uint32> DetachedIndices = NavDataChunk->DetachTiles(RecastNavMeshImpl->DetourNavMesh);
 			if (DetachedIndices.Num() > 0)
 			{
+				RecastNavMeshImpl->InvalidateCachedPaths(DetachedIndices);
 				InvalidateAffectedPaths(DetachedIndices);
 				RequestDrawingUpdate();
 			}
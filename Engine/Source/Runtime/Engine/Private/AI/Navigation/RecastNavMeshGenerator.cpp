@@ -23,6 +23,9 @@
 #include "DetourTileCacheBuilder.h"
 #include "RecastHelpers.h"
 #include "NavigationSystemHelpers.h"
+#if WITH_EDITOR
+#include "DerivedDataCacheInterface.h"
+#endif
 
 #define SEAMLESS_REBUILDING_ENABLED 1
 
@@ -40,6 +43,36 @@
 #define RECAST_STAT(...) 
 #endif
 
+DECLARE_DWORD_COUNTER_STAT(TEXT("Navmesh tiles built"), STAT_Navigation_TilesBuilt, STATGROUP_Navigation);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Navmesh tile builds cancelled"), STAT_Navigation_TileBuildsCancelled, STATGROUP_Navigation);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Navmesh pending tiles"), STAT_Navigation_PendingTiles, STATGROUP_Navigation);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Navmesh tile dirty to ready (ms)"), STAT_Navigation_TileLatency, STATGROUP_Navigation);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Navmesh tile layers DDC hits"), STAT_Navigation_TileLayersDDCHits, STATGROUP_Navigation);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Navmesh tile layers DDC misses"), STAT_Navigation_TileLayersDDCMisses, STATGROUP_Navigation);
+
+static TAutoConsoleVariable<float> CVarTileSetupBudgetMs(
+	TEXT("ai.nav.TileSetupBudgetMs"),
+	2.0f,
+	TEXT("Time in milliseconds the game thread may spend per frame gathering geometry for new navmesh tile tasks.\n")
+	TEXT("At least one tile is always submitted. 0 disables the budget."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarTileLayersDDC(
+	TEXT("ai.nav.TileLayersDDC"),
+	1,
+	TEXT("If 1, editor and cook store rasterized navmesh tile layers in derived data cache, so tiles with unchanged geometry are not rasterized again.\n")
+	TEXT("If 0, tile layers are always rasterized."),
+	ECVF_Default);
+
+/** Bump when format of tile layers stored in DDC or rasterization changes */
+#define RECAST_TILE_LAYERS_DDC_VER TEXT("5B3B2E6C1F2D4F0E9C7A41D2E8A0C6B1")
+
+/** Number of dirty areas kept per tile before they get collapsed into a single box */
+static const int32 MaxDirtyAreasPerTile = 16;
+
+/** In-flight tile tasks for a tile that first became dirty more than this many seconds ago are allowed to finish even if the tile got dirty again, to avoid starving it */
+static const double MaxTileCancelLatency = 0.5;
+
 struct dtTileCacheAlloc;
 
 FORCEINLINE bool DoesBoxContainOrOverlapVector(const FBox& BigBox, const FVector& In)
@@ -54,6 +87,55 @@ FORCEINLINE bool DoesBoxContainBox(const FBox& BigBox, const FBox& SmallBox)
 	return DoesBoxContainOrOverlapVector(BigBox, SmallBox.Min) && DoesBoxContainOrOverlapVector(BigBox, SmallBox.Max);
 }
 
+/** Appends dirty areas to tile's list, skipping boxes already covered and collapsing the list when it grows too long */
+static void AppendTileDirtyAreas(TArray<FBox>& DirtyAreas, const TArray<FBox>& NewAreas)
+{
+	for (const FBox& NewArea : NewAreas)
+	{
+		bool bAlreadyCovered = false;
+		for (const FBox& Area : DirtyAreas)
+		{
+			if (DoesBoxContainBox(Area, NewArea))
+			{
+				bAlreadyCovered = true;
+				break;
+			}
+		}
+
+		if (!bAlreadyCovered)
+		{
+			DirtyAreas.Add(NewArea);
+		}
+	}
+
+	if (DirtyAreas.Num() > MaxDirtyAreasPerTile)
+	{
+		FBox Union(0);
+		for (const FBox& Area : DirtyAreas)
+		{
+			Union += Area;
+		}
+
+		DirtyAreas.Reset();
+		DirtyAreas.Add(Union);
+	}
+}
+
+static void MergeTileDirtyState(FPendingTileElement& Element, bool bRebuildGeometry, const TArray<FBox>& DirtyAreas, double DirtyTime)
+{
+	Element.bRebuildGeometry |= bRebuildGeometry;
+	// Append area bounds to existing list 
+	if (Element.bRebuildGeometry == false)
+	{
+		AppendTileDirtyAreas(Element.DirtyAreas, DirtyAreas);
+	}
+	else
+	{
+		Element.DirtyAreas.Empty();
+	}
+	Element.DirtyTime = FMath::Min(Element.DirtyTime, DirtyTime);
+}
+
 int32 GetTilesCountHelper(const dtNavMesh* DetourMesh)
 {
 	int32 NumTiles = 0;
@@ -1441,6 +1523,7 @@ FRecastTileGenerator::FRecastTileGenerator(const FRecastNavMeshGenerator& Parent
 	TileConfig = ParentGenerator.GetConfig();
 	Version = ParentGenerator.GetVersion();
 	AdditionalCachedData = ParentGenerator.GetAdditionalCachedData();
+	bUseDerivedDataCache = ParentGenerator.ShouldUseDerivedDataCache();
 }
 
 FRecastTileGenerator::~FRecastTileGenerator()
@@ -1518,7 +1601,7 @@ bool FRecastTileGenerator::HasDataToBuild() const
 
 void FRecastTileGenerator::DoWork()
 {
-	bSucceeded = GenerateTile();
+	bSucceeded = !IsCancelled() && GenerateTile();
 }
 
 void FRecastTileGenerator::GatherGeometry(const FRecastNavMeshGenerator& ParentGenerator, bool bGeometryChanged)
@@ -1834,8 +1917,30 @@ bool FRecastTileGenerator::GenerateTile()
 	if (bRegenerateCompressedLayers)
 	{
 		CompressedLayers.Reset();
-		
-		bSuccess = GenerateCompressedLayers(BuildContext);
+
+		bool bLoadedFromCache = false;
+#if WITH_EDITOR
+		// empty tiles are cheap to build, don't bother DDC with them
+		const bool bCacheLayers = bUseDerivedDataCache && RawGeometry.Num() > 0;
+		FString CacheKey;
+		if (bCacheLayers)
+		{
+			CacheKey = GetCompressedLayersCacheKey();
+			bLoadedFromCache = LoadCompressedLayers(CacheKey);
+		}
+#endif // WITH_EDITOR
+
+		if (!bLoadedFromCache)
+		{
+			bSuccess = GenerateCompressedLayers(BuildContext) && !IsCancelled();
+
+#if WITH_EDITOR
+			if (bSuccess && bCacheLayers)
+			{
+				StoreCompressedLayers(CacheKey);
+			}
+#endif // WITH_EDITOR
+		}
 
 		if (bSuccess)
 		{
@@ -2162,6 +2267,110 @@ bool FRecastTileGenerator::GenerateCompressedLayers(FNavMeshBuildContext& BuildC
 	return true;
 }
 
+#if WITH_EDITOR
+FString FRecastTileGenerator::GetCompressedLayersCacheKey() const
+{
+	FSHA1 HashState;
+	// build config is zeroed on reset, so it can be hashed as a whole
+	HashState.Update((const uint8*)&TileConfig, sizeof(TileConfig));
+	HashState.Update((const uint8*)&TileX, sizeof(TileX));
+	HashState.Update((const uint8*)&TileY, sizeof(TileY));
+
+	// inclusion bounds are used only by voxel filtering
+	const bool bFilterVoxels = TileConfig.bPerformVoxelFiltering && !bFullyEncapsulatedByInclusionBounds;
+	HashState.Update((const uint8*)&bFilterVoxels, sizeof(bFilterVoxels));
+	if (bFilterVoxels)
+	{
+		for (const FBox& Bounds : InclusionBounds)
+		{
+			HashState.Update((const uint8*)&Bounds.Min, sizeof(FVector));
+			HashState.Update((const uint8*)&Bounds.Max, sizeof(FVector));
+		}
+	}
+
+	for (const FRecastRawGeometryElement& Element : RawGeometry)
+	{
+		HashState.Update((const uint8*)Element.GeomCoords.GetData(), Element.GeomCoords.Num() * Element.GeomCoords.GetTypeSize());
+		HashState.Update((const uint8*)Element.GeomIndices.GetData(), Element.GeomIndices.Num() * Element.GeomIndices.GetTypeSize());
+		for (const FTransform& InstanceTransform : Element.PerInstanceTransform)
+		{
+			const FMatrix InstanceMatrix = InstanceTransform.ToMatrixWithScale();
+			HashState.Update((const uint8*)&InstanceMatrix.M[0][0], sizeof(InstanceMatrix.M));
+		}
+	}
+
+	HashState.Final();
+	uint8 Hash[20];
+	HashState.GetHash(Hash);
+
+	return FDerivedDataCacheInterface::BuildCacheKey(TEXT("RECASTTILELAYERS"), RECAST_TILE_LAYERS_DDC_VER, *BytesToHex(Hash, sizeof(Hash)));
+}
+
+bool FRecastTileGenerator::LoadCompressedLayers(const FString& CacheKey)
+{
+	TArray<uint8> CachedData;
+	if (!GetDerivedDataCacheRef().GetSynchronous(*CacheKey, CachedData))
+	{
+		INC_DWORD_STAT(STAT_Navigation_TileLayersDDCMisses);
+		return false;
+	}
+
+	FMemoryReader Ar(CachedData);
+	int32 NumLayers = 0;
+	Ar << NumLayers;
+	CompressedLayers.Reserve(NumLayers);
+
+	for (int32 LayerIdx = 0; LayerIdx < NumLayers && !Ar.IsError(); LayerIdx++)
+	{
+		int32 LayerIndex = 0;
+		FBox LayerBBox(0);
+		int32 DataSize = 0;
+		Ar << LayerIndex << LayerBBox << DataSize;
+
+		if (DataSize <= 0 || DataSize > Ar.TotalSize() - Ar.Tell())
+		{
+			Ar.SetError();
+			break;
+		}
+
+		uint8* LayerData = (uint8*)dtAlloc(DataSize * sizeof(uint8), DT_ALLOC_PERM);
+		Ar.Serialize(LayerData, DataSize);
+		CompressedLayers.Add(FNavMeshTileData(LayerData, DataSize, LayerIndex, LayerBBox));
+	}
+
+	if (Ar.IsError())
+	{
+		UE_LOG(LogNavigation, Warning, TEXT("Discarding corrupted navmesh tile layers (%d,%d) read from DDC"), TileX, TileY);
+		CompressedLayers.Reset();
+		INC_DWORD_STAT(STAT_Navigation_TileLayersDDCMisses);
+		return false;
+	}
+
+	INC_DWORD_STAT(STAT_Navigation_TileLayersDDCHits);
+	return true;
+}
+
+void FRecastTileGenerator::StoreCompressedLayers(const FString& CacheKey) const
+{
+	TArray<uint8> CachedData;
+	FMemoryWriter Ar(CachedData);
+
+	int32 NumLayers = CompressedLayers.Num();
+	Ar << NumLayers;
+
+	for (const FNavMeshTileData& Layer : CompressedLayers)
+	{
+		int32 LayerIndex = Layer.LayerIndex;
+		FBox LayerBBox = Layer.LayerBBox;
+		int32 DataSize = Layer.DataSize;
+		Ar << LayerIndex << LayerBBox << DataSize;
+		Ar.Serialize((void*)Layer.GetData(), DataSize);
+	}
+
+	GetDerivedDataCacheRef().Put(*CacheKey, CachedData);
+}
+#endif // WITH_EDITOR
+
 struct FTileGenerationContext
 {
 	FTileGenerationContext(dtTileCacheAlloc* MyAllocator) :
@@ -2221,6 +2430,11 @@ bool FRecastTileGenerator::GenerateNavigationData(FNavMeshBuildContext& BuildCon
 			// skip layers not marked for rebuild
 			continue;
 		}
+
+		if (IsCancelled())
+		{
+			return false;
+		}
 				
 		FNavMeshTileData& CompressedData = CompressedLayers[iLayer];
 		const dtTileCacheLayerHeader* TileHeader = (const dtTileCacheLayerHeader*)CompressedData.GetData();
@@ -2676,6 +2890,7 @@ FRecastNavMeshGenerator::FRecastNavMeshGenerator(ARecastNavMesh& InDestNavMesh)
 	  AvgLayersPerTile(8.0f),
 	  DestNavMesh(&InDestNavMesh),
 	  bInitialized(false),
+	  bUseDerivedDataCache(false),
 	  Version(0)
 {
 	INC_DWORD_STAT_BY(STAT_NavigationMemory, sizeof(*this));
@@ -2790,6 +3005,15 @@ void FRecastNavMeshGenerator::Init()
 	UE_LOG(LogNavigation, Log, TEXT("Using max of %d workers to build navigation."), MaxTileGeneratorTasks);
 	NumActiveTiles = 0;
 
+#if WITH_EDITOR
+	// DDC module has to be loaded on game thread, before any tile generator asks for it
+	bUseDerivedDataCache = GIsEditor && !FPlatformProperties::RequiresCookedData() && CVarTileLayersDDC.GetValueOnGameThread() != 0;
+	if (bUseDerivedDataCache)
+	{
+		GetDerivedDataCacheRef();
+	}
+#endif // WITH_EDITOR
+
 	// prepare voxel cache if needed
 	if (ARecastNavMesh::IsVoxelCacheEnabled())
 	{
@@ -3095,6 +3319,8 @@ TArray<uint32> FRecastNavMeshGenerator::RemoveTileLayers(const int32 TileX, cons
 	// Remove intermediate layers data at this grid location
 	IntermediateLayerDataMap.Remove(FIntPoint(TileX, TileY));
 
+	DestNavMesh->GetRecastNavMeshImpl()->InvalidateCachedPaths(ResultTileIndices);
+
 	return ResultTileIndices;
 }
 
@@ -3172,6 +3398,8 @@ TArray<uint32> FRecastNavMeshGenerator::AddGeneratedTiles(const FRecastTileGener
 				}
 			}
 		}
+
+		DestNavMesh->GetRecastNavMeshImpl()->InvalidateCachedPaths(ResultTileIndices);
 	}
 
 	return ResultTileIndices;
@@ -3251,6 +3479,7 @@ void FRecastNavMeshGenerator::MarkDirtyTiles(const TArray<FNavigationDirtyArea>&
 	const float TileSizeInWorldUnits = Config.tileSize * Config.cs;
 	check(TileSizeInWorldUnits > 0);
 	const FVector NavMeshOrigin = FVector::ZeroVector;
+	const double CurrentTime = FPlatformTime::Seconds();
 	int32 NumTilesMarked = 0;
 
 	// find all tiles that need regeneration
@@ -3310,6 +3539,7 @@ void FRecastNavMeshGenerator::MarkDirtyTiles(const TArray<FNavigationDirtyArea>&
 				FPendingTileElement Element;
 				Element.Coord = FIntPoint(x, y);
 				Element.bRebuildGeometry = DirtyArea.HasFlag(ENavigationDirtyFlag::Geometry) || DirtyArea.HasFlag(ENavigationDirtyFlag::NavigationBounds);
+				Element.DirtyTime = CurrentTime;
 				if (Element.bRebuildGeometry == false)
 				{
 					Element.DirtyAreas.Add(AdjustedAreaBounds);
@@ -3318,16 +3548,7 @@ void FRecastNavMeshGenerator::MarkDirtyTiles(const TArray<FNavigationDirtyArea>&
 				FPendingTileElement* ExistingElement = DirtyTiles.Find(Element);
 				if (ExistingElement)
 				{
-					ExistingElement->bRebuildGeometry|= Element.bRebuildGeometry;
-					// Append area bounds to existing list 
-					if (ExistingElement->bRebuildGeometry == false)
-					{
-						ExistingElement->DirtyAreas.Append(Element.DirtyAreas);
-					}
-					else
-					{
-						ExistingElement->DirtyAreas.Empty();
-					}
+					MergeTileDirtyState(*ExistingElement, Element.bRebuildGeometry, Element.DirtyAreas, Element.DirtyTime);
 				}
 				else
 				{
@@ -3339,22 +3560,33 @@ void FRecastNavMeshGenerator::MarkDirtyTiles(const TArray<FNavigationDirtyArea>&
 	
 	NumTilesMarked = DirtyTiles.Num();
 
+	// Cancel tiles being generated from data that is already stale, the new task will redo their work
+	for (FRunningTileElement& RunningElement : RunningDirtyTiles)
+	{
+		if (RunningElement.bShouldDiscard || !RunningElement.TileGenerator.IsValid() || (CurrentTime - RunningElement.DirtyTime) >= MaxTileCancelLatency)
+		{
+			continue;
+		}
+
+		FPendingTileElement DirtyElement;
+		DirtyElement.Coord = RunningElement.Coord;
+		FPendingTileElement* ExistingElement = DirtyTiles.Find(DirtyElement);
+		if (ExistingElement)
+		{
+			MergeTileDirtyState(*ExistingElement, RunningElement.bRebuildGeometry, RunningElement.DirtyAreas, RunningElement.DirtyTime);
+			RunningElement.bShouldDiscard = true;
+			RunningElement.TileGenerator->Cancel();
+			INC_DWORD_STAT(STAT_Navigation_TileBuildsCancelled);
+		}
+	}
+
 	// Merge all pending tiles into one container
 	for (const FPendingTileElement& Element : PendingDirtyTiles)
 	{
 		FPendingTileElement* ExistingElement = DirtyTiles.Find(Element);
 		if (ExistingElement)
 		{
-			ExistingElement->bRebuildGeometry|= Element.bRebuildGeometry;
-			// Append area bounds to existing list 
-			if (ExistingElement->bRebuildGeometry == false)
-			{
-				ExistingElement->DirtyAreas.Append(Element.DirtyAreas);
-			}
-			else
-			{
-				ExistingElement->DirtyAreas.Empty();
-			}
+			MergeTileDirtyState(*ExistingElement, Element.bRebuildGeometry, Element.DirtyAreas, Element.DirtyTime);
 		}
 		else
 		{
@@ -3374,6 +3606,8 @@ void FRecastNavMeshGenerator::MarkDirtyTiles(const TArray<FNavigationDirtyArea>&
 	{
 		SortPendingBuildTiles();
 	}
+
+	SET_DWORD_STAT(STAT_Navigation_PendingTiles, PendingDirtyTiles.Num());
 }
 
 void FRecastNavMeshGenerator::SortPendingBuildTiles()
@@ -3438,11 +3672,21 @@ TArray<uint32> FRecastNavMeshGenerator::ProcessTileTasks(const int32 NumTasksToS
 	
 	TArray<uint32> UpdatedTiles;
 	const bool bHasTasksAtStart = GetNumRemaningBuildTasks() > 0;
+
+	// Setup gathers tile geometry from navigation octree on game thread, limit time spent on it in game worlds
+	const UWorld* World = GetWorld();
+	const double SetupBudget = (World && World->IsGameWorld()) ? CVarTileSetupBudgetMs.GetValueOnGameThread() / 1000. : 0.;
+	const double SetupStartTime = FPlatformTime::Seconds();
 	
 	int32 NumSubmittedTasks = 0;
 	// Submit pending tile elements
 	for (int32 ElementIdx = PendingDirtyTiles.Num()-1; ElementIdx >= 0 && NumSubmittedTasks < NumTasksToSubmit; ElementIdx--)
 	{
+		if (SetupBudget > 0. && NumSubmittedTasks > 0 && (FPlatformTime::Seconds() - SetupStartTime) > SetupBudget)
+		{
+			break;
+		}
+
 		FPendingTileElement& PendingElement = PendingDirtyTiles[ElementIdx];
 		FRunningTileElement RunningElement(PendingElement.Coord);
 		
@@ -3455,6 +3699,10 @@ TArray<uint32> FRecastNavMeshGenerator::ProcessTileTasks(const int32 NumTasksToS
 			// Start it in background in case it has something to build
 			if (TileTask->GetTask().TileGenerator->HasDataToBuild())
 			{
+				RunningElement.TileGenerator = TileTask->GetTask().TileGenerator;
+				RunningElement.bRebuildGeometry = PendingElement.bRebuildGeometry;
+				RunningElement.DirtyTime = PendingElement.DirtyTime;
+				RunningElement.DirtyAreas = PendingElement.DirtyAreas;
 				RunningElement.AsyncTask = TileTask.Release();
 				RunningElement.AsyncTask->StartBackgroundTask();
 			
@@ -3484,6 +3732,8 @@ TArray<uint32> FRecastNavMeshGenerator::ProcessTileTasks(const int32 NumTasksToS
 	}
 	
 	// Collect completed tasks and apply generated data to navmesh
+	const double CurrentTime = FPlatformTime::Seconds();
+	double MaxTileLatency = 0.;
 	for (int32 Idx = RunningDirtyTiles.Num() - 1; Idx >=0; --Idx)
 	{
 		FRunningTileElement& Element = RunningDirtyTiles[Idx];
@@ -3491,8 +3741,18 @@ TArray<uint32> FRecastNavMeshGenerator::ProcessTileTasks(const int32 NumTasksToS
 
 		if (Element.AsyncTask->IsDone())
 		{
+			if (Element.bShouldDiscard)
+			{
+				// Cancelled task took ownership of cached layers, give them back unless it was regenerating them
+				const FRecastTileGenerator& TileGenerator = *(Element.AsyncTask->GetTask().TileGenerator);
+				TArray<FNavMeshTileData> CompressedLayers = TileGenerator.GetCompressedLayers();
+				if (!TileGenerator.IsFullyRegenerated() && CompressedLayers.Num() && !IntermediateLayerDataMap.Contains(Element.Coord))
+				{
+					IntermediateLayerDataMap.Add(Element.Coord, CompressedLayers);
+				}
+			}
 			// Add generated tiles to navmesh
-			if (!Element.bShouldDiscard)
+			else
 			{
 				const FRecastTileGenerator& TileGenerator = *(Element.AsyncTask->GetTask().TileGenerator);
 				TArray<uint32> UpdatedTileIndices = AddGeneratedTiles(TileGenerator);
@@ -3505,6 +3765,9 @@ TArray<uint32> FRecastNavMeshGenerator::ProcessTileTasks(const int32 NumTasksToS
 				{
 					IntermediateLayerDataMap.Add(Element.Coord, ComressedLayers);
 				}
+
+				INC_DWORD_STAT(STAT_Navigation_TilesBuilt);
+				MaxTileLatency = FMath::Max(MaxTileLatency, CurrentTime - Element.DirtyTime);
 			}
 
 			// Destroy tile generator task
@@ -3515,6 +3778,12 @@ TArray<uint32> FRecastNavMeshGenerator::ProcessTileTasks(const int32 NumTasksToS
 		}
 	}
 
+	if (MaxTileLatency > 0.)
+	{
+		SET_FLOAT_STAT(STAT_Navigation_TileLatency, MaxTileLatency * 1000.);
+	}
+	SET_DWORD_STAT(STAT_Navigation_PendingTiles, PendingDirtyTiles.Num());
+
 	// Notify owner in case all tasks has been completed
 	const bool bHasTasksAtEnd = GetNumRemaningBuildTasks() > 0;
 	if (bHasTasksAtStart && !bHasTasksAtEnd)
@@ -10,6 +10,7 @@
 #include "AnimationUtils.h"
 #include "FloatPacker.h"
 #include "AnimEncoding.h"
+#include "AnimEncoding_InterleavedKeyLerp.h"
 
 DEFINE_LOG_CATEGORY(LogAnimationCompression);
 
@@ -479,6 +480,189 @@ void UAnimCompress::BitwiseCompressAnimationTracks(
 	Seq->ScaleData.Empty();
 }
 
+/** Maps a key of an interleaved frame record back onto a source track that may have been sampled at a different rate */
+static FORCEINLINE int32 GetInterleavedSourceKey(int32 KeyIndex, int32 NumKeys, int32 NumSourceKeys)
+{
+	if (NumSourceKeys == NumKeys)
+	{
+		return KeyIndex;
+	}
+	return FMath::Clamp(FMath::RoundToInt(KeyIndex * float(NumSourceKeys - 1) / float(NumKeys - 1)), 0, NumSourceKeys - 1);
+}
+
+/** Writes a translation or scale track into the interleaved stream and returns its encoded offset */
+static int32 InterleaveVectorTrack(
+	UAnimSequence* Seq,
+	const FInterleavedKeyLerpHeader& Header,
+	const TArray<FVector>& Keys,
+	const FVector& DefaultKey,
+	int32& NextAnimatedOffset,
+	int32& NextConstantOffset)
+{
+	uint8* StreamData = Seq->CompressedByteStream.GetData();
+
+	if (Keys.Num() > 1)
+	{
+		const int32 Offset = NextAnimatedOffset;
+		for (int32 KeyIndex = 0; KeyIndex < Header.NumKeys; ++KeyIndex)
+		{
+			const FVector& Key = Keys[GetInterleavedSourceKey(KeyIndex, Header.NumKeys, Keys.Num())];
+			FMemory::Memcpy(StreamData + Header.FrameDataOffset + KeyIndex * Header.FrameStride + Offset, &Key, sizeof(FVector));
+		}
+		NextAnimatedOffset += sizeof(FVector);
+		return Offset;
+	}
+
+	// A single key gets written out once, as a single uncompressed float[3].
+	const int32 Offset = NextConstantOffset;
+	const FVector& Key = (Keys.Num() == 1) ? Keys[0] : DefaultKey;
+	FMemory::Memcpy(StreamData + Offset, &Key, sizeof(FVector));
+	NextConstantOffset += sizeof(FVector);
+	return InterleavedKeyLerp::EncodeConstantOffset(Offset);
+}
+
+void UAnimCompress::InterleaveAnimationTracks(
+	UAnimSequence* Seq,
+	const TArray<FTranslationTrack>& TranslationData,
+	const TArray<FRotationTrack>& RotationData,
+	const TArray<FScaleTrack>& ScaleData)
+{
+	// These only describe the animated keys, the layout itself is fixed by AKF_InterleavedKeyLerp
+	Seq->TranslationCompressionFormat	= ACF_Float96NoW;
+	Seq->RotationCompressionFormat		= ACF_Fixed48NoW;
+	Seq->ScaleCompressionFormat			= ACF_Float96NoW;
+
+	check( TranslationData.Num() == RotationData.Num() );
+	const int32 NumTracks = RotationData.Num();
+	const bool bHasScale = ScaleData.Num() > 0;
+
+	if ( NumTracks == 0 )
+	{
+		UE_LOG(LogAnimationCompression, Warning, TEXT("When compressing %s: no key-reduced data"), *Seq->GetName() );
+	}
+
+	// Every animated track gets one key in each frame record, everything else is stored once as a constant.
+	FInterleavedKeyLerpHeader Header;
+	FMemory::Memzero( &Header, sizeof(FInterleavedKeyLerpHeader) );
+
+	for ( int32 TrackIndex = 0 ; TrackIndex < NumTracks ; ++TrackIndex )
+	{
+		const int32 NumKeysTrans = TranslationData[TrackIndex].PosKeys.Num();
+		const int32 NumKeysRot = RotationData[TrackIndex].RotKeys.Num();
+		const int32 NumKeysScale = bHasScale ? ScaleData[TrackIndex].ScaleKeys.Num() : 0;
+
+		if ( NumKeysTrans == 0 )
+		{
+			UE_LOG(LogAnimationCompression, Warning, TEXT("When compressing %s track %i: no translation keys"), *Seq->GetName(), TrackIndex );
+		}
+		if ( NumKeysRot == 0 )
+		{
+			UE_LOG(LogAnimationCompression, Warning, TEXT("When compressing %s track %i: no rotation keys"), *Seq->GetName(), TrackIndex );
+		}
+
+		Header.NumKeys = FMath::Max3(Header.NumKeys, NumKeysTrans, FMath::Max(NumKeysRot, NumKeysScale));
+
+		Header.NumAnimatedTranslations += (NumKeysTrans > 1) ? 1 : 0;
+		Header.NumAnimatedRotations += (NumKeysRot > 1) ? 1 : 0;
+		Header.NumAnimatedScales += (NumKeysScale > 1) ? 1 : 0;
+	}
+
+	if ( Header.NumKeys < 2 )
+	{
+		Header.NumKeys = 0;
+	}
+
+	const int32 NumConstantTranslations = NumTracks - Header.NumAnimatedTranslations;
+	const int32 NumConstantRotations = NumTracks - Header.NumAnimatedRotations;
+	const int32 NumConstantScales = bHasScale ? (NumTracks - Header.NumAnimatedScales) : 0;
+
+	const int32 ConstantRotationOffset		= sizeof(FInterleavedKeyLerpHeader);
+	const int32 ConstantTranslationOffset	= ConstantRotationOffset + NumConstantRotations * sizeof(FQuatFloat96NoW);
+	const int32 ConstantScaleOffset			= ConstantTranslationOffset + NumConstantTranslations * sizeof(FVector);
+	Header.FrameDataOffset					= ConstantScaleOffset + NumConstantScales * sizeof(FVector);
+
+	const int32 FrameRotationBytes			= Header.NumAnimatedRotations * sizeof(FQuatFixed48NoW);
+	const int32 FrameTranslationOffset		= Align( FrameRotationBytes, 4 );
+	const int32 FrameScaleOffset			= FrameTranslationOffset + Header.NumAnimatedTranslations * sizeof(FVector);
+	Header.FrameStride						= FrameScaleOffset + Header.NumAnimatedScales * sizeof(FVector);
+
+	checkf( (Header.FrameDataOffset % 4) == 0 && (Header.FrameStride % 4) == 0, TEXT("CompressedByteStream not aligned to four bytes" ) );
+
+	Seq->CompressedTrackOffsets.Empty( NumTracks*2 );
+	Seq->CompressedTrackOffsets.AddUninitialized( NumTracks*2 );
+
+	// just empty it since there is chance this can be 0
+	Seq->CompressedScaleOffsets.Empty();
+	// only do this if Scale exists;
+	if ( bHasScale )
+	{
+		Seq->CompressedScaleOffsets.SetStripSize(1);
+		Seq->CompressedScaleOffsets.AddUninitialized( NumTracks );
+	}
+
+	const int32 StreamSize = Header.FrameDataOffset + Header.NumKeys * Header.FrameStride;
+	Seq->CompressedByteStream.Empty( StreamSize );
+	Seq->CompressedByteStream.AddZeroed( StreamSize );
+	FMemory::Memcpy( Seq->CompressedByteStream.GetData(), &Header, sizeof(FInterleavedKeyLerpHeader) );
+
+	// Align each frame record's translations to four bytes.
+	for ( int32 KeyIndex = 0 ; KeyIndex < Header.NumKeys ; ++KeyIndex )
+	{
+		uint8* FrameData = Seq->CompressedByteStream.GetData() + Header.FrameDataOffset + KeyIndex * Header.FrameStride;
+		FMemory::Memset( FrameData + FrameRotationBytes, AnimationPadSentinel, FrameTranslationOffset - FrameRotationBytes );
+	}
+
+	int32 NextConstantRotation = ConstantRotationOffset;
+	int32 NextConstantTranslation = ConstantTranslationOffset;
+	int32 NextConstantScale = ConstantScaleOffset;
+	int32 NextAnimatedRotation = 0;
+	int32 NextAnimatedTranslation = FrameTranslationOffset;
+	int32 NextAnimatedScale = FrameScaleOffset;
+
+	for ( int32 TrackIndex = 0 ; TrackIndex < NumTracks ; ++TrackIndex )
+	{
+		// Translation data.
+		Seq->CompressedTrackOffsets[TrackIndex*2] = InterleaveVectorTrack( Seq, Header, TranslationData[TrackIndex].PosKeys, FVector::ZeroVector, NextAnimatedTranslation, NextConstantTranslation );
+
+		// Rotation data.
+		const FRotationTrack& SrcRot = RotationData[TrackIndex];
+		const int32 NumKeysRot = SrcRot.RotKeys.Num();
+		if ( NumKeysRot > 1 )
+		{
+			Seq->CompressedTrackOffsets[TrackIndex*2+1] = NextAnimatedRotation;
+			for ( int32 KeyIndex = 0 ; KeyIndex < Header.NumKeys ; ++KeyIndex )
+			{
+				const FQuatFixed48NoW QuatFixed48NoW( SrcRot.RotKeys[GetInterleavedSourceKey(KeyIndex, Header.NumKeys, NumKeysRot)] );
+				FMemory::Memcpy( Seq->CompressedByteStream.GetData() + Header.FrameDataOffset + KeyIndex * Header.FrameStride + NextAnimatedRotation, &QuatFixed48NoW, sizeof(FQuatFixed48NoW) );
+			}
+			NextAnimatedRotation += sizeof(FQuatFixed48NoW);
+		}
+		else
+		{
+			// For a rotation track of n=1 keys, the single key is packed as an FQuatFloat96NoW.
+			const FQuatFloat96NoW QuatFloat96NoW( (NumKeysRot == 1) ? SrcRot.RotKeys[0] : FQuat::Identity );
+			FMemory::Memcpy( Seq->CompressedByteStream.GetData() + NextConstantRotation, &QuatFloat96NoW, sizeof(FQuatFloat96NoW) );
+			Seq->CompressedTrackOffsets[TrackIndex*2+1] = InterleavedKeyLerp::EncodeConstantOffset( NextConstantRotation );
+			NextConstantRotation += sizeof(FQuatFloat96NoW);
+		}
+
+		// Scale data.
+		if ( bHasScale )
+		{
+			Seq->CompressedScaleOffsets.SetOffsetData( TrackIndex, 0, InterleaveVectorTrack( Seq, Header, ScaleData[TrackIndex].ScaleKeys, FVector(1.f), NextAnimatedScale, NextConstantScale ) );
+		}
+	}
+
+	check( NextConstantScale == Header.FrameDataOffset );
+	check( NextAnimatedScale == Header.FrameStride );
+
+	// We may not have used the key data arrays resident in this sequence,
+	// but we should make sure they are empty at this point.
+	Seq->TranslationData.Empty();
+	Seq->RotationData.Empty();
+	Seq->ScaleData.Empty();
+}
+
 /**
  * Tracks
  */
@@ -14,6 +14,7 @@ UAnimCompress_Automatic::UAnimCompress_Automatic(const FObjectInitializer& Objec
 	bTryPerTrackBitwiseCompression = true;
 	bTryLinearKeyRemovalCompression = true;
 	bTryIntervalKeyRemoval = true;
+	bTryInterleavedKeyLerp = false;
 	bRunCurrentDefaultCompressor = false;
 	bAutoReplaceIfExistingErrorTooGreat = false;
 	bRaiseMaxErrorToExisting = false;
@@ -33,7 +34,8 @@ void UAnimCompress_Automatic::DoReduction(UAnimSequence* AnimSeq, const TArray<F
 		bTryFixedBitwiseCompression,
 		bTryPerTrackBitwiseCompression,
 		bTryLinearKeyRemovalCompression,
-		bTryIntervalKeyRemoval);
+		bTryIntervalKeyRemoval,
+		bTryInterleavedKeyLerp);
 	AnimSeq->CompressionScheme = static_cast<UAnimCompress*>( StaticDuplicateObject( AnimSeq->CompressionScheme, AnimSeq, TEXT("None")) );
 #endif // WITH_EDITORONLY_DATA
 }
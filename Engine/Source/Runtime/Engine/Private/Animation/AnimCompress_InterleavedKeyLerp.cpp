@@ -0,0 +1,49 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+	AnimCompress_InterleavedKeyLerp.cpp: Key-frame interleaved animation compression; performs no key reduction.
+=============================================================================*/ 
+
+#include "EnginePrivate.h"
+#include "Animation/AnimCompress_InterleavedKeyLerp.h"
+#include "AnimationUtils.h"
+#include "AnimEncoding.h"
+#include "AnimationCompression.h"
+
+UAnimCompress_InterleavedKeyLerp::UAnimCompress_InterleavedKeyLerp(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	Description = TEXT("Interleaved Key Lerp");
+	TranslationCompressionFormat = ACF_Float96NoW;
+	RotationCompressionFormat = ACF_Fixed48NoW;
+	ScaleCompressionFormat = ACF_Float96NoW;
+}
+
+void UAnimCompress_InterleavedKeyLerp::DoReduction(UAnimSequence* AnimSeq, const TArray<FBoneData>& BoneData)
+{
+#if WITH_EDITORONLY_DATA
+	// split the raw data into tracks
+	TArray<FTranslationTrack> TranslationData;
+	TArray<FRotationTrack> RotationData;
+	TArray<FScaleTrack> ScaleData;
+	SeparateRawDataIntoTracks( AnimSeq->RawAnimationData, AnimSeq->SequenceLength, TranslationData, RotationData, ScaleData );
+
+	// Remove Translation Keys from tracks marked bAnimRotationOnly
+	FilterAnimRotationOnlyKeys(TranslationData, AnimSeq);
+
+	// remove obviously redundant keys from the source data
+	FilterTrivialKeys(TranslationData, RotationData, ScaleData, TRANSLATION_ZEROING_THRESHOLD, QUATERNION_ZEROING_THRESHOLD, SCALE_ZEROING_THRESHOLD);
+
+	// interleave the tracks by key frame into the anim sequence buffers
+	InterleaveAnimationTracks(
+		AnimSeq,
+		TranslationData,
+		RotationData, 
+		ScaleData);
+
+	// record the proper runtime decompressor to use
+	AnimSeq->KeyEncodingFormat = AKF_InterleavedKeyLerp;
+	AnimationFormat_SetInterfaceLinks(*AnimSeq);
+	AnimSeq->CompressionScheme = static_cast<UAnimCompress*>( StaticDuplicateObject( this, AnimSeq, TEXT("None")) );
+#endif // WITH_EDITORONLY_DATA
+}
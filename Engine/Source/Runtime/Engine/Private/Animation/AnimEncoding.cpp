@@ -14,6 +14,7 @@
 #include "AnimEncoding_ConstantKeyLerp.h"
 #include "AnimEncoding_VariableKeyLerp.h"
 #include "AnimEncoding_PerTrackCompression.h"
+#include "AnimEncoding_InterleavedKeyLerp.h"
 
 /** Each CompresedTranslationData track's ByteStream will be byte swapped in chunks of this size. */
 const int32 CompressedTranslationStrides[ACF_MAX] =
@@ -216,6 +217,13 @@ void AnimationFormat_GetAnimationPose(
 	const UAnimSequence& Seq,
 	float Time)
 {
+	// interleaved data solves every component from the same pair of frame records in one pass
+	if (Seq.KeyEncodingFormat == AKF_InterleavedKeyLerp)
+	{
+		AEFInterleavedKeyLerp::GetPose(Atoms, RotationPairs, TranslationPairs, ScalePairs, Seq, Time);
+		return;
+	}
+
 	// decompress the translation component using the proper method
 	checkSlow(Seq.TranslationCodec != NULL);
 	((AnimEncoding*)Seq.TranslationCodec)->GetPoseTranslations(Atoms, TranslationPairs, Seq, Time);
@@ -466,7 +474,65 @@ void AnimationFormat_GetStats(
 		OverheadSize = Seq->CompressedTrackOffsets.Num() * sizeof(int32);
 		const size_t KeyFrameLookupSize = (Seq->NumFrames > 0xFF) ? sizeof(uint16) : sizeof(uint8);
 
-		if (Seq->KeyEncodingFormat != AKF_PerTrackCompression)
+		if (Seq->KeyEncodingFormat == AKF_InterleavedKeyLerp)
+		{
+			// Animated keys live in the frame records, constant keys are stored once at full precision
+			TranslationKeySize = sizeof(FVector);
+			RotationKeySize = sizeof(FQuatFixed48NoW);
+			ScaleKeySize = sizeof(FVector);
+
+			NumTransTracks = Seq->CompressedTrackOffsets.Num() / 2;
+			NumRotTracks = Seq->CompressedTrackOffsets.Num() / 2;
+			NumScaleTracks = Seq->CompressedScaleOffsets.GetNumTracks();
+
+			TotalNumTransKeys = 0;
+			TotalNumRotKeys = 0;
+			TotalNumScaleKeys = 0;
+
+			NumTransTracksWithOneKey = 0;
+			NumRotTracksWithOneKey = 0;
+			NumScaleTracksWithOneKey = 0;
+
+			const int32 NumKeys = (Seq->CompressedByteStream.Num() > 0) ? ((const FInterleavedKeyLerpHeader*)Seq->CompressedByteStream.GetData())->NumKeys : 0;
+			OverheadSize += sizeof(FInterleavedKeyLerpHeader);
+
+			for (int32 TrackIndex = 0; TrackIndex < NumTransTracks; ++TrackIndex)
+			{
+				if (InterleavedKeyLerp::IsConstantOffset(Seq->CompressedTrackOffsets[TrackIndex*2+0]))
+				{
+					++TotalNumTransKeys;
+					++NumTransTracksWithOneKey;
+				}
+				else
+				{
+					TotalNumTransKeys += NumKeys;
+				}
+
+				if (InterleavedKeyLerp::IsConstantOffset(Seq->CompressedTrackOffsets[TrackIndex*2+1]))
+				{
+					++TotalNumRotKeys;
+					++NumRotTracksWithOneKey;
+				}
+				else
+				{
+					TotalNumRotKeys += NumKeys;
+				}
+			}
+
+			for (int32 TrackIndex = 0; TrackIndex < NumScaleTracks; ++TrackIndex)
+			{
+				if (InterleavedKeyLerp::IsConstantOffset(Seq->CompressedScaleOffsets.GetOffsetData(TrackIndex, 0)))
+				{
+					++TotalNumScaleKeys;
+					++NumScaleTracksWithOneKey;
+				}
+				else
+				{
+					TotalNumScaleKeys += NumKeys;
+				}
+			}
+		}
+		else if (Seq->KeyEncodingFormat != AKF_PerTrackCompression)
 		{
 			const int32 TransStride	= GetCompressedTranslationStride(Seq);
 			const int32 RotStride		= GetCompressedRotationStride(Seq);
@@ -872,6 +938,14 @@ void AnimationFormat_SetInterfaceLinks(UAnimSequence& Seq)
 		// is called in Serialize where GetLinker is too early to call
 		//checkf(Seq.ScaleCompressionFormat == ACF_Identity);
 	}
+	else if (Seq.KeyEncodingFormat == AKF_InterleavedKeyLerp)
+	{
+		static AEFInterleavedKeyLerp StaticCodec;
+
+		Seq.RotationCodec = &StaticCodec;
+		Seq.TranslationCodec = &StaticCodec;
+		Seq.ScaleCodec = &StaticCodec;
+	}
 	else
 	{
 		UE_LOG(LogAnimationCompression, Fatal, TEXT("%i: unknown or unsupported animation format"), (int32)Seq.KeyEncodingFormat );
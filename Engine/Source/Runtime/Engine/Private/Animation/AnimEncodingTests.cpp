@@ -0,0 +1,110 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+#include "EnginePrivate.h"
+#include "Animation/AnimCompress.h"
+#include "AnimEncoding.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAnimEncodingInterleavedTest, "Engine.Animation.Interleaved Key Lerp Codec", EAutomationTestFlags::ATF_Editor)
+
+bool FAnimEncodingInterleavedTest::RunTest(const FString& Parameters)
+{
+	const int32 NumTracks = 96;
+	const int32 NumFrames = 31;
+	const int32 NumSamples = 64;
+
+	// A mix of animated and single key tracks, as left behind by FilterTrivialKeys
+	FRandomStream Stream(0x1A7E5EED);
+	TArray<FTranslationTrack> TranslationData;
+	TArray<FRotationTrack> RotationData;
+	TArray<FScaleTrack> ScaleData;
+	TranslationData.AddZeroed(NumTracks);
+	RotationData.AddZeroed(NumTracks);
+	ScaleData.AddZeroed(NumTracks);
+	for (int32 TrackIndex = 0; TrackIndex < NumTracks; ++TrackIndex)
+	{
+		const int32 NumTransKeys = (TrackIndex % 3 == 0) ? NumFrames : 1;
+		const int32 NumRotKeys = (TrackIndex % 4 == 0) ? 1 : NumFrames;
+		const int32 NumScaleKeys = (TrackIndex % 8 == 0) ? NumFrames : 1;
+
+		FVector Translation(Stream.FRandRange(-100.f, 100.f), Stream.FRandRange(-100.f, 100.f), Stream.FRandRange(-100.f, 100.f));
+		for (int32 KeyIndex = 0; KeyIndex < NumTransKeys; ++KeyIndex)
+		{
+			Translation += Stream.VRand() * 5.f;
+			TranslationData[TrackIndex].PosKeys.Add(Translation);
+			TranslationData[TrackIndex].Times.Add(KeyIndex / float(NumFrames - 1));
+		}
+
+		FRotator Rotation(Stream.FRandRange(-180.f, 180.f), Stream.FRandRange(-180.f, 180.f), Stream.FRandRange(-180.f, 180.f));
+		for (int32 KeyIndex = 0; KeyIndex < NumRotKeys; ++KeyIndex)
+		{
+			Rotation += FRotator(Stream.FRandRange(-10.f, 10.f), Stream.FRandRange(-10.f, 10.f), Stream.FRandRange(-10.f, 10.f));
+			RotationData[TrackIndex].RotKeys.Add(Rotation.Quaternion());
+			RotationData[TrackIndex].Times.Add(KeyIndex / float(NumFrames - 1));
+		}
+
+		FVector Scale(Stream.FRandRange(0.5f, 2.f));
+		for (int32 KeyIndex = 0; KeyIndex < NumScaleKeys; ++KeyIndex)
+		{
+			Scale += FVector(Stream.FRandRange(-0.05f, 0.05f));
+			ScaleData[TrackIndex].ScaleKeys.Add(Scale);
+			ScaleData[TrackIndex].Times.Add(KeyIndex / float(NumFrames - 1));
+		}
+	}
+
+	// Reference: per-track bitwise compression with the same key precision
+	UAnimSequence* ReferenceSeq = ConstructObject<UAnimSequence>(UAnimSequence::StaticClass());
+	ReferenceSeq->NumFrames = NumFrames;
+	ReferenceSeq->SequenceLength = 1.f;
+	UAnimCompress::BitwiseCompressAnimationTracks(ReferenceSeq, ACF_None, ACF_Fixed48NoW, ACF_None, TranslationData, RotationData, ScaleData);
+	ReferenceSeq->KeyEncodingFormat = AKF_ConstantKeyLerp;
+	AnimationFormat_SetInterfaceLinks(*ReferenceSeq);
+
+	UAnimSequence* InterleavedSeq = ConstructObject<UAnimSequence>(UAnimSequence::StaticClass());
+	InterleavedSeq->NumFrames = NumFrames;
+	InterleavedSeq->SequenceLength = 1.f;
+	UAnimCompress::InterleaveAnimationTracks(InterleavedSeq, TranslationData, RotationData, ScaleData);
+	InterleavedSeq->KeyEncodingFormat = AKF_InterleavedKeyLerp;
+	AnimationFormat_SetInterfaceLinks(*InterleavedSeq);
+
+	TestTrue(TEXT("Interleaved sequence is not larger than the bitwise one"), InterleavedSeq->GetResourceSize(EResourceSizeMode::Exclusive) <= ReferenceSeq->GetResourceSize(EResourceSizeMode::Exclusive));
+
+	BoneTrackArray Pairs;
+	for (int32 TrackIndex = 0; TrackIndex < NumTracks; ++TrackIndex)
+	{
+		Pairs.Add(BoneTrackPair(TrackIndex, TrackIndex));
+	}
+
+	FMemMark Mark(FMemStack::Get());
+	FTransformArray ReferencePose;
+	FTransformArray InterleavedPose;
+	ReferencePose.AddUninitialized(NumTracks);
+	InterleavedPose.AddUninitialized(NumTracks);
+
+	// Single bone and whole pose decompression must both agree with the reference codec
+	for (int32 SampleIndex = 0; SampleIndex <= NumSamples; ++SampleIndex)
+	{
+		const float Time = SampleIndex / float(NumSamples);
+
+		AnimationFormat_GetAnimationPose(ReferencePose, Pairs, Pairs, Pairs, *ReferenceSeq, Time);
+		AnimationFormat_GetAnimationPose(InterleavedPose, Pairs, Pairs, Pairs, *InterleavedSeq, Time);
+
+		for (int32 TrackIndex = 0; TrackIndex < NumTracks; ++TrackIndex)
+		{
+			FTransform InterleavedAtom;
+			AnimationFormat_GetBoneAtom(InterleavedAtom, *InterleavedSeq, TrackIndex, Time);
+
+			if (!InterleavedPose[TrackIndex].Equals(ReferencePose[TrackIndex], 1.e-3f))
+			{
+				AddError(FString::Printf(TEXT("Pose of track %d at time %f differs from the bitwise codec"), TrackIndex, Time));
+				return false;
+			}
+			if (!InterleavedAtom.Equals(InterleavedPose[TrackIndex], KINDA_SMALL_NUMBER))
+			{
+				AddError(FString::Printf(TEXT("Bone atom of track %d at time %f differs from the pose"), TrackIndex, Time));
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
@@ -0,0 +1,364 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+	AnimEncoding_InterleavedKeyLerp.cpp: Key-frame interleaved decompressor
+=============================================================================*/
+
+#include "EnginePrivate.h"
+#include "AnimationCompression.h"
+#include "AnimEncoding_InterleavedKeyLerp.h"
+#include "AnimationUtils.h"
+
+/** Returns the header at the start of the compressed byte stream */
+static FORCEINLINE const FInterleavedKeyLerpHeader& GetInterleavedHeader(const UAnimSequence& Seq)
+{
+	checkSlow(Seq.CompressedByteStream.Num() >= sizeof(FInterleavedKeyLerpHeader));
+	return *reinterpret_cast<const FInterleavedKeyLerpHeader*>(Seq.CompressedByteStream.GetData());
+}
+
+/** Blends two unpacked vector keys: A + (B - A) * Alpha */
+static FORCEINLINE VectorRegister LerpVectorKeys(const uint8* RESTRICT Key0, const uint8* RESTRICT Key1, const VectorRegister& Alpha)
+{
+	const VectorRegister A = VectorLoadFloat3_W0(Key0);
+	const VectorRegister B = VectorLoadFloat3_W0(Key1);
+	return VectorMultiplyAdd(VectorSubtract(B, A), Alpha, A);
+}
+
+/**
+ * Finds the two frame records to interpolate for the given time.
+ *
+ * @param	Seq				The animation sequence to use.
+ * @param	Time			Current time to solve for.
+ * @param	OutSample		Receives the frame records and blend alpha.
+ */
+void AEFInterleavedKeyLerp::GetFrameSample(const UAnimSequence& Seq, float Time, FFrameSample& OutSample)
+{
+	const FInterleavedKeyLerpHeader& Header = GetInterleavedHeader(Seq);
+	const uint8* RESTRICT FrameData = Seq.CompressedByteStream.GetData() + Header.FrameDataOffset;
+
+	if (Header.NumKeys > 0)
+	{
+		const float RelativePos = Time / Seq.SequenceLength;
+
+		int32 Index0;
+		int32 Index1;
+		const float Alpha = TimeToIndex(Seq, RelativePos, Header.NumKeys, Index0, Index1);
+
+		OutSample.Frame0 = FrameData + (Index0 * Header.FrameStride);
+		OutSample.Frame1 = FrameData + (Index1 * Header.FrameStride);
+		OutSample.Alpha = VectorLoadFloat1(&Alpha);
+	}
+	else
+	{
+		// Every track is constant, the frame records are never read
+		OutSample.Frame0 = FrameData;
+		OutSample.Frame1 = FrameData;
+		OutSample.Alpha = VectorZero();
+	}
+}
+
+/** Decompress the rotation stored at Offset (see InterleavedKeyLerp) */
+FORCEINLINE_DEBUGGABLE void AEFInterleavedKeyLerp::DecompressRotation(FTransform& OutAtom, const UAnimSequence& Seq, const FFrameSample& Sample, int32 Offset)
+{
+	FQuat R0;
+	if (InterleavedKeyLerp::IsConstantOffset(Offset))
+	{
+		const uint8* RESTRICT KeyData = Seq.CompressedByteStream.GetData() + InterleavedKeyLerp::DecodeConstantOffset(Offset);
+		((FQuatFloat96NoW*)KeyData)->ToQuat(R0);
+		OutAtom.SetRotation(R0);
+	}
+	else
+	{
+		FQuat R1;
+		((FQuatFixed48NoW*)(Sample.Frame0 + Offset))->ToQuat(R0);
+		((FQuatFixed48NoW*)(Sample.Frame1 + Offset))->ToQuat(R1);
+
+		// Fixed48 keys are stored with a positive W, VectorLerpQuat picks the shortest route between them
+		const VectorRegister Blended = VectorNormalizeQuaternion(VectorLerpQuat(VectorLoadAligned(&R0), VectorLoadAligned(&R1), Sample.Alpha));
+		VectorStoreAligned(Blended, &R0);
+		OutAtom.SetRotation(R0);
+	}
+}
+
+/** Decompress the translation stored at Offset (see InterleavedKeyLerp) */
+FORCEINLINE_DEBUGGABLE void AEFInterleavedKeyLerp::DecompressTranslation(FTransform& OutAtom, const UAnimSequence& Seq, const FFrameSample& Sample, int32 Offset)
+{
+	if (InterleavedKeyLerp::IsConstantOffset(Offset))
+	{
+		const uint8* RESTRICT KeyData = Seq.CompressedByteStream.GetData() + InterleavedKeyLerp::DecodeConstantOffset(Offset);
+		OutAtom.SetTranslation(*(FVector*)KeyData);
+	}
+	else
+	{
+		FVector Out;
+		VectorStoreFloat3(LerpVectorKeys(Sample.Frame0 + Offset, Sample.Frame1 + Offset, Sample.Alpha), &Out);
+		OutAtom.SetTranslation(Out);
+	}
+}
+
+/** Decompress the scale stored at Offset (see InterleavedKeyLerp) */
+FORCEINLINE_DEBUGGABLE void AEFInterleavedKeyLerp::DecompressScale(FTransform& OutAtom, const UAnimSequence& Seq, const FFrameSample& Sample, int32 Offset)
+{
+	if (InterleavedKeyLerp::IsConstantOffset(Offset))
+	{
+		const uint8* RESTRICT KeyData = Seq.CompressedByteStream.GetData() + InterleavedKeyLerp::DecodeConstantOffset(Offset);
+		OutAtom.SetScale3D(*(FVector*)KeyData);
+	}
+	else
+	{
+		FVector Out;
+		VectorStoreFloat3(LerpVectorKeys(Sample.Frame0 + Offset, Sample.Frame1 + Offset, Sample.Alpha), &Out);
+		OutAtom.SetScale3D(Out);
+	}
+}
+
+/**
+ * Handles Byte-swapping the whole compressed byte stream from a MemoryReader or to a MemoryWriter
+ *
+ * @param	Seq					The Animation Sequence being operated on.
+ * @param	MemoryStream		The MemoryReader or MemoryWriter object to read from/write to.
+ */
+void AEFInterleavedKeyLerp::ByteSwapStream(UAnimSequence& Seq, FMemoryArchive& MemoryStream)
+{
+	if (Seq.CompressedByteStream.Num() == 0)
+	{
+		return;
+	}
+
+	uint8* StreamData = Seq.CompressedByteStream.GetData();
+
+	// Header
+	const int32 NumHeaderInts = sizeof(FInterleavedKeyLerpHeader) / sizeof(int32);
+	for (int32 i = 0; i < NumHeaderInts; ++i)
+	{
+		AC_UnalignedSwap(MemoryStream, StreamData, sizeof(int32));
+	}
+	const FInterleavedKeyLerpHeader Header = GetInterleavedHeader(Seq);
+
+	// Constant keys are all made of floats
+	const int32 NumConstantFloats = (Header.FrameDataOffset - NumHeaderInts * sizeof(int32)) / sizeof(float);
+	for (int32 i = 0; i < NumConstantFloats; ++i)
+	{
+		AC_UnalignedSwap(MemoryStream, StreamData, sizeof(float));
+	}
+
+	// Frame records
+	const int32 RotationBytes = Header.NumAnimatedRotations * sizeof(FQuatFixed48NoW);
+	const int32 PadBytes = Align(RotationBytes, 4) - RotationBytes;
+	const int32 NumVectorFloats = (Header.NumAnimatedTranslations + Header.NumAnimatedScales) * 3;
+	for (int32 KeyIndex = 0; KeyIndex < Header.NumKeys; ++KeyIndex)
+	{
+		checkSlow((StreamData - Seq.CompressedByteStream.GetData()) == Header.FrameDataOffset + KeyIndex * Header.FrameStride);
+
+		for (int32 i = 0; i < Header.NumAnimatedRotations * 3; ++i)
+		{
+			AC_UnalignedSwap(MemoryStream, StreamData, sizeof(uint16));
+		}
+		for (int32 i = 0; i < PadBytes; ++i)
+		{
+			AC_UnalignedSwap(MemoryStream, StreamData, sizeof(uint8));
+		}
+		for (int32 i = 0; i < NumVectorFloats; ++i)
+		{
+			AC_UnalignedSwap(MemoryStream, StreamData, sizeof(float));
+		}
+	}
+}
+
+/**
+ * Handles Byte-swapping incoming animation data from a MemoryReader
+ *
+ * @param	Seq					An Animation Sequence to contain the read data.
+ * @param	MemoryReader		The MemoryReader object to read from.
+ */
+void AEFInterleavedKeyLerp::ByteSwapIn(
+	UAnimSequence& Seq,
+	FMemoryReader& MemoryReader)
+{
+	int32 OriginalNumBytes = MemoryReader.TotalSize();
+	Seq.CompressedByteStream.Empty(OriginalNumBytes);
+	Seq.CompressedByteStream.AddUninitialized(OriginalNumBytes);
+
+	ByteSwapStream(Seq, MemoryReader);
+}
+
+/**
+ * Handles Byte-swapping outgoing animation data to an array of BYTEs
+ *
+ * @param	Seq					An Animation Sequence to write.
+ * @param	SerializedData		The output buffer.
+ * @param	ForceByteSwapping	true is byte swapping is not optional.
+ */
+void AEFInterleavedKeyLerp::ByteSwapOut(
+	UAnimSequence& Seq,
+	TArray<uint8>& SerializedData,
+	bool ForceByteSwapping)
+{
+	FMemoryWriter MemoryWriter(SerializedData, true);
+	MemoryWriter.SetByteSwapping(ForceByteSwapping);
+
+	ByteSwapStream(Seq, MemoryWriter);
+}
+
+/**
+ * Extracts a single BoneAtom from an Animation Sequence.
+ *
+ * @param	OutAtom			The BoneAtom to fill with the extracted result.
+ * @param	Seq				An Animation Sequence to extract the BoneAtom from.
+ * @param	TrackIndex		The index of the track desired in the Animation Sequence.
+ * @param	Time			The time (in seconds) to calculate the BoneAtom for.
+ */
+void AEFInterleavedKeyLerp::GetBoneAtom(
+	FTransform& OutAtom,
+	const UAnimSequence& Seq,
+	int32 TrackIndex,
+	float Time)
+{
+	// Initialize to identity to set the scale
+	OutAtom.SetIdentity();
+
+	FFrameSample Sample;
+	GetFrameSample(Seq, Time, Sample);
+
+	const int32* RESTRICT TrackData = Seq.CompressedTrackOffsets.GetData() + (TrackIndex * 2);
+	DecompressTranslation(OutAtom, Seq, Sample, *(TrackData + 0));
+	DecompressRotation(OutAtom, Seq, Sample, *(TrackData + 1));
+
+	if (Seq.CompressedScaleOffsets.IsValid())
+	{
+		DecompressScale(OutAtom, Seq, Sample, Seq.CompressedScaleOffsets.GetOffsetData(TrackIndex, 0));
+	}
+}
+
+#if USE_ANIMATION_CODEC_BATCH_SOLVER
+
+/**
+ * Decompress all requested rotation components from an Animation Sequence
+ *
+ * @param	Atoms			The FTransform array to fill in.
+ * @param	DesiredPairs	Array of requested bone information
+ * @param	Seq				The animation sequence to use.
+ * @param	Time			Current time to solve for.
+ * @return					None.
+ */
+void AEFInterleavedKeyLerp::GetPoseRotations(
+	FTransformArray& Atoms,
+	const BoneTrackArray& DesiredPairs,
+	const UAnimSequence& Seq,
+	float Time)
+{
+	FFrameSample Sample;
+	GetFrameSample(Seq, Time, Sample);
+
+	const int32* RESTRICT TrackOffsets = Seq.CompressedTrackOffsets.GetData();
+	const int32 PairCount = DesiredPairs.Num();
+	for (int32 PairIndex = 0; PairIndex < PairCount; ++PairIndex)
+	{
+		const BoneTrackPair& Pair = DesiredPairs[PairIndex];
+		DecompressRotation(Atoms[Pair.AtomIndex], Seq, Sample, TrackOffsets[Pair.TrackIndex * 2 + 1]);
+	}
+}
+
+/**
+ * Decompress all requested translation components from an Animation Sequence
+ *
+ * @param	Atoms			The FTransform array to fill in.
+ * @param	DesiredPairs	Array of requested bone information
+ * @param	Seq				The animation sequence to use.
+ * @param	Time			Current time to solve for.
+ * @return					None.
+ */
+void AEFInterleavedKeyLerp::GetPoseTranslations(
+	FTransformArray& Atoms,
+	const BoneTrackArray& DesiredPairs,
+	const UAnimSequence& Seq,
+	float Time)
+{
+	FFrameSample Sample;
+	GetFrameSample(Seq, Time, Sample);
+
+	const int32* RESTRICT TrackOffsets = Seq.CompressedTrackOffsets.GetData();
+	const int32 PairCount = DesiredPairs.Num();
+	for (int32 PairIndex = 0; PairIndex < PairCount; ++PairIndex)
+	{
+		const BoneTrackPair& Pair = DesiredPairs[PairIndex];
+		DecompressTranslation(Atoms[Pair.AtomIndex], Seq, Sample, TrackOffsets[Pair.TrackIndex * 2 + 0]);
+	}
+}
+
+/**
+ * Decompress all requested Scale components from an Animation Sequence
+ *
+ * @param	Atoms			The FTransform array to fill in.
+ * @param	DesiredPairs	Array of requested bone information
+ * @param	Seq				The animation sequence to use.
+ * @param	Time			Current time to solve for.
+ * @return					None.
+ */
+void AEFInterleavedKeyLerp::GetPoseScales(
+	FTransformArray& Atoms,
+	const BoneTrackArray& DesiredPairs,
+	const UAnimSequence& Seq,
+	float Time)
+{
+	check(Seq.CompressedScaleOffsets.IsValid());
+
+	FFrameSample Sample;
+	GetFrameSample(Seq, Time, Sample);
+
+	const int32 PairCount = DesiredPairs.Num();
+	for (int32 PairIndex = 0; PairIndex < PairCount; ++PairIndex)
+	{
+		const BoneTrackPair& Pair = DesiredPairs[PairIndex];
+		DecompressScale(Atoms[Pair.AtomIndex], Seq, Sample, Seq.CompressedScaleOffsets.GetOffsetData(Pair.TrackIndex, 0));
+	}
+}
+
+/**
+ * Decompress every requested component of a pose at once.
+ *
+ * @param	Atoms				The FTransform array to fill in.
+ * @param	RotationPairs		Array of requested bone information for rotations.
+ * @param	TranslationPairs	Array of requested bone information for translations.
+ * @param	ScalePairs			Array of requested bone information for scales.
+ * @param	Seq					The animation sequence to use.
+ * @param	Time				Current time to solve for.
+ */
+void AEFInterleavedKeyLerp::GetPose(
+	FTransformArray& Atoms,
+	const BoneTrackArray& RotationPairs,
+	const BoneTrackArray& TranslationPairs,
+	const BoneTrackArray& ScalePairs,
+	const UAnimSequence& Seq,
+	float Time)
+{
+	// Solve the key pair once for every bone in the pose
+	FFrameSample Sample;
+	GetFrameSample(Seq, Time, Sample);
+
+	const int32* RESTRICT TrackOffsets = Seq.CompressedTrackOffsets.GetData();
+
+	for (int32 PairIndex = 0; PairIndex < TranslationPairs.Num(); ++PairIndex)
+	{
+		const BoneTrackPair& Pair = TranslationPairs[PairIndex];
+		DecompressTranslation(Atoms[Pair.AtomIndex], Seq, Sample, TrackOffsets[Pair.TrackIndex * 2 + 0]);
+	}
+
+	for (int32 PairIndex = 0; PairIndex < RotationPairs.Num(); ++PairIndex)
+	{
+		const BoneTrackPair& Pair = RotationPairs[PairIndex];
+		DecompressRotation(Atoms[Pair.AtomIndex], Seq, Sample, TrackOffsets[Pair.TrackIndex * 2 + 1]);
+	}
+
+	// we allow scale key to be empty
+	if (Seq.CompressedScaleOffsets.IsValid())
+	{
+		for (int32 PairIndex = 0; PairIndex < ScalePairs.Num(); ++PairIndex)
+		{
+			const BoneTrackPair& Pair = ScalePairs[PairIndex];
+			DecompressScale(Atoms[Pair.AtomIndex], Seq, Sample, Seq.CompressedScaleOffsets.GetOffsetData(Pair.TrackIndex, 0));
+		}
+	}
+}
+
+#endif // USE_ANIMATION_CODEC_BATCH_SOLVER
@@ -39,6 +39,9 @@ DEFINE_STAT(STAT_AnimGraphEvaluate);
 DEFINE_STAT(STAT_AnimBlendTime);
 DEFINE_STAT(STAT_RefreshBoneTransforms);
 DEFINE_STAT(STAT_InterpolateSkippedFrames);
+DEFINE_STAT(STAT_AnimSkippedUpdates);
+DEFINE_STAT(STAT_AnimSkippedEvaluations);
+DEFINE_STAT(STAT_AnimInterpolatedFrames);
 DEFINE_STAT(STAT_AnimTickTime);
 DEFINE_STAT(STAT_SkinnedMeshCompTick);
 DEFINE_STAT(STAT_TickUpdateRate);
@@ -71,38 +71,58 @@ void FAnimationRuntime::BlendPosesTogether(int32 NumPoses, const FTransformArray
 		float WeightSum=0.f;
 		for (int32 i = 0; i < NumPoses; ++i)
 		{
-			const ScalarRegister VBlendWeight(SourceWeights[i]);
-			const FTransformArrayA2& SourceAtoms = *SourcePoses[i];
-
 			WeightSum += SourceWeights[i];
-
-			if (i == 0)
-			{
-				// First pose will just overwrite the destination
-				for (int32 j = 0; j < RequiredBoneIndices.Num(); ++j)
-				{
-					const int32 BoneIndex = RequiredBoneIndices[j];
-					ResultAtoms[BoneIndex] = SourceAtoms[BoneIndex] * VBlendWeight;
-				}
-			}
-			else
-			{
-				// Subsequent poses need to be blended in
-				for (int32 j = 0; j < RequiredBoneIndices.Num(); ++j)
-				{
-					const int32 BoneIndex = RequiredBoneIndices[j];
-					ResultAtoms[BoneIndex].AccumulateWithShortestRotation(SourceAtoms[BoneIndex], VBlendWeight);
-				}
-			}
 		}
 
 		ensure (WeightSum != 0.f);
 
-		// Ensure that all of the resulting rotations are normalized
-		if( NumPoses > 1 )
+		BlendPosesTogether(NumPoses, SourcePoses, SourceWeights, RequiredBoneIndices, ResultAtoms);
+	}
+}
+
+void FAnimationRuntime::BlendPosesTogether(int32 NumPoses, const FTransformArrayA2* const* SourcePoses, const float* SourceWeights, const TArray<FBoneIndexType>& RequiredBoneIndices, /*out*/ FTransformArrayA2& ResultAtoms)
+{
+	check(NumPoses > 0);
+
+	FTransform* ResultAtomsData = ResultAtoms.GetData();
+	const int32 NumRequiredBones = RequiredBoneIndices.Num();
+
+	if (NumPoses == 1)
+	{
+		const ScalarRegister VBlendWeight(SourceWeights[0]);
+		const FTransform* SourceAtomsData = SourcePoses[0]->GetData();
+		for (int32 j = 0; j < NumRequiredBones; ++j)
+		{
+			const int32 BoneIndex = RequiredBoneIndices[j];
+			ResultAtomsData[BoneIndex] = SourceAtomsData[BoneIndex] * VBlendWeight;
+		}
+		return;
+	}
+
+	// Bones are the outer loop so the running blend for a bone stays in registers across all poses, and it can be normalized
+	// before the single store.
+	TArray<const FTransform*, TInlineAllocator<8>> SourceData;
+	SourceData.AddUninitialized(NumPoses);
+	for (int32 i = 0; i < NumPoses; ++i)
+	{
+		checkSlow(SourcePoses[i]->Num() >= ResultAtoms.Num());
+		SourceData[i] = SourcePoses[i]->GetData();
+	}
+
+	for (int32 j = 0; j < NumRequiredBones; ++j)
+	{
+		const int32 BoneIndex = RequiredBoneIndices[j];
+
+		// First pose will just overwrite the destination, subsequent poses need to be blended in
+		FTransform BlendedAtom = SourceData[0][BoneIndex] * ScalarRegister(SourceWeights[0]);
+		for (int32 i = 1; i < NumPoses; ++i)
 		{
-			FAnimationRuntime::NormalizeRotations(RequiredBones, ResultAtoms);
+			BlendedAtom.AccumulateWithShortestRotation(SourceData[i][BoneIndex], ScalarRegister(SourceWeights[i]));
 		}
+
+		// Ensure that the resulting rotation is normalized
+		BlendedAtom.NormalizeRotation();
+		ResultAtomsData[BoneIndex] = BlendedAtom;
 	}
 }
 
@@ -121,38 +141,14 @@ void FAnimationRuntime::BlendPosesTogether(int32 NumPoses, const TArray<FTransfo
 {
 	check(NumPoses > 0);
 
-
-	const TArray<FBoneIndexType> & RequiredBoneIndices = RequiredBones.GetBoneIndicesArray();
+	TArray<const FTransformArrayA2*, TInlineAllocator<8>> SourcePosePtrs;
+	SourcePosePtrs.AddUninitialized(NumPoses);
 	for (int32 i = 0; i < NumPoses; ++i)
 	{
-		const ScalarRegister VBlendWeight(SourceWeights[i]);
-		const FTransformArrayA2& SourceAtoms = SourcePoses[i];
-
-		if (i == 0)
-		{
-			// First pose will just overwrite the destination
-			for (int32 j = 0; j < RequiredBoneIndices.Num(); ++j)
-			{
-				const int32 BoneIndex = RequiredBoneIndices[j];
-				ResultAtoms[BoneIndex] = SourceAtoms[BoneIndex] * VBlendWeight;
-			}
-		}
-		else
-		{
-			// Subsequent poses need to be blended in
-			for (int32 j = 0; j < RequiredBoneIndices.Num(); ++j)
-			{
-				const int32 BoneIndex = RequiredBoneIndices[j];
-				ResultAtoms[BoneIndex].AccumulateWithShortestRotation(SourceAtoms[BoneIndex], VBlendWeight);
-			}
-		}
+		SourcePosePtrs[i] = &SourcePoses[i];
 	}
 
-	// Ensure that all of the resulting rotations are normalized
-	if( NumPoses > 1 )
-	{
-		FAnimationRuntime::NormalizeRotations(RequiredBones, ResultAtoms);
-	}
+	BlendPosesTogether(NumPoses, SourcePosePtrs.GetData(), SourceWeights.GetData(), RequiredBones.GetBoneIndicesArray(), ResultAtoms);
 }
 
 /**
@@ -288,11 +284,14 @@ void FAnimationRuntime::BlendPosesAccumulate(const FTransformArrayA2& BlendPoses
 {
 	const ScalarRegister VBlendWeight(BlendWeight);
 	const TArray<FBoneIndexType> & RequiredBoneIndices = RequiredBones.GetBoneIndicesArray();
+	const FTransform* BlendAtomsData = BlendPoses.GetData();
+	FTransform* ResultAtomsData = ResultAtoms.GetData();
 	// Subsequent poses need to be blended in
-	for (int32 j = 0; j < RequiredBoneIndices.Num(); ++j)
+	const int32 NumRequiredBones = RequiredBoneIndices.Num();
+	for (int32 j = 0; j < NumRequiredBones; ++j)
 	{
 		const int32 BoneIndex = RequiredBoneIndices[j];
-		ResultAtoms[BoneIndex].AccumulateWithShortestRotation(BlendPoses[BoneIndex], VBlendWeight);
+		ResultAtomsData[BoneIndex].AccumulateWithShortestRotation(BlendAtomsData[BoneIndex], VBlendWeight);
 	}
 }
 
@@ -325,20 +324,29 @@ void FAnimationRuntime::LerpBoneTransforms(TArray<FTransform> & A, const TArray<
 }
 
 void FAnimationRuntime::BlendAdditivePose(const FTransformArrayA2& SourcePoses, const FTransformArrayA2& AdditiveBlendPoses, const float BlendWeight, const FBoneContainer& RequiredBones, /*out*/ FTransformArrayA2& ResultAtoms)
+{
+	BlendAdditivePose(SourcePoses, AdditiveBlendPoses, BlendWeight, RequiredBones.GetBoneIndicesArray(), ResultAtoms);
+}
+
+void FAnimationRuntime::BlendAdditivePose(const FTransformArrayA2& SourcePoses, const FTransformArrayA2& AdditiveBlendPoses, const float BlendWeight, const TArray<FBoneIndexType>& RequiredBoneIndices, /*out*/ FTransformArrayA2& ResultAtoms)
 {
 	const ScalarRegister VBlendWeight(BlendWeight);
-	// Subsequent poses need to be blended in
-	const TArray<FBoneIndexType> & RequiredBoneIndices = RequiredBones.GetBoneIndicesArray();
-	for (int32 j = 0; j < RequiredBoneIndices.Num(); ++j)
+	const FTransform* SourceAtomsData = SourcePoses.GetData();
+	const FTransform* AdditiveAtomsData = AdditiveBlendPoses.GetData();
+	FTransform* ResultAtomsData = ResultAtoms.GetData();
+
+	const int32 NumRequiredBones = RequiredBoneIndices.Num();
+	for (int32 j = 0; j < NumRequiredBones; ++j)
 	{
 		const int32 BoneIndex = RequiredBoneIndices[j];
-		FTransform Additive = AdditiveBlendPoses[BoneIndex];
-		ResultAtoms[BoneIndex] = SourcePoses[BoneIndex];
-		FTransform::BlendFromIdentityAndAccumulate(ResultAtoms[BoneIndex], Additive, VBlendWeight);
-	}
+		FTransform Additive = AdditiveAtomsData[BoneIndex];
+		FTransform BlendedAtom = SourceAtomsData[BoneIndex];
+		FTransform::BlendFromIdentityAndAccumulate(BlendedAtom, Additive, VBlendWeight);
 
-	// Ensure that all of the resulting rotations are normalized
-	FAnimationRuntime::NormalizeRotations(RequiredBones, ResultAtoms);
+		// Ensure that the resulting rotation is normalized
+		BlendedAtom.NormalizeRotation();
+		ResultAtomsData[BoneIndex] = BlendedAtom;
+	}
 }
 
 void FAnimationRuntime::CombineWithAdditiveAnimations(int32 NumAdditivePoses, const FTransformArrayA2** SourceAdditivePoses, const float* SourceAdditiveWeights, const FBoneContainer& RequiredBones, /*inout*/ FTransformArrayA2& Atoms)
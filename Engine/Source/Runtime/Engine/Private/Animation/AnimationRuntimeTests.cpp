@@ -0,0 +1,75 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+#include "EnginePrivate.h"
+#include "AnimationRuntime.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAnimationRuntimeBlendTest, "Engine.Animation.Pose Blending", EAutomationTestFlags::ATF_Editor)
+
+bool FAnimationRuntimeBlendTest::RunTest(const FString& Parameters)
+{
+	const int32 NumBones = 67;
+	const int32 NumPoses = 3;
+	const float Weights[NumPoses] = { 0.5f, 0.3f, 0.2f };
+
+	FRandomStream Stream(0x4A11B1E0);
+	FTransformArrayA2 Poses[NumPoses];
+	const FTransformArrayA2* PosePtrs[NumPoses];
+	for (int32 PoseIndex = 0; PoseIndex < NumPoses; ++PoseIndex)
+	{
+		for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+		{
+			const FRotator Rotation(Stream.FRandRange(-180.f, 180.f), Stream.FRandRange(-180.f, 180.f), Stream.FRandRange(-180.f, 180.f));
+			const FVector Translation(Stream.FRandRange(-100.f, 100.f), Stream.FRandRange(-100.f, 100.f), Stream.FRandRange(-100.f, 100.f));
+			Poses[PoseIndex].Add(FTransform(Rotation, Translation, FVector(Stream.FRandRange(0.5f, 2.f))));
+		}
+		PosePtrs[PoseIndex] = &Poses[PoseIndex];
+	}
+
+	// Every other bone, so bones outside of RequiredBoneIndices are left alone
+	TArray<FBoneIndexType> RequiredBoneIndices;
+	for (int32 BoneIndex = 0; BoneIndex < NumBones; BoneIndex += 2)
+	{
+		RequiredBoneIndices.Add(BoneIndex);
+	}
+
+	FTransformArrayA2 Result;
+	Result.AddDefaulted(NumBones);
+
+	FAnimationRuntime::BlendPosesTogether(NumPoses, PosePtrs, Weights, RequiredBoneIndices, Result);
+	for (int32 j = 0; j < RequiredBoneIndices.Num(); ++j)
+	{
+		// Weighted sum of the poses, with the shortest rotation, normalized once at the end
+		const int32 BoneIndex = RequiredBoneIndices[j];
+		FTransform Expected = Poses[0][BoneIndex] * ScalarRegister(Weights[0]);
+		for (int32 PoseIndex = 1; PoseIndex < NumPoses; ++PoseIndex)
+		{
+			Expected.AccumulateWithShortestRotation(Poses[PoseIndex][BoneIndex], ScalarRegister(Weights[PoseIndex]));
+		}
+		Expected.NormalizeRotation();
+
+		if (!Result[BoneIndex].Equals(Expected, KINDA_SMALL_NUMBER))
+		{
+			AddError(FString::Printf(TEXT("BlendPosesTogether result of bone %d differs from the weighted sum of the poses"), BoneIndex));
+			return false;
+		}
+	}
+	TestTrue(TEXT("BlendPosesTogether leaves bones that are not required alone"), Result[1].Equals(FTransform::Identity));
+
+	FAnimationRuntime::BlendAdditivePose(Poses[0], Poses[1], 0.5f, RequiredBoneIndices, Result);
+	for (int32 j = 0; j < RequiredBoneIndices.Num(); ++j)
+	{
+		const int32 BoneIndex = RequiredBoneIndices[j];
+		FTransform Expected = Poses[0][BoneIndex];
+		FTransform Additive = Poses[1][BoneIndex];
+		FTransform::BlendFromIdentityAndAccumulate(Expected, Additive, ScalarRegister(0.5f));
+		Expected.NormalizeRotation();
+
+		if (!Result[BoneIndex].Equals(Expected, KINDA_SMALL_NUMBER))
+		{
+			AddError(FString::Printf(TEXT("BlendAdditivePose result of bone %d differs from the additive blend of the poses"), BoneIndex));
+			return false;
+		}
+	}
+
+	return true;
+}
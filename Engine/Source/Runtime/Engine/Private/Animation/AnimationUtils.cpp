@@ -6,6 +6,7 @@
 
 #include "EnginePrivate.h"
 #include "Animation/AnimCompress_BitwiseCompressOnly.h"
+#include "Animation/AnimCompress_InterleavedKeyLerp.h"
 #include "Animation/AnimCompress_PerTrackCompression.h"
 #include "Animation/AnimCompress_LeastDestructive.h"
 #include "Animation/AnimCompress_RemoveEverySecondKey.h"
@@ -596,10 +597,12 @@ void FAnimationUtils::CompressAnimSequence(UAnimSequence* AnimSeq,  bool bAllowA
 			bool bTryPerTrackBitwiseCompression = true;
 			bool bTryLinearKeyRemovalCompression = true;
 			bool bTryIntervalKeyRemoval = true;
+			bool bTryInterleavedKeyLerp = false;
 			GConfig->GetBool( TEXT("AnimationCompression"), TEXT("bTryFixedBitwiseCompression"), bTryFixedBitwiseCompression, GEngineIni );
 			GConfig->GetBool( TEXT("AnimationCompression"), TEXT("bTryPerTrackBitwiseCompression"), bTryPerTrackBitwiseCompression, GEngineIni );
 			GConfig->GetBool( TEXT("AnimationCompression"), TEXT("bTryLinearKeyRemovalCompression"), bTryLinearKeyRemovalCompression, GEngineIni );
 			GConfig->GetBool( TEXT("AnimationCompression"), TEXT("bTryIntervalKeyRemoval"), bTryIntervalKeyRemoval, GEngineIni );
+			GConfig->GetBool( TEXT("AnimationCompression"), TEXT("bTryInterleavedKeyLerp"), bTryInterleavedKeyLerp, GEngineIni );
 
 			CompressAnimSequenceExplicit(
 				AnimSeq,
@@ -611,7 +614,8 @@ void FAnimationUtils::CompressAnimSequence(UAnimSequence* AnimSeq,  bool bAllowA
 				bTryFixedBitwiseCompression,
 				bTryPerTrackBitwiseCompression,
 				bTryLinearKeyRemovalCompression,
-				bTryIntervalKeyRemoval);
+				bTryIntervalKeyRemoval,
+				bTryInterleavedKeyLerp);
 		}
 	}
 }
@@ -638,7 +642,8 @@ void FAnimationUtils::CompressAnimSequenceExplicit(
 	bool bTryFixedBitwiseCompression,
 	bool bTryPerTrackBitwiseCompression,
 	bool bTryLinearKeyRemovalCompression,
-	bool bTryIntervalKeyRemoval)
+	bool bTryIntervalKeyRemoval,
+	bool bTryInterleavedKeyLerp)
 {
 #if WITH_EDITORONLY_DATA
 	if( GDisableAnimationRecompression )
@@ -651,6 +656,8 @@ void FAnimationUtils::CompressAnimSequenceExplicit(
 	DECLARE_ANIM_COMP_ALGORITHM(BitwiseACF_IntervalFixed32);
 	DECLARE_ANIM_COMP_ALGORITHM(BitwiseACF_Fixed32);
 
+	DECLARE_ANIM_COMP_ALGORITHM(Interleaved_Fixed48);
+
 	DECLARE_ANIM_COMP_ALGORITHM(HalfOddACF_Float96);
 	DECLARE_ANIM_COMP_ALGORITHM(HalfOddACF_Fixed48);
 	DECLARE_ANIM_COMP_ALGORITHM(HalfOddACF_IntervalFixed32);
@@ -994,6 +1001,13 @@ void FAnimationUtils::CompressAnimSequenceExplicit(
 // 					TRYCOMPRESSION(BitwiseACF_Fixed32,BitwiseCompressor);
 				}
 
+				// Same precision as ACF_Fixed48NoW, with all keys of a frame stored together and a smaller offset table
+				if( bTryInterleavedKeyLerp )
+				{
+					UAnimCompress_InterleavedKeyLerp* InterleavedCompressor = ConstructObject<UAnimCompress_InterleavedKeyLerp>( UAnimCompress_InterleavedKeyLerp::StaticClass() );
+					TRYCOMPRESSION(Interleaved_Fixed48, InterleavedCompressor);
+				}
+
 				// Start with Bitwise Compress only
 				// this compressor has a minimum number of frames requirement. So no need to go there if we don't meet that...
 				if( bTryFixedBitwiseCompression && bTryIntervalKeyRemoval )
@@ -1307,6 +1321,11 @@ void FAnimationUtils::CompressAnimSequenceExplicit(
 // 					WARN_COMPRESSION_STATUS(BitwiseACF_Fixed32);
 				}
 
+				if (bTryInterleavedKeyLerp)
+				{
+					WARN_COMPRESSION_STATUS(Interleaved_Fixed48);
+				}
+
 				if (bTryFixedBitwiseCompression && bTryIntervalKeyRemoval)
 				{
 					WARN_COMPRESSION_STATUS(HalfOddACF_Float96);
@@ -1490,6 +1509,8 @@ FString FAnimationUtils::GetAnimationKeyFormatString(AnimationKeyFormat InFormat
 		return FString(TEXT("AKF_VariableKeyLerp"));
 	case AKF_PerTrackCompression:
 		return FString(TEXT("AKF_PerTrackCompression"));
+	case AKF_InterleavedKeyLerp:
+		return FString(TEXT("AKF_InterleavedKeyLerp"));
 	default:
 		UE_LOG(LogAnimation, Warning, TEXT("AnimationKeyFormat was not found:  %i"), static_cast<int32>(InFormat) );
 	}
@@ -1712,6 +1712,355 @@ bool GeomOverlapMulti(const UWorld* World, const struct FCollisionShape& Collisi
 
 	return bHaveBlockingHit;
 }
+
+//////////////////////////////////////////////////////////////////////////
+// BATCHED QUERIES
+
+static TAutoConsoleVariable<int32> CVarParallelSceneQueryBatch(
+	TEXT("p.ParallelSceneQueryBatch"),
+	1,
+	TEXT("If 1, batched line traces and sweeps issued from the game thread (UWorld::BatchLineTraceSingle etc.) are split across task graph threads.\n")
+	TEXT("If 0, every query of a batch runs on the calling thread."),
+	ECVF_Default);
+
+/** Number of queries run by a single SceneQueryBatch task */
+static const int32 SceneQueriesPerTask = 64;
+
+/** Debug drawing, the collision analyzer and 2D physics all work one query at a time, so batches go through the single query functions when any of them is active */
+static bool ShouldRunSceneQueriesSerially(const UWorld* World, const struct FCollisionQueryParams& Params, bool bIsRaycast)
+{
+#if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
+	if ((World->DebugDrawTraceTag != NAME_None) && (World->DebugDrawTraceTag == Params.TraceTag))
+	{
+		return true;
+	}
+#endif //!(UE_BUILD_SHIPPING || UE_BUILD_TEST)
+
+#if ENABLE_COLLISION_ANALYZER
+	if (GCollisionAnalyzerIsRecording)
+	{
+		return true;
+	}
+#endif // ENABLE_COLLISION_ANALYZER
+
+#if WITH_BOX2D
+	if (bIsRaycast && GetDefault<UPhysicsSettings>()->bEnable2DPhysics)
+	{
+		return true;
+	}
+#endif // WITH_BOX2D
+
+#if WITH_PHYSX
+	return false;
+#else
+	return true;
+#endif // WITH_PHYSX
+}
+
+#if WITH_PHYSX
+
+/** Everything the queries of a batch have in common, set up once by SceneQueryBatch */
+struct FSceneQueryBatch
+{
+	const TArray<FVector>& Starts;
+	const TArray<FVector>& Ends;
+	const FCollisionQueryParams& Params;
+
+	PxScene* SyncScene;
+	/** NULL unless the async scene has to be queried as well */
+	PxScene* AsyncScene;
+
+	PxFilterData PFilter;
+	PxSceneQueryFilterData PQueryFilterData;
+	PxSceneQueryFlags POutputFlags;
+
+	/** Geometry to sweep, NULL for raycasts */
+	const PxGeometry* PGeom;
+	PxQuat PGeomRot;
+
+	/** One of these receives the results, indexed like Starts */
+	FHitResult* OutHits;
+	bool* OutBlockingHits;
+
+	FSceneQueryBatch(const TArray<FVector>& InStarts, const TArray<FVector>& InEnds, const FCollisionQueryParams& InParams)
+		: Starts(InStarts)
+		, Ends(InEnds)
+		, Params(InParams)
+		, SyncScene(NULL)
+		, AsyncScene(NULL)
+		, PGeom(NULL)
+		, PGeomRot(PxQuat::createIdentity())
+		, OutHits(NULL)
+		, OutBlockingHits(NULL)
+	{
+	}
+
+	/** Runs queries [StartIndex, EndIndex) of the batch and returns how many of them had a blocking hit */
+	int32 Run(int32 StartIndex, int32 EndIndex) const
+	{
+		// The callback keeps per query state, so each range needs its own. postFilter is only called for sweep tests, which are the only queries asking for it.
+		FPxQueryFilterCallbackSweep PQueryCallback(Params.IgnoreComponents);
+		PQueryCallback.bSingleQuery = true;
+		PQueryCallback.DiscardInitialOverlaps = !Params.bFindInitialOverlaps;
+
+		// Enable scene locks, in case they are required
+		SCOPED_SCENE_READ_LOCK(SyncScene);
+		SCOPED_SCENE_READ_LOCK(AsyncScene);
+
+		int32 NumBlockingHits = 0;
+		for (int32 QueryIndex = StartIndex; QueryIndex < EndIndex; QueryIndex++)
+		{
+			const FVector& Start = Starts[QueryIndex];
+			const FVector& End = Ends[QueryIndex];
+
+			bool bHaveBlockingHit = false;
+
+			const FVector Delta = End - Start;
+			const float DeltaMag = Delta.Size();
+			if (DeltaMag > KINDA_SMALL_NUMBER)
+			{
+				const PxTransform PStartTM(U2PVector(Start), PGeomRot);
+				const PxVec3 PDir = U2PVector(Delta / DeltaMag);
+
+				if (PGeom == NULL)
+				{
+					PxRaycastHit PHit;
+					bHaveBlockingHit = RaycastScenes(PStartTM, PDir, DeltaMag, PHit, PQueryCallback);
+					if (bHaveBlockingHit && OutHits)
+					{
+						ConvertQueryImpactHit(PHit, OutHits[QueryIndex], DeltaMag, PFilter, Start, End, NULL, PStartTM, Params.bReturnFaceIndex, Params.bReturnPhysicalMaterial);
+					}
+				}
+				else
+				{
+					PxSweepHit PHit;
+					bHaveBlockingHit = SweepScenes(PStartTM, PDir, DeltaMag, PHit, PQueryCallback);
+					if (bHaveBlockingHit && OutHits)
+					{
+						ConvertQueryImpactHit(PHit, OutHits[QueryIndex], DeltaMag, PFilter, Start, End, PGeom, PStartTM, false, Params.bReturnPhysicalMaterial);
+					}
+				}
+			}
+
+			if (OutBlockingHits)
+			{
+				OutBlockingHits[QueryIndex] = bHaveBlockingHit;
+			}
+			NumBlockingHits += bHaveBlockingHit ? 1 : 0;
+		}
+
+		return NumBlockingHits;
+	}
+
+private:
+	/** Same as RaycastSingle/RaycastTest: the async scene can replace a sync hit when the hit is wanted, and is only a fallback otherwise */
+	bool RaycastScenes(const PxTransform& PStartTM, const PxVec3& PDir, float DeltaMag, PxRaycastHit& PHit, FPxQueryFilterCallback& PQueryCallback) const
+	{
+		bool bHaveBlockingHit = SyncScene->raycastSingle(PStartTM.p, PDir, DeltaMag, POutputFlags, PHit, PQueryFilterData, &PQueryCallback);
+
+		if (AsyncScene && (OutHits || !bHaveBlockingHit))
+		{
+			PxRaycastHit PHitAsync;
+			const bool bHaveBlockingHitAsync = AsyncScene->raycastSingle(PStartTM.p, PDir, DeltaMag, POutputFlags, PHitAsync, PQueryFilterData, &PQueryCallback);
+			if (bHaveBlockingHitAsync && (!bHaveBlockingHit || PHitAsync.distance < PHit.distance))
+			{
+				PHit = PHitAsync;
+				bHaveBlockingHit = true;
+			}
+		}
+
+		return bHaveBlockingHit;
+	}
+
+	/** Same as GeomSweepSingle/GeomSweepTest */
+	bool SweepScenes(const PxTransform& PStartTM, const PxVec3& PDir, float DeltaMag, PxSweepHit& PHit, FPxQueryFilterCallbackSweep& PQueryCallback) const
+	{
+		bool bHaveBlockingHit = SyncScene->sweepSingle(*PGeom, PStartTM, PDir, DeltaMag, POutputFlags, PHit, PQueryFilterData, &PQueryCallback);
+
+		if (AsyncScene && (OutHits || !bHaveBlockingHit))
+		{
+			PxSweepHit PHitAsync;
+			const bool bHaveBlockingHitAsync = AsyncScene->sweepSingle(*PGeom, PStartTM, PDir, DeltaMag, POutputFlags, PHitAsync, PQueryFilterData, &PQueryCallback);
+			if (bHaveBlockingHitAsync && (!bHaveBlockingHit || PHitAsync.distance < PHit.distance))
+			{
+				PHit = PHitAsync;
+				bHaveBlockingHit = true;
+			}
+		}
+
+		return bHaveBlockingHit;
+	}
+};
+
+/** Runs a range of a scene query batch on a worker thread */
+class FSceneQueryBatchTask
+{
+	const FSceneQueryBatch& Batch;
+	int32 StartIndex;
+	int32 EndIndex;
+	int32& OutNumBlockingHits;
+
+public:
+	FSceneQueryBatchTask(const FSceneQueryBatch& InBatch, int32 InStartIndex, int32 InEndIndex, int32& InOutNumBlockingHits)
+		: Batch(InBatch)
+		, StartIndex(InStartIndex)
+		, EndIndex(InEndIndex)
+		, OutNumBlockingHits(InOutNumBlockingHits)
+	{
+	}
+
+	FORCEINLINE TStatId GetStatId() const
+	{
+		RETURN_QUICK_DECLARE_CYCLE_STAT(FSceneQueryBatchTask, STATGROUP_TaskGraphTasks);
+	}
+
+	static ENamedThreads::Type GetDesiredThread()
+	{
+		return ENamedThreads::AnyThread;
+	}
+
+	static ESubsequentsMode::Type GetSubsequentsMode()
+	{
+		return ESubsequentsMode::TrackSubsequents;
+	}
+
+	void DoTask(ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+	{
+		OutNumBlockingHits = Batch.Run(StartIndex, EndIndex);
+	}
+};
+
+/** Runs every query of the batch, splitting large batches issued from the game thread across task graph threads */
+static int32 RunSceneQueryBatch(const FSceneQueryBatch& Batch, int32 NumQueries)
+{
+	if (NumQueries <= SceneQueriesPerTask || !IsInGameThread() || !FApp::ShouldUseThreadingForPerformance() || !CVarParallelSceneQueryBatch.GetValueOnGameThread())
+	{
+		return Batch.Run(0, NumQueries);
+	}
+
+	// Results are written by query index, so each task only needs to report how many blocking hits it found
+	const int32 NumTasks = FMath::DivideAndRoundUp(NumQueries, SceneQueriesPerTask);
+	TArray<int32, TInlineAllocator<16> > TaskNumBlockingHits;
+	TaskNumBlockingHits.AddZeroed(NumTasks);
+
+	FGraphEventArray QueryEvents;
+	for (int32 TaskIndex = 1; TaskIndex < NumTasks; TaskIndex++)
+	{
+		const int32 StartIndex = TaskIndex * SceneQueriesPerTask;
+		const int32 EndIndex = FMath::Min(StartIndex + SceneQueriesPerTask, NumQueries);
+		QueryEvents.Add(TGraphTask<FSceneQueryBatchTask>::CreateTask(nullptr, ENamedThreads::GameThread).ConstructAndDispatchWhenReady(Batch, StartIndex, EndIndex, TaskNumBlockingHits[TaskIndex]));
+	}
+
+	// put the game thread to work on the first range while the workers do the rest
+	TaskNumBlockingHits[0] = Batch.Run(0, SceneQueriesPerTask);
+
+	FTaskGraphInterface::Get().WaitUntilTasksComplete(QueryEvents, ENamedThreads::GameThread_Local);
+
+	int32 NumBlockingHits = 0;
+	for (int32 TaskIndex = 0; TaskIndex < NumTasks; TaskIndex++)
+	{
+		NumBlockingHits += TaskNumBlockingHits[TaskIndex];
+	}
+	return NumBlockingHits;
+}
+
+#endif // WITH_PHYSX
+
+int32 SceneQueryBatch(const UWorld* World, const struct FCollisionShape& CollisionShape, const FQuat& Rot, const TArray<FVector>& Starts, const TArray<FVector>& Ends, ECollisionChannel TraceChannel, const struct FCollisionQueryParams& Params, const struct FCollisionResponseParams& ResponseParams, const struct FCollisionObjectQueryParams& ObjectParams, TArray<struct FHitResult>* OutHits, TArray<bool>* OutBlockingHits)
+{
+	check(Starts.Num() == Ends.Num());
+	check((OutHits != NULL) != (OutBlockingHits != NULL));
+
+	SCOPE_CYCLE_COUNTER(STAT_Collision_SceneQueryBatch);
+
+	const int32 NumQueries = Starts.Num();
+	INC_DWORD_STAT_BY(STAT_Collision_SceneQueryBatchQueries, NumQueries);
+
+	if (OutHits)
+	{
+		OutHits->Reset(NumQueries);
+		OutHits->AddDefaulted(NumQueries);
+		for (int32 QueryIndex = 0; QueryIndex < NumQueries; QueryIndex++)
+		{
+			(*OutHits)[QueryIndex].TraceStart = Starts[QueryIndex];
+			(*OutHits)[QueryIndex].TraceEnd = Ends[QueryIndex];
+		}
+	}
+	else
+	{
+		OutBlockingHits->Init(false, NumQueries);
+	}
+
+	if ((NumQueries == 0) || (World == NULL) || (World->GetPhysicsScene() == NULL))
+	{
+		return 0;
+	}
+
+	const bool bIsRaycast = CollisionShape.IsNearlyZero();
+
+	if (ShouldRunSceneQueriesSerially(World, Params, bIsRaycast))
+	{
+		int32 NumBlockingHits = 0;
+		for (int32 QueryIndex = 0; QueryIndex < NumQueries; QueryIndex++)
+		{
+			bool bHaveBlockingHit;
+			if (OutHits)
+			{
+				FHitResult& OutHit = (*OutHits)[QueryIndex];
+				bHaveBlockingHit = bIsRaycast
+					? RaycastSingle(World, OutHit, Starts[QueryIndex], Ends[QueryIndex], TraceChannel, Params, ResponseParams, ObjectParams)
+					: GeomSweepSingle(World, CollisionShape, Rot, OutHit, Starts[QueryIndex], Ends[QueryIndex], TraceChannel, Params, ResponseParams, ObjectParams);
+			}
+			else
+			{
+				bHaveBlockingHit = bIsRaycast
+					? RaycastTest(World, Starts[QueryIndex], Ends[QueryIndex], TraceChannel, Params, ResponseParams, ObjectParams)
+					: GeomSweepTest(World, CollisionShape, Rot, Starts[QueryIndex], Ends[QueryIndex], TraceChannel, Params, ResponseParams, ObjectParams);
+				(*OutBlockingHits)[QueryIndex] = bHaveBlockingHit;
+			}
+			NumBlockingHits += bHaveBlockingHit ? 1 : 0;
+		}
+		return NumBlockingHits;
+	}
+
+#if WITH_PHYSX
+	FSceneQueryBatch Batch(Starts, Ends, Params);
+	Batch.OutHits = OutHits ? OutHits->GetData() : NULL;
+	Batch.OutBlockingHits = OutBlockingHits ? OutBlockingHits->GetData() : NULL;
+
+	// Create filter data used to filter collisions, once for the whole batch
+	Batch.PFilter = CreateQueryFilterData(TraceChannel, Params.bTraceComplex, ResponseParams.CollisionResponse, ObjectParams, false);
+
+	PxSceneQueryFilterFlags PFilterFlags = PxSceneQueryFilterFlag::eSTATIC | PxSceneQueryFilterFlag::eDYNAMIC | PxSceneQueryFilterFlag::ePREFILTER;
+	if (!bIsRaycast && !OutHits)
+	{
+		// GeomSweepTest relies on the post filter to discard initial overlaps
+		PFilterFlags |= PxSceneQueryFilterFlag::ePOSTFILTER;
+	}
+	Batch.PQueryFilterData = PxSceneQueryFilterData(Batch.PFilter, PFilterFlags);
+	Batch.POutputFlags = OutHits ? (PxSceneQueryFlag::ePOSITION | PxSceneQueryFlag::eNORMAL | PxSceneQueryFlag::eDISTANCE | PxSceneQueryFlag::eMTD) : PxSceneQueryFlags();
+
+	FPhysScene* PhysScene = World->GetPhysicsScene();
+	Batch.SyncScene = PhysScene->GetPhysXScene(PST_Sync);
+	if (Params.bTraceAsyncScene && PhysScene->HasAsyncScene())
+	{
+		Batch.AsyncScene = PhysScene->GetPhysXScene(PST_Async);
+	}
+
+	if (bIsRaycast)
+	{
+		return RunSceneQueryBatch(Batch, NumQueries);
+	}
+
+	FPhysXShapeAdaptor ShapeAdaptor(Rot, CollisionShape);
+	Batch.PGeom = &ShapeAdaptor.GetGeometry();
+	Batch.PGeomRot = ShapeAdaptor.GetGeomOrientation();
+	return RunSceneQueryBatch(Batch, NumQueries);
+#else
+	return 0;
+#endif // WITH_PHYSX
+}
+
 #endif //UE_WITH_PHYSICS
 
 //////////////////////////////////////////////////////////////////////////
@@ -194,6 +194,16 @@ bool GeomSweepSingle(const UWorld* World, const struct FCollisionShape& Collisio
 /** Function for sweeping a supplied PxGeometry against the world */
 bool GeomSweepMulti(const UWorld* World, const struct FCollisionShape& CollisionShape, const FQuat& Rot, TArray<FHitResult>& OutHits, FVector Start, FVector End, ECollisionChannel TraceChannel, const struct FCollisionQueryParams& Params, const struct FCollisionResponseParams& ResponseParams, const struct FCollisionObjectQueryParams& ObjectParams = FCollisionObjectQueryParams::DefaultObjectQueryParam);
 
+// BATCHED QUERIES
+
+/**
+ * Trace rays (when CollisionShape is a line) or sweep a shape for each Starts/Ends pair, sharing filter data and params across the batch.
+ * Exactly one of OutHits or OutBlockingHits should be supplied; it is resized to the number of queries and element i receives the result of query i,
+ * as returned by RaycastSingle/GeomSweepSingle or RaycastTest/GeomSweepTest.
+ * @return Number of queries with a blocking hit
+ */
+int32 SceneQueryBatch(const UWorld* World, const struct FCollisionShape& CollisionShape, const FQuat& Rot, const TArray<FVector>& Starts, const TArray<FVector>& Ends, ECollisionChannel TraceChannel, const struct FCollisionQueryParams& Params, const struct FCollisionResponseParams& ResponseParams, const struct FCollisionObjectQueryParams& ObjectParams, TArray<struct FHitResult>* OutHits, TArray<bool>* OutBlockingHits);
+
 #endif
 
 // Note: Do not use these methods for new code, they are being phased out!
@@ -37,6 +37,8 @@ DEFINE_STAT(STAT_Collision_GeomOverlapAny);
 DEFINE_STAT(STAT_Collision_GeomOverlapSingle);
 DEFINE_STAT(STAT_Collision_GeomOverlapMultiple);
 DEFINE_STAT(STAT_Collision_GeomComputePenetration);
+DEFINE_STAT(STAT_Collision_SceneQueryBatch);
+DEFINE_STAT(STAT_Collision_SceneQueryBatchQueries);
 
 /** default collision response container - to be used without reconstructing every time**/
 FCollisionResponseContainer FCollisionResponseContainer::DefaultResponseContainer(ECR_Block);
@@ -149,6 +151,66 @@ bool UWorld::SweepMulti(TArray<FHitResult>& OutHits, const FVector& Start, const
 	}
 }
 
+int32 UWorld::BatchLineTraceTest(const TArray<FVector>& Starts, const TArray<FVector>& Ends, ECollisionChannel TraceChannel, const struct FCollisionQueryParams& Params, const struct FCollisionResponseParams& ResponseParam, TArray<bool>& OutBlockingHits) const
+{
+#if UE_WITH_PHYSICS
+	return SceneQueryBatch(this, FCollisionShape::LineShape, FQuat::Identity, Starts, Ends, TraceChannel, Params, ResponseParam, FCollisionObjectQueryParams::DefaultObjectQueryParam, NULL, &OutBlockingHits);
+#else
+	OutBlockingHits.Init(false, Starts.Num());
+	return 0;
+#endif
+}
+
+int32 UWorld::BatchLineTraceSingle(const TArray<FVector>& Starts, const TArray<FVector>& Ends, ECollisionChannel TraceChannel, const struct FCollisionQueryParams& Params, const struct FCollisionResponseParams& ResponseParam, TArray<struct FHitResult>& OutHits) const
+{
+#if UE_WITH_PHYSICS
+	return SceneQueryBatch(this, FCollisionShape::LineShape, FQuat::Identity, Starts, Ends, TraceChannel, Params, ResponseParam, FCollisionObjectQueryParams::DefaultObjectQueryParam, &OutHits, NULL);
+#else
+	OutHits.Reset(Starts.Num());
+	for (int32 QueryIndex = 0; QueryIndex < Starts.Num(); ++QueryIndex)
+	{
+		FHitResult& OutHit = OutHits[OutHits.AddDefaulted()];
+		OutHit.TraceStart = Starts[QueryIndex];
+		OutHit.TraceEnd = Ends[QueryIndex];
+	}
+	return 0;
+#endif
+}
+
+int32 UWorld::BatchSweepTest(const TArray<FVector>& Starts, const TArray<FVector>& Ends, const FQuat& Rot, ECollisionChannel TraceChannel, const struct FCollisionShape& CollisionShape, const struct FCollisionQueryParams& Params, const struct FCollisionResponseParams& ResponseParam, TArray<bool>& OutBlockingHits) const
+{
+	if (CollisionShape.IsNearlyZero())
+	{
+		// if extent is 0, we'll just do linetraces instead
+		return BatchLineTraceTest(Starts, Ends, TraceChannel, Params, ResponseParam, OutBlockingHits);
+	}
+	else
+	{
+#if UE_WITH_PHYSICS
+		return SceneQueryBatch(this, CollisionShape, Rot, Starts, Ends, TraceChannel, Params, ResponseParam, FCollisionObjectQueryParams::DefaultObjectQueryParam, NULL, &OutBlockingHits);
+#else
+		OutBlockingHits.Init(false, Starts.Num());
+		return 0;
+#endif
+	}
+}
+
+int32 UWorld::BatchSweepSingle(const TArray<FVector>& Starts, const TArray<FVector>& Ends, const FQuat& Rot, ECollisionChannel TraceChannel, const struct FCollisionShape& CollisionShape, const struct FCollisionQueryParams& Params, const struct FCollisionResponseParams& ResponseParam, TArray<struct FHitResult>& OutHits) const
+{
+	if (CollisionShape.IsNearlyZero())
+	{
+		return BatchLineTraceSingle(Starts, Ends, TraceChannel, Params, ResponseParam, OutHits);
+	}
+	else
+	{
+#if UE_WITH_PHYSICS
+		return SceneQueryBatch(this, CollisionShape, Rot, Starts, Ends, TraceChannel, Params, ResponseParam, FCollisionObjectQueryParams::DefaultObjectQueryParam, &OutHits, NULL);
+#else
+		return BatchLineTraceSingle(Starts, Ends, TraceChannel, Params, ResponseParam, OutHits);
+#endif
+	}
+}
+
 bool UWorld::OverlapTest(const FVector& Pos, const FQuat& Rot, ECollisionChannel TraceChannel, const struct FCollisionShape& CollisionShape, const struct FCollisionQueryParams& Params, const struct FCollisionResponseParams& ResponseParam) const
 {
 #if UE_WITH_PHYSICS
@@ -1612,10 +1612,33 @@ void FMaterialShaderMap::Serialize(FArchive& Ar, bool bInlineShaderResources)
 
 	Ar << DebugDescription;
 
+	// Shaders for different vertex factories and permutations frequently compile to the same code.
+	// Store each shader resource used by the map once, ahead of the shaders, instead of inline with every shader that uses it.
+	// The array keeps the loaded resources registered while the shaders that reference them are loaded.
+	TArray<TRefCountPtr<FShaderResource> > ShaderResources;
+
+	if (bInlineShaderResources)
+	{
+		if (Ar.IsSaving())
+		{
+			GetShaderResources(ShaderResources);
+
+			for (int32 MapIndex = 0; MapIndex < MeshShaderMaps.Num(); MapIndex++)
+			{
+				MeshShaderMaps[MapIndex].GetShaderResources(ShaderResources);
+			}
+		}
+
+		FShaderResource::SerializeShaderResources(Ar, ShaderResources);
+	}
+
+	// The resources have been serialized above, so the shaders only need to reference them
+	const bool bInlineResourcesWithShaders = false;
+
 	if (Ar.IsSaving())
 	{
 		// Material shaders
-		TShaderMap<FMaterialShaderType>::SerializeInline(Ar, bInlineShaderResources, false);
+		TShaderMap<FMaterialShaderType>::SerializeInline(Ar, bInlineResourcesWithShaders, false);
 
 		// Mesh material shaders
 		int32 NumMeshShaderMaps = 0;
@@ -1655,7 +1678,7 @@ void FMaterialShaderMap::Serialize(FArchive& Ar, bool bInlineShaderResources)
 
 				Ar << VFType;
 
-				MeshShaderMap->SerializeInline(Ar, bInlineShaderResources, false);
+				MeshShaderMap->SerializeInline(Ar, bInlineResourcesWithShaders, false);
 			}
 		}
 	}
@@ -1679,7 +1702,7 @@ void FMaterialShaderMap::Serialize(FArchive& Ar, bool bInlineShaderResources)
 		InitOrderedMeshShaderMaps();
 
 		// Material shaders
-		TShaderMap<FMaterialShaderType>::SerializeInline(Ar, bInlineShaderResources, false);
+		TShaderMap<FMaterialShaderType>::SerializeInline(Ar, bInlineResourcesWithShaders, false);
 
 		// Mesh material shaders
 		int32 NumMeshShaderMaps = 0;
@@ -1696,7 +1719,7 @@ void FMaterialShaderMap::Serialize(FArchive& Ar, bool bInlineShaderResources)
 			check(VFType);
 			FMeshMaterialShaderMap* MeshShaderMap = OrderedMeshShaderMaps[VFType->GetId()];
 			check(MeshShaderMap);
-			MeshShaderMap->SerializeInline(Ar, bInlineShaderResources, false);
+			MeshShaderMap->SerializeInline(Ar, bInlineResourcesWithShaders, false);
 		}
 
 		// Trim the mesh shader maps by removing empty entries
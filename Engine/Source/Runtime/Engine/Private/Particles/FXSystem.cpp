@@ -90,7 +90,9 @@ namespace FXConsoleVariables
 	FAutoConsoleVariableRef CVarAllowAsyncTick(
 		TEXT("FX.AllowAsyncTick"),
 		bAllowAsyncTick,
-		TEXT("allow parallel ticking of particle systems."),
+		TEXT("If 1, the emitters of particle systems that can tick in any thread are simulated on task graph workers, concurrently across components.\n")
+		TEXT("Events, collisions and dynamic data submission are still finalized on the game thread.\n")
+		TEXT("If 0, particle systems are simulated on the game thread."),
 		ECVF_Cheat
 		);
 	FAutoConsoleVariableRef CVarParticleSlackGPU(
@@ -3896,12 +3896,14 @@ void UParticleSystemComponent::TickComponent(float DeltaTime, enum ELevelTick Ti
 	BurstEvents.Empty();
 	TotalActiveParticles = 0;
 	bNeedsFinalize = true;
-	if (!ThisTickFunction || !CanTickInAnyThread() || FXConsoleVariables::bFreezeParticleSimulation || !FXConsoleVariables::bAllowAsyncTick)
+	if (!ThisTickFunction || !CanTickInAnyThread() || FXConsoleVariables::bFreezeParticleSimulation || !FXConsoleVariables::bAllowAsyncTick ||
+		!FApp::ShouldUseThreadingForPerformance())
 	{
 		bDisallowAsync = true;
 	}
 	if (bDisallowAsync)
 	{
+		INC_DWORD_STAT(STAT_ParticleSystemsTickedSync);
 		if (!FXConsoleVariables::bFreezeParticleSimulation)
 		{
 			ComputeTickComponent_Concurrent();
@@ -3910,6 +3912,8 @@ void UParticleSystemComponent::TickComponent(float DeltaTime, enum ELevelTick Ti
 	}
 	else
 	{
+		INC_DWORD_STAT(STAT_ParticleSystemsTickedAsync);
+
 		// set up async task and the game thread task to finalize the results.
 		DECLARE_CYCLE_STAT(TEXT("FSimpleDelegateGraphTask.AsyncParticleTick"),
 			STAT_FSimpleDelegateGraphTask_AsyncParticleTick,
@@ -3950,6 +3954,7 @@ int32 UParticleSystemComponent::GetCurrentDetailMode() const
 void UParticleSystemComponent::ComputeTickComponent_Concurrent()
 {
 	SCOPE_CYCLE_COUNTER(STAT_ParticleComputeTickTime);
+	CONDITIONAL_SCOPE_CYCLE_COUNTER(STAT_ParticleAsyncTime, !IsInGameThread());
 	FScopeCycleCounterUObject AdditionalScope(AdditionalStatObject());
 	// Tick Subemitters.
 	int32 EmitterIndex;
@@ -4125,6 +4130,7 @@ void UParticleSystemComponent::WaitForAsyncAndFinalize(EForceAsyncWorkCompletion
 	{
 		check(IsInGameThread());
 		SCOPE_CYCLE_COUNTER(STAT_GTSTallTime);
+		SCOPE_CYCLE_COUNTER(STAT_ParticleAsyncWaitTime);
 		double StartTime = FPlatformTime::Seconds();
 		FTaskGraphInterface::Get().WaitUntilTaskCompletes(AsyncWork, ENamedThreads::GameThread_Local);
 		float ThisTime = float(FPlatformTime::Seconds() - StartTime) * 1000.0f;
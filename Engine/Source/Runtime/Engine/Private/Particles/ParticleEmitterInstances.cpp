@@ -54,8 +54,12 @@ DEFINE_STAT(STAT_ParticleSetTemplateTime);
 DEFINE_STAT(STAT_ParticleInitializeTime);
 DEFINE_STAT(STAT_ParticleActivateTime);
 DEFINE_STAT(STAT_ParticleUpdateBounds);
+DEFINE_STAT(STAT_ParticleStreamUpdateTime);
+DEFINE_STAT(STAT_ParticleStreamUpdated);
 DEFINE_STAT(STAT_ParticleAsyncTime);
 DEFINE_STAT(STAT_ParticleAsyncWaitTime);
+DEFINE_STAT(STAT_ParticleSystemsTickedAsync);
+DEFINE_STAT(STAT_ParticleSystemsTickedSync);
 
 
 
@@ -182,6 +186,16 @@ FParticleEmitterBuildInfo::FParticleEmitterBuildInfo()
 /*-----------------------------------------------------------------------------
 	FParticleEmitterInstance
 -----------------------------------------------------------------------------*/
+static TAutoConsoleVariable<int32> CVarParticleStreamUpdate(
+	TEXT("FX.ParticleStreamUpdate"),
+	1,
+	TEXT("If 1, CPU emitters update particles with a structure of arrays copy for the modules supporting it (acceleration, drag, color over life, size multiply life, velocity over life).\n")
+	TEXT("If 0, every module updates the particles in place."),
+	ECVF_Default);
+
+/** Emitters with fewer active particles than this always update them in place */
+static const int32 ParticleStreamUpdateMinParticles = 16;
+
 // Only update the PeakActiveParticles if the frame rate is 20 or better
 const float FParticleEmitterInstance::PeakActiveParticleUpdateDelta = 0.05f;
 
@@ -822,15 +836,48 @@ void FParticleEmitterInstance::Tick_ModuleUpdate(float DeltaTime, UParticleLODLe
 {
 	UParticleLODLevel* HighestLODLevel = SpriteTemplate->LODLevels[0];
 	check(HighestLODLevel);
+
+	// Consecutive modules supporting it update a structure of arrays copy of the particles, which is written back before any other module runs
+	const bool bAllowStreamUpdate = (ActiveParticles >= ParticleStreamUpdateMinParticles) && (CVarParticleStreamUpdate.GetValueOnAnyThread() != 0);
+	FMemMark Mark(FMemStack::Get());
+	FParticleStreams Streams;
+	bool bStreamsGathered = false;
+
 	for (int32 ModuleIndex = 0; ModuleIndex < InCurrentLODLevel->UpdateModules.Num(); ModuleIndex++)
 	{
 		UParticleModule* CurrentModule = InCurrentLODLevel->UpdateModules[ModuleIndex];
 		if (CurrentModule && CurrentModule->bEnabled && CurrentModule->bUpdateModule)
 		{
+			if (bAllowStreamUpdate && CurrentModule->CanUpdateStreams(this))
+			{
+				SCOPE_CYCLE_COUNTER(STAT_ParticleStreamUpdateTime);
+				if (!bStreamsGathered)
+				{
+					Streams.Gather(FMemStack::Get(), ParticleData, ParticleStride, ParticleIndices, ActiveParticles);
+					bStreamsGathered = true;
+				}
+				CurrentModule->UpdateStreams(this, Streams, DeltaTime);
+				INC_DWORD_STAT_BY(STAT_ParticleStreamUpdated, ActiveParticles);
+				continue;
+			}
+
+			if (bStreamsGathered)
+			{
+				SCOPE_CYCLE_COUNTER(STAT_ParticleStreamUpdateTime);
+				Streams.Scatter(ParticleData, ParticleStride, ParticleIndices);
+				bStreamsGathered = false;
+			}
+
 			uint32* Offset = ModuleOffsetMap.Find(HighestLODLevel->UpdateModules[ModuleIndex]);
 			CurrentModule->Update(this, Offset ? *Offset : 0, DeltaTime);
 		}
 	}
+
+	if (bStreamsGathered)
+	{
+		SCOPE_CYCLE_COUNTER(STAT_ParticleStreamUpdateTime);
+		Streams.Scatter(ParticleData, ParticleStride, ParticleIndices);
+	}
 }
 
 /**
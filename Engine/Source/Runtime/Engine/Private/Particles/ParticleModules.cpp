@@ -2274,6 +2274,27 @@ void UParticleModuleAccelerationConstant::Update(FParticleEmitterInstance* Owner
 	}
 }
 
+bool UParticleModuleAccelerationConstant::CanUpdateStreams(FParticleEmitterInstance* Owner)
+{
+	return true;
+}
+
+void UParticleModuleAccelerationConstant::UpdateStreams(FParticleEmitterInstance* Owner, FParticleStreams& Streams, float DeltaTime)
+{
+	UParticleLODLevel* LODLevel	= Owner->SpriteTemplate->GetCurrentLODLevel(Owner);
+	check(LODLevel);
+	FVector LocalAcceleration = Acceleration;
+	if (bAlwaysInWorldSpace && LODLevel->RequiredModule->bUseLocalSpace)
+	{
+		LocalAcceleration = Owner->Component->ComponentToWorld.InverseTransformVector(Acceleration);
+	}
+	else if (LODLevel->RequiredModule->bUseLocalSpace)
+	{
+		LocalAcceleration = Owner->EmitterToSimulation.TransformVector(Acceleration);
+	}
+	Streams.AddVelocity(LocalAcceleration * DeltaTime);
+}
+
 /*-----------------------------------------------------------------------------
 	ParticleModuleAccelerationDrag implementation.
 -----------------------------------------------------------------------------*/
@@ -2342,6 +2363,20 @@ void UParticleModuleAccelerationDrag::Update(FParticleEmitterInstance* Owner, in
 	END_UPDATE_LOOP;
 }
 
+bool UParticleModuleAccelerationDrag::CanUpdateStreams(FParticleEmitterInstance* Owner)
+{
+	return DragCoefficient != NULL;
+}
+
+void UParticleModuleAccelerationDrag::UpdateStreams(FParticleEmitterInstance* Owner, FParticleStreams& Streams, float DeltaTime)
+{
+	for (int32 i = 0; i < Streams.NumParticles; i++)
+	{
+		Streams.Scratch[0][i] = DragCoefficient->GetValue(Streams.RelativeTime[i], Owner->Component);
+	}
+	Streams.ApplyDrag(DeltaTime);
+}
+
 /*-----------------------------------------------------------------------------
 	ParticleModuleAccelerationDragScaleOverLife implementation.
 -----------------------------------------------------------------------------*/
@@ -413,6 +413,27 @@ void UParticleModuleColorOverLife::Update(FParticleEmitterInstance* Owner, int32
 	}
 }
 
+bool UParticleModuleColorOverLife::CanUpdateStreams(FParticleEmitterInstance* Owner)
+{
+	return ColorOverLife.GetFastRawDistribution() && AlphaOverLife.GetFastRawDistribution();
+}
+
+void UParticleModuleColorOverLife::UpdateStreams(FParticleEmitterInstance* Owner, FParticleStreams& Streams, float DeltaTime)
+{
+	const FRawDistribution* FastColorOverLife = ColorOverLife.GetFastRawDistribution();
+	const FRawDistribution* FastAlphaOverLife = AlphaOverLife.GetFastRawDistribution();
+	check(FastColorOverLife && FastAlphaOverLife);
+	for (int32 i = 0; i < Streams.NumParticles; i++)
+	{
+		FVector ColorVec;
+		FastColorOverLife->GetValue3None(Streams.RelativeTime[i], &ColorVec.X);
+		FastAlphaOverLife->GetValue1None(Streams.RelativeTime[i], &Streams.Color[3][i]);
+		Streams.Color[0][i] = ColorVec.X;
+		Streams.Color[1][i] = ColorVec.Y;
+		Streams.Color[2][i] = ColorVec.Z;
+	}
+}
+
 void UParticleModuleColorOverLife::SetToSensibleDefaults(UParticleEmitter* Owner)
 {
 	ColorOverLife.Distribution = Cast<UDistributionVectorConstantCurve>(StaticConstructObject(UDistributionVectorConstantCurve::StaticClass(), this));
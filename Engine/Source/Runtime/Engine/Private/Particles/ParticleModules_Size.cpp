@@ -299,6 +299,32 @@ void UParticleModuleSizeMultiplyLife::Update(FParticleEmitterInstance* Owner, in
 	}
 }
 
+bool UParticleModuleSizeMultiplyLife::CanUpdateStreams(FParticleEmitterInstance* Owner)
+{
+	return true;
+}
+
+void UParticleModuleSizeMultiplyLife::UpdateStreams(FParticleEmitterInstance* Owner, FParticleStreams& Streams, float DeltaTime)
+{
+	const FRawDistribution* FastDistribution = LifeMultiplier.GetFastRawDistribution();
+	for (int32 i = 0; i < Streams.NumParticles; i++)
+	{
+		FVector SizeScale;
+		if (FastDistribution)
+		{
+			FastDistribution->GetValue3None(Streams.RelativeTime[i], &SizeScale.X);
+		}
+		else
+		{
+			SizeScale = LifeMultiplier.GetValue(Streams.RelativeTime[i], Owner->Component);
+		}
+		Streams.Scratch[0][i] = SizeScale.X;
+		Streams.Scratch[1][i] = SizeScale.Y;
+		Streams.Scratch[2][i] = SizeScale.Z;
+	}
+	Streams.MultiplySize(MultiplyX, MultiplyY, MultiplyZ);
+}
+
 void UParticleModuleSizeMultiplyLife::SetToSensibleDefaults(UParticleEmitter* Owner)
 {
 	LifeMultiplier.Distribution = Cast<UDistributionVectorConstantCurve>(StaticConstructObject(UDistributionVectorConstantCurve::StaticClass(), this));
@@ -372,6 +372,43 @@ void UParticleModuleVelocityOverLifetime::Update(FParticleEmitterInstance* Owner
 	}
 }
 
+bool UParticleModuleVelocityOverLifetime::CanUpdateStreams(FParticleEmitterInstance* Owner)
+{
+	return true;
+}
+
+void UParticleModuleVelocityOverLifetime::UpdateStreams(FParticleEmitterInstance* Owner, FParticleStreams& Streams, float DeltaTime)
+{
+	check(Owner && Owner->Component);
+	UParticleLODLevel* LODLevel	= Owner->SpriteTemplate->GetCurrentLODLevel(Owner);
+	check(LODLevel);
+	FVector OwnerScale(1.0f);
+	if (bApplyOwnerScale == true)
+	{
+		OwnerScale = Owner->Component->ComponentToWorld.GetScale3D();
+	}
+
+	// Same spaces as Update: the sampled velocity is either used as is, moved to world space or moved to the local space of the emitter
+	FMatrix Transform = FMatrix::Identity;
+	if (LODLevel->RequiredModule->bUseLocalSpace == false && bInWorldSpace == false)
+	{
+		Transform = Owner->Component->ComponentToWorld.ToMatrixNoScale();
+	}
+	else if (LODLevel->RequiredModule->bUseLocalSpace == true && bInWorldSpace == true)
+	{
+		Transform = Owner->Component->ComponentToWorld.ToMatrixNoScale().InverseFast();
+	}
+
+	for (int32 i = 0; i < Streams.NumParticles; i++)
+	{
+		const FVector Vel = VelOverLife.GetValue(Streams.RelativeTime[i], Owner->Component);
+		Streams.Scratch[0][i] = Vel.X;
+		Streams.Scratch[1][i] = Vel.Y;
+		Streams.Scratch[2][i] = Vel.Z;
+	}
+	Streams.SetVelocity(Transform, OwnerScale, !Absolute);
+}
+
 /*-----------------------------------------------------------------------------
 	UParticleModuleVelocityCone implementation.
 -----------------------------------------------------------------------------*/
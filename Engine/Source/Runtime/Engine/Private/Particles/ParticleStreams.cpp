@@ -0,0 +1,168 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+	ParticleStreams.cpp: Structure of arrays particle update kernels.
+=============================================================================*/
+
+#include "EnginePrivate.h"
+#include "ParticleDefinitions.h"
+
+/** Number of float streams allocated by FParticleStreams::Gather */
+static const int32 NumParticleStreams = 1 + 3 + 3 + 3 + 4 + 3;
+
+FParticleStreams::FParticleStreams()
+	: NumParticles(0)
+	, Capacity(0)
+	, RelativeTime(NULL)
+{
+	FMemory::Memzero(Velocity, sizeof(Velocity));
+	FMemory::Memzero(BaseVelocity, sizeof(BaseVelocity));
+	FMemory::Memzero(Size, sizeof(Size));
+	FMemory::Memzero(Color, sizeof(Color));
+	FMemory::Memzero(Scratch, sizeof(Scratch));
+}
+
+void FParticleStreams::Gather(FMemStackBase& MemStack, const uint8* ParticleData, uint32 ParticleStride, const uint16* ParticleIndices, int32 InNumParticles)
+{
+	// Modules running between two gathers may have killed particles, so the streams only need to be reallocated when they grew
+	if (RelativeTime == NULL || InNumParticles > Capacity)
+	{
+		const int32 NumPadded = Align(InNumParticles, 4);
+		Capacity = NumPadded;
+
+		// All the streams live in one block, zeroed so the padding never holds NaNs or denormals
+		float* Block = (float*)MemStack.PushBytes(NumParticleStreams * NumPadded * sizeof(float), 16);
+		FMemory::Memzero(Block, NumParticleStreams * NumPadded * sizeof(float));
+
+		RelativeTime = Block;
+		Block += NumPadded;
+		for (int32 Axis = 0; Axis < 3; Axis++)
+		{
+			Velocity[Axis] = Block;
+			BaseVelocity[Axis] = Block + NumPadded;
+			Size[Axis] = Block + 2 * NumPadded;
+			Scratch[Axis] = Block + 3 * NumPadded;
+			Block += 4 * NumPadded;
+		}
+		for (int32 Channel = 0; Channel < 4; Channel++)
+		{
+			Color[Channel] = Block;
+			Block += NumPadded;
+		}
+	}
+	NumParticles = InNumParticles;
+
+	for (int32 i = 0; i < NumParticles; i++)
+	{
+		const FBaseParticle& Particle = *((const FBaseParticle*)(ParticleData + ParticleIndices[i] * ParticleStride));
+		RelativeTime[i] = Particle.RelativeTime;
+		Velocity[0][i] = Particle.Velocity.X;
+		Velocity[1][i] = Particle.Velocity.Y;
+		Velocity[2][i] = Particle.Velocity.Z;
+		BaseVelocity[0][i] = Particle.BaseVelocity.X;
+		BaseVelocity[1][i] = Particle.BaseVelocity.Y;
+		BaseVelocity[2][i] = Particle.BaseVelocity.Z;
+		Size[0][i] = Particle.Size.X;
+		Size[1][i] = Particle.Size.Y;
+		Size[2][i] = Particle.Size.Z;
+		Color[0][i] = Particle.Color.R;
+		Color[1][i] = Particle.Color.G;
+		Color[2][i] = Particle.Color.B;
+		Color[3][i] = Particle.Color.A;
+	}
+}
+
+void FParticleStreams::Scatter(uint8* ParticleData, uint32 ParticleStride, const uint16* ParticleIndices) const
+{
+	for (int32 i = 0; i < NumParticles; i++)
+	{
+		FBaseParticle& Particle = *((FBaseParticle*)(ParticleData + ParticleIndices[i] * ParticleStride));
+		if ((Particle.Flags & STATE_Particle_Freeze) == 0)
+		{
+			Particle.Velocity = FVector(Velocity[0][i], Velocity[1][i], Velocity[2][i]);
+			Particle.BaseVelocity = FVector(BaseVelocity[0][i], BaseVelocity[1][i], BaseVelocity[2][i]);
+			Particle.Size = FVector(Size[0][i], Size[1][i], Size[2][i]);
+			Particle.Color = FLinearColor(Color[0][i], Color[1][i], Color[2][i], Color[3][i]);
+		}
+	}
+}
+
+void FParticleStreams::AddVelocity(const FVector& DeltaVelocity)
+{
+	for (int32 Axis = 0; Axis < 3; Axis++)
+	{
+		const VectorRegister VDelta = VectorSetFloat1(DeltaVelocity[Axis]);
+		float* RESTRICT VelocityStream = Velocity[Axis];
+		float* RESTRICT BaseVelocityStream = BaseVelocity[Axis];
+		for (int32 i = 0; i < NumParticles; i += 4)
+		{
+			VectorStoreAligned(VectorAdd(VectorLoadAligned(VelocityStream + i), VDelta), VelocityStream + i);
+			VectorStoreAligned(VectorAdd(VectorLoadAligned(BaseVelocityStream + i), VDelta), BaseVelocityStream + i);
+		}
+	}
+}
+
+void FParticleStreams::ApplyDrag(float DeltaTime)
+{
+	const VectorRegister VNegDeltaTime = VectorSetFloat1(-DeltaTime);
+	const float* RESTRICT Coefficient = Scratch[0];
+	for (int32 i = 0; i < NumParticles; i += 4)
+	{
+		const VectorRegister VScale = VectorMultiply(VectorLoadAligned(Coefficient + i), VNegDeltaTime);
+		for (int32 Axis = 0; Axis < 3; Axis++)
+		{
+			const VectorRegister VVelocity = VectorLoadAligned(Velocity[Axis] + i);
+			const VectorRegister VDrag = VectorMultiply(VVelocity, VScale);
+			VectorStoreAligned(VectorAdd(VVelocity, VDrag), Velocity[Axis] + i);
+			VectorStoreAligned(VectorAdd(VectorLoadAligned(BaseVelocity[Axis] + i), VDrag), BaseVelocity[Axis] + i);
+		}
+	}
+}
+
+void FParticleStreams::MultiplySize(bool bMultiplyX, bool bMultiplyY, bool bMultiplyZ)
+{
+	const bool bMultiply[3] = { bMultiplyX, bMultiplyY, bMultiplyZ };
+	for (int32 Axis = 0; Axis < 3; Axis++)
+	{
+		if (bMultiply[Axis])
+		{
+			float* RESTRICT SizeStream = Size[Axis];
+			const float* RESTRICT ScaleStream = Scratch[Axis];
+			for (int32 i = 0; i < NumParticles; i += 4)
+			{
+				VectorStoreAligned(VectorMultiply(VectorLoadAligned(SizeStream + i), VectorLoadAligned(ScaleStream + i)), SizeStream + i);
+			}
+		}
+	}
+}
+
+void FParticleStreams::SetVelocity(const FMatrix& Transform, const FVector& Scale, bool bMultiply)
+{
+	// Fold the scale into the rows of the transform, Result[Axis] = Sum(Scratch[Row] * Transform.M[Row][Axis]) * Scale[Axis]
+	VectorRegister VRows[3][3];
+	for (int32 Row = 0; Row < 3; Row++)
+	{
+		for (int32 Axis = 0; Axis < 3; Axis++)
+		{
+			VRows[Row][Axis] = VectorSetFloat1(Transform.M[Row][Axis] * Scale[Axis]);
+		}
+	}
+
+	for (int32 i = 0; i < NumParticles; i += 4)
+	{
+		const VectorRegister VX = VectorLoadAligned(Scratch[0] + i);
+		const VectorRegister VY = VectorLoadAligned(Scratch[1] + i);
+		const VectorRegister VZ = VectorLoadAligned(Scratch[2] + i);
+		for (int32 Axis = 0; Axis < 3; Axis++)
+		{
+			VectorRegister VResult = VectorMultiply(VX, VRows[0][Axis]);
+			VResult = VectorMultiplyAdd(VY, VRows[1][Axis], VResult);
+			VResult = VectorMultiplyAdd(VZ, VRows[2][Axis], VResult);
+			if (bMultiply)
+			{
+				VResult = VectorMultiply(VectorLoadAligned(Velocity[Axis] + i), VResult);
+			}
+			VectorStoreAligned(VResult, Velocity[Axis] + i);
+		}
+	}
+}
@@ -0,0 +1,159 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+#include "EnginePrivate.h"
+#include "ParticleDefinitions.h"
+#include "Distributions/DistributionFloatConstant.h"
+#include "Distributions/DistributionVectorConstant.h"
+#include "Particles/ParticleLODLevel.h"
+#include "Particles/ParticleModuleRequired.h"
+#include "Particles/ParticleSpriteEmitter.h"
+#include "Particles/ParticleSystemComponent.h"
+#include "Particles/Acceleration/ParticleModuleAccelerationConstant.h"
+#include "Particles/Acceleration/ParticleModuleAccelerationDrag.h"
+#include "Particles/Color/ParticleModuleColorOverLife.h"
+#include "Particles/Size/ParticleModuleSizeMultiplyLife.h"
+#include "Particles/Velocity/ParticleModuleVelocityOverLifetime.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FParticleStreamsUpdateTest, "Engine.Particles.Stream Update", EAutomationTestFlags::ATF_Editor)
+
+// Runs Module on two copies of the particles of Instance, once with Update and once with UpdateStreams, and checks both give the same particles
+bool ParticleStreamsTest_CompareUpdates(FParticleEmitterInstance& Instance, UParticleModule* Module, const FString& What, FAutomationTestBase* Test)
+{
+	const float DeltaTime = 1.f / 30.f;
+
+	if (!Module->CanUpdateStreams(&Instance))
+	{
+		Test->AddError(FString::Printf(TEXT("%s doesn't support stream updates"), *What));
+		return false;
+	}
+
+	TArray<uint8> StreamData;
+	StreamData.Append(Instance.ParticleData, Instance.ActiveParticles * Instance.ParticleStride);
+
+	Module->Update(&Instance, 0, DeltaTime);
+
+	FMemMark Mark(FMemStack::Get());
+	FParticleStreams Streams;
+	Streams.Gather(FMemStack::Get(), StreamData.GetData(), Instance.ParticleStride, Instance.ParticleIndices, Instance.ActiveParticles);
+	Module->UpdateStreams(&Instance, Streams, DeltaTime);
+	Streams.Scatter(StreamData.GetData(), Instance.ParticleStride, Instance.ParticleIndices);
+
+	for (int32 i = 0; i < Instance.ActiveParticles; i++)
+	{
+		DECLARE_PARTICLE_CONST(Updated, Instance.ParticleData + i * Instance.ParticleStride);
+		DECLARE_PARTICLE_CONST(Streamed, StreamData.GetData() + i * Instance.ParticleStride);
+		if (!Streamed.Velocity.Equals(Updated.Velocity, 1.e-2f) || !Streamed.BaseVelocity.Equals(Updated.BaseVelocity, 1.e-2f) ||
+			!Streamed.Size.Equals(Updated.Size, 1.e-2f) || !Streamed.Color.Equals(Updated.Color, 1.e-3f))
+		{
+			Test->AddError(FString::Printf(TEXT("%s: particle %d differs from the in place update"), *What, i));
+			return false;
+		}
+	}
+	return true;
+}
+
+bool FParticleStreamsUpdateTest::RunTest(const FString& Parameters)
+{
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game, false);
+	FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+	WorldContext.SetCurrentWorld(World);
+
+	// An emitter instance with what the update modules read: a LOD level with its required module, a component and its transforms
+	UParticleSystemComponent* Component = ConstructObject<UParticleSystemComponent>(UParticleSystemComponent::StaticClass(), World);
+	Component->ComponentToWorld = FTransform(FRotator(30.f, 45.f, 10.f), FVector(100.f, -50.f, 20.f), FVector(2.f, 1.f, 0.5f));
+
+	UParticleSpriteEmitter* Emitter = ConstructObject<UParticleSpriteEmitter>(UParticleSpriteEmitter::StaticClass(), GetTransientPackage());
+	UParticleLODLevel* LODLevel = ConstructObject<UParticleLODLevel>(UParticleLODLevel::StaticClass(), Emitter);
+	LODLevel->RequiredModule = ConstructObject<UParticleModuleRequired>(UParticleModuleRequired::StaticClass(), Emitter);
+	Emitter->LODLevels.Add(LODLevel);
+
+	// Odd count, so the streams end with padding
+	const int32 NumParticles = 67;
+	FParticleSpriteEmitterInstance Instance;
+	Instance.SpriteTemplate = Emitter;
+	Instance.Component = Component;
+	Instance.CurrentLODLevelIndex = 0;
+	Instance.CurrentLODLevel = LODLevel;
+	Instance.EmitterToSimulation = FRotationMatrix(FRotator(0.f, 90.f, 20.f));
+	Instance.ParticleStride = sizeof(FBaseParticle) + 16;
+	Instance.ActiveParticles = NumParticles;
+	Instance.MaxActiveParticles = NumParticles;
+	Instance.ParticleData = (uint8*)FMemory::Malloc(NumParticles * Instance.ParticleStride);
+	// The update loops prefetch one index past the last active particle
+	Instance.ParticleIndices = (uint16*)FMemory::Malloc((NumParticles + 1) * sizeof(uint16));
+
+	FMemory::Memzero(Instance.ParticleData, NumParticles * Instance.ParticleStride);
+	FRandomStream Stream(0x5EA57EA5);
+	for (int32 i = 0; i < NumParticles; i++)
+	{
+		DECLARE_PARTICLE(Particle, Instance.ParticleData + i * Instance.ParticleStride);
+		Particle.RelativeTime = Stream.FRand();
+		Particle.Velocity = Stream.VRand() * 100.f;
+		Particle.BaseVelocity = Particle.Velocity;
+		Particle.Size = FVector(Stream.FRandRange(1.f, 10.f));
+		Particle.Color = FLinearColor(Stream.FRand(), Stream.FRand(), Stream.FRand(), 1.f);
+		Particle.Flags = (i % 13 == 0) ? STATE_Particle_Freeze : 0;
+		// active particles are not stored in order once some have been killed
+		Instance.ParticleIndices[i] = (i * 29) % NumParticles;
+	}
+	Instance.ParticleIndices[NumParticles] = 0;
+
+	UParticleModuleAccelerationConstant* Acceleration = ConstructObject<UParticleModuleAccelerationConstant>(UParticleModuleAccelerationConstant::StaticClass(), Emitter);
+	Acceleration->Acceleration = FVector(10.f, -20.f, -980.f);
+
+	UParticleModuleAccelerationDrag* Drag = ConstructObject<UParticleModuleAccelerationDrag>(UParticleModuleAccelerationDrag::StaticClass(), Emitter);
+	UDistributionFloatConstant* DragCoefficient = ConstructObject<UDistributionFloatConstant>(UDistributionFloatConstant::StaticClass(), Drag);
+	DragCoefficient->Constant = 0.7f;
+	Drag->DragCoefficient = DragCoefficient;
+
+	UParticleModuleSizeMultiplyLife* SizeMultiply = ConstructObject<UParticleModuleSizeMultiplyLife>(UParticleModuleSizeMultiplyLife::StaticClass(), Emitter);
+	UDistributionVectorConstant* SizeScale = ConstructObject<UDistributionVectorConstant>(UDistributionVectorConstant::StaticClass(), SizeMultiply);
+	SizeScale->Constant = FVector(1.5f, 0.5f, 2.f);
+	SizeMultiply->LifeMultiplier.Distribution = SizeScale;
+
+	UParticleModuleColorOverLife* ColorOverLife = ConstructObject<UParticleModuleColorOverLife>(UParticleModuleColorOverLife::StaticClass(), Emitter);
+	UDistributionVectorConstant* Color = ConstructObject<UDistributionVectorConstant>(UDistributionVectorConstant::StaticClass(), ColorOverLife);
+	Color->Constant = FVector(0.2f, 0.4f, 0.8f);
+	UDistributionFloatConstant* Alpha = ConstructObject<UDistributionFloatConstant>(UDistributionFloatConstant::StaticClass(), ColorOverLife);
+	Alpha->Constant = 0.5f;
+	ColorOverLife->ColorOverLife.Distribution = Color;
+	ColorOverLife->AlphaOverLife.Distribution = Alpha;
+	// the stream update only handles the baked distributions
+	ColorOverLife->ColorOverLife.Initialize();
+	ColorOverLife->AlphaOverLife.Initialize();
+
+	UParticleModuleVelocityOverLifetime* VelocityOverLife = ConstructObject<UParticleModuleVelocityOverLifetime>(UParticleModuleVelocityOverLifetime::StaticClass(), Emitter);
+	UDistributionVectorConstant* Velocity = ConstructObject<UDistributionVectorConstant>(UDistributionVectorConstant::StaticClass(), VelocityOverLife);
+	Velocity->Constant = FVector(30.f, -20.f, 10.f);
+	VelocityOverLife->VelOverLife.Distribution = Velocity;
+	VelocityOverLife->bApplyOwnerScale = true;
+
+	ParticleStreamsTest_CompareUpdates(Instance, Drag, TEXT("AccelerationDrag"), this);
+	ParticleStreamsTest_CompareUpdates(Instance, ColorOverLife, TEXT("ColorOverLife"), this);
+	ParticleStreamsTest_CompareUpdates(Instance, SizeMultiply, TEXT("SizeMultiplyLife"), this);
+	SizeMultiply->MultiplyY = false;
+	ParticleStreamsTest_CompareUpdates(Instance, SizeMultiply, TEXT("SizeMultiplyLife without Y"), this);
+
+	// Every space the acceleration and the velocity can be given in
+	for (int32 LocalSpace = 0; LocalSpace < 2; LocalSpace++)
+	{
+		LODLevel->RequiredModule->bUseLocalSpace = (LocalSpace != 0);
+		for (int32 WorldSpace = 0; WorldSpace < 2; WorldSpace++)
+		{
+			Acceleration->bAlwaysInWorldSpace = (WorldSpace != 0);
+			ParticleStreamsTest_CompareUpdates(Instance, Acceleration, FString::Printf(TEXT("AccelerationConstant (local space %d, always in world space %d)"), LocalSpace, WorldSpace), this);
+
+			VelocityOverLife->bInWorldSpace = (WorldSpace != 0);
+			for (int32 Absolute = 0; Absolute < 2; Absolute++)
+			{
+				VelocityOverLife->Absolute = (Absolute != 0);
+				ParticleStreamsTest_CompareUpdates(Instance, VelocityOverLife, FString::Printf(TEXT("VelocityOverLifetime (local space %d, in world space %d, absolute %d)"), LocalSpace, WorldSpace, Absolute), this);
+			}
+		}
+	}
+
+	GEngine->DestroyWorldContext(World);
+	World->DestroyWorld(false);
+
+	return true;
+}
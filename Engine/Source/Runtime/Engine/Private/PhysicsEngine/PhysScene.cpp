@@ -34,6 +34,16 @@ static TAutoConsoleVariable<float> CVarBounceThresholdVelocity(
 	TEXT("A contact with a relative velocity below this will not bounce. Default: 200"),
 	ECVF_Default);
 
+static TAutoConsoleVariable<int32> CVarParallelSyncComponentsToBodies(
+	TEXT("p.ParallelSyncComponentsToBodies"),
+	1,
+	TEXT("If 1, SyncComponentsToBodies reads back body transforms and finds the bodies that moved on worker threads,\n")
+	TEXT("then only moves the components of those bodies on the game thread. If 0, every body is handled on the game thread."),
+	ECVF_Default);
+
+/** Number of active bodies read back by a single SyncComponentsToBodies task */
+static const int32 SyncBodiesPerTask = 128;
+
 FORCEINLINE EPhysicsSceneType SceneType(const FBodyInstance* BodyInstance)
 {
 #if WITH_PHYSX
@@ -753,37 +763,162 @@ void FPhysScene::UpdateActiveTransforms(uint32 SceneType)
 
 DEFINE_STAT(STAT_SyncComponentsToBodies);
 
-void FPhysScene::SyncComponentsToBodies(uint32 SceneType)
+DECLARE_CYCLE_STAT(TEXT("SyncComponentsToBodies ReadBack"), STAT_SyncComponentsToBodies_ReadBack, STATGROUP_Physics);
+DECLARE_CYCLE_STAT(TEXT("SyncComponentsToBodies Move"), STAT_SyncComponentsToBodies_Move, STATGROUP_Physics);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Synced Bodies"), STAT_NumSyncedBodies, STATGROUP_Physics);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Synced Bodies Moved"), STAT_NumSyncedBodiesMoved, STATGROUP_Physics);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Sync Cost Per Body (us)"), STAT_SyncCostPerBody, STATGROUP_Physics);
+
+/** Reads back a range of active bodies and flags the ones whose component doesn't match physics anymore */
+class FSyncComponentsToBodiesTask
 {
-	SCOPE_CYCLE_COUNTER(STAT_TotalPhysicsTime);
-	SCOPE_CYCLE_COUNTER(STAT_SyncComponentsToBodies);
+	const TArray<FBodyInstance*>& BodyInstances;
+	int32 StartIndex;
+	int32 EndIndex;
+	TArray<bool>& OutBodyMoved;
 
-	for (FBodyInstance* BodyInstance : ActiveBodyInstances[SceneType])
+public:
+	FSyncComponentsToBodiesTask(const TArray<FBodyInstance*>& InBodyInstances, int32 InStartIndex, int32 InEndIndex, TArray<bool>& InOutBodyMoved)
+		: BodyInstances(InBodyInstances)
+		, StartIndex(InStartIndex)
+		, EndIndex(InEndIndex)
+		, OutBodyMoved(InOutBodyMoved)
 	{
-		if (BodyInstance == nullptr) { continue; }
+	}
+
+	FORCEINLINE TStatId GetStatId() const
+	{
+		RETURN_QUICK_DECLARE_CYCLE_STAT(FSyncComponentsToBodiesTask, STATGROUP_TaskGraphTasks);
+	}
+
+	static ENamedThreads::Type GetDesiredThread()
+	{
+		return ENamedThreads::AnyThread;
+	}
+
+	static ESubsequentsMode::Type GetSubsequentsMode()
+	{
+		return ESubsequentsMode::TrackSubsequents;
+	}
 
-		check(BodyInstance->OwnerComponent->IsRegistered()); // shouldn't have a physics body for a non-registered component!
+	void DoTask(ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+	{
+		ReadBack(BodyInstances, StartIndex, EndIndex, OutBodyMoved);
+	}
+
+	/** Only reads, the transforms are read again before moving since an earlier move may have moved other bodies */
+	static void ReadBack(const TArray<FBodyInstance*>& BodyInstances, int32 StartIndex, int32 EndIndex, TArray<bool>& OutBodyMoved)
+	{
+		for (int32 BodyIndex = StartIndex; BodyIndex < EndIndex; BodyIndex++)
+		{
+			const FBodyInstance* BodyInstance = BodyInstances[BodyIndex];
+			const UPrimitiveComponent* OwnerComponent = BodyInstance ? BodyInstance->OwnerComponent.Get() : nullptr;
+			if (OwnerComponent == nullptr)
+			{
+				OutBodyMoved[BodyIndex] = false;
+			}
+			else if (OwnerComponent->AttachParent != nullptr)
+			{
+				// Moving another body's component may move this one too, so it can only be compared once those moves are done
+				OutBodyMoved[BodyIndex] = true;
+			}
+			else
+			{
+				OutBodyMoved[BodyIndex] = !BodyInstance->GetUnrealWorldTransform().EqualsNoScale(OwnerComponent->ComponentToWorld);
+			}
+		}
+	}
+};
+
+/**
+ * Moves the component of a body to match physics, and makes sure its owner is still in the world.
+ * @param bMayHaveMoved - false if the body is known to match its component, which skips reading it back
+ */
+static void SyncComponentToBody(FBodyInstance* BodyInstance, bool bMayHaveMoved)
+{
+	check(BodyInstance->OwnerComponent->IsRegistered()); // shouldn't have a physics body for a non-registered component!
 
-		AActor* Owner = BodyInstance->OwnerComponent->GetOwner();
+	AActor* Owner = BodyInstance->OwnerComponent->GetOwner();
 
-		// See if the transform is actually different, and if so, move the component to match physics
+	// See if the transform is actually different, and if so, move the component to match physics
+	if (bMayHaveMoved)
+	{
 		const FTransform NewTransform = BodyInstance->GetUnrealWorldTransform();
 		if (!NewTransform.EqualsNoScale(BodyInstance->OwnerComponent->ComponentToWorld))
 		{
+			INC_DWORD_STAT(STAT_NumSyncedBodiesMoved);
+
 			const FVector MoveBy = NewTransform.GetLocation() - BodyInstance->OwnerComponent->ComponentToWorld.GetLocation();
 			const FRotator NewRotation = NewTransform.Rotator();
 
 			//@warning: do not reference BodyInstance again after calling MoveComponent() - events from the move could have made it unusable (destroying the actor, SetPhysics(), etc)
 			BodyInstance->OwnerComponent->MoveComponent(MoveBy, NewRotation, false, NULL, MOVECOMP_SkipPhysicsMove);
 		}
+	}
+
+	// Check if we didn't fall out of the world
+	if (Owner != NULL && !Owner->IsPendingKill())
+	{
+		Owner->CheckStillInWorld();
+	}
+}
+
+void FPhysScene::SyncComponentsToBodies(uint32 SceneType)
+{
+	SCOPE_CYCLE_COUNTER(STAT_TotalPhysicsTime);
+	SCOPE_CYCLE_COUNTER(STAT_SyncComponentsToBodies);
+
+	const uint32 StartCycles = FPlatformTime::Cycles();
+	TArray<FBodyInstance*>& BodyInstances = ActiveBodyInstances[SceneType];
+	INC_DWORD_STAT_BY(STAT_NumSyncedBodies, BodyInstances.Num());
+
+	if (BodyInstances.Num() > SyncBodiesPerTask && FApp::ShouldUseThreadingForPerformance() && CVarParallelSyncComponentsToBodies.GetValueOnGameThread())
+	{
+		// Read back and compare every body in parallel, each task writes the flags of its own range
+		const int32 NumBodies = BodyInstances.Num();
+		TArray<bool> BodyMoved;
+		BodyMoved.AddUninitialized(NumBodies);
+		{
+			SCOPE_CYCLE_COUNTER(STAT_SyncComponentsToBodies_ReadBack);
+
+			FGraphEventArray ReadBackEvents;
+			for (int32 StartIndex = SyncBodiesPerTask; StartIndex < NumBodies; StartIndex += SyncBodiesPerTask)
+			{
+				const int32 EndIndex = FMath::Min(StartIndex + SyncBodiesPerTask, NumBodies);
+				ReadBackEvents.Add(TGraphTask<FSyncComponentsToBodiesTask>::CreateTask(nullptr, ENamedThreads::GameThread).ConstructAndDispatchWhenReady(BodyInstances, StartIndex, EndIndex, BodyMoved));
+			}
+
+			// put the game thread to work on the first range while the workers do the rest
+			FSyncComponentsToBodiesTask::ReadBack(BodyInstances, 0, SyncBodiesPerTask, BodyMoved);
+
+			FTaskGraphInterface::Get().WaitUntilTasksComplete(ReadBackEvents, ENamedThreads::GameThread_Local);
+		}
+
+		SCOPE_CYCLE_COUNTER(STAT_SyncComponentsToBodies_Move);
+		for (int32 BodyIndex = 0; BodyIndex < NumBodies; BodyIndex++)
+		{
+			// Entries are cleared when a body is terminated, which an earlier move may have caused
+			FBodyInstance* BodyInstance = BodyInstances[BodyIndex];
+			if (BodyInstance == nullptr) { continue; }
 
-		// Check if we didn't fall out of the world
-		if (Owner != NULL && !Owner->IsPendingKill())
+			SyncComponentToBody(BodyInstance, BodyMoved[BodyIndex]);
+		}
+	}
+	else
+	{
+		for (FBodyInstance* BodyInstance : BodyInstances)
 		{
-			Owner->CheckStillInWorld();
+			if (BodyInstance == nullptr) { continue; }
+
+			SyncComponentToBody(BodyInstance, true);
 		}
 	}
 
+	if (BodyInstances.Num() > 0)
+	{
+		SET_FLOAT_STAT(STAT_SyncCostPerBody, FPlatformTime::ToMilliseconds(FPlatformTime::Cycles() - StartCycles) * 1000.f / BodyInstances.Num());
+	}
+
 #if WITH_APEX
 	if (ActiveDestructibleActors[SceneType].Num())
 	{
@@ -10,12 +10,35 @@
 #include "Net/UnrealNetwork.h"
 #include "GameFramework/PhysicsVolume.h"
 #include "ComponentReregisterContext.h"
+#include "Components/BoxComponent.h"
+#include "Components/SphereComponent.h"
+#include "Components/CapsuleComponent.h"
 
 #define LOCTEXT_NAMESPACE "SceneComponent"
 
 
 DEFINE_LOG_CATEGORY_STATIC(LogSceneComponent, Log, All);
 
+static TAutoConsoleVariable<int32> CVarBatchedTransformPropagation(
+	TEXT("r.BatchedTransformPropagation"),
+	1,
+	TEXT("If 1, moving a component with many descendants computes their transforms and bounds level by level on worker threads,\n")
+	TEXT("then updates physics, rendering and navigation in hierarchy order on the game thread. If 0, descendants are updated one at a time."));
+
+static TAutoConsoleVariable<int32> CVarBatchedTransformPropagationMinComponents(
+	TEXT("r.BatchedTransformPropagation.MinComponents"),
+	64,
+	TEXT("Smallest number of descendants for which transform propagation is batched."));
+
+DECLARE_CYCLE_STAT(TEXT("Batched Transform Propagation"), STAT_BatchedTransformPropagation, STATGROUP_Game);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Batched Transform Updates"), STAT_BatchedTransformUpdates, STATGROUP_Game);
+
+/** Number of components updated by a single batched transform propagation task */
+static const int32 BatchedTransformUpdatesPerTask = 32;
+
+/** Non zero while descendants are being updated by UpdateChildTransforms, so that nested calls don't try to batch again */
+static int32 GTransformPropagationDepth = 0;
+
 FOverlapInfo::FOverlapInfo(UPrimitiveComponent* InComponent, int32 InBodyIndex)
 	: bFromSweep(false)
 {
@@ -56,30 +79,34 @@ FTransform USceneComponent::CalcNewComponentToWorld(const FTransform& NewRelativ
 	Parent = Parent ? Parent : AttachParent;
 	if (Parent != NULL)
 	{
-		const FTransform ParentToWorld = Parent->GetSocketTransform(AttachSocketName);
-		FTransform NewCompToWorld = NewRelativeTransform * ParentToWorld;
-
-		if(bAbsoluteLocation)
-		{
-			NewCompToWorld.SetTranslation(NewRelativeTransform.GetTranslation());
-		}
+		return ComposeComponentToWorld(NewRelativeTransform, Parent->GetSocketTransform(AttachSocketName));
+	}
+	else
+	{
+		return NewRelativeTransform;
+	}
+}
 
-		if(bAbsoluteRotation)
-		{
-			NewCompToWorld.SetRotation(NewRelativeTransform.GetRotation());
-		}
+FTransform USceneComponent::ComposeComponentToWorld(const FTransform& NewRelativeTransform, const FTransform& ParentToWorld) const
+{
+	FTransform NewCompToWorld = NewRelativeTransform * ParentToWorld;
 
-		if(bAbsoluteScale)
-		{
-			NewCompToWorld.SetScale3D(NewRelativeTransform.GetScale3D());
-		}
+	if(bAbsoluteLocation)
+	{
+		NewCompToWorld.SetTranslation(NewRelativeTransform.GetTranslation());
+	}
 
-		return NewCompToWorld;
+	if(bAbsoluteRotation)
+	{
+		NewCompToWorld.SetRotation(NewRelativeTransform.GetRotation());
 	}
-	else
+
+	if(bAbsoluteScale)
 	{
-		return NewRelativeTransform;
+		NewCompToWorld.SetScale3D(NewRelativeTransform.GetScale3D());
 	}
+
+	return NewCompToWorld;
 }
 
 void USceneComponent::OnUpdateTransform(bool bSkipPhysicsMove)
@@ -1235,6 +1262,12 @@ FName USceneComponent::GetComponentInstanceDataType() const
 
 void USceneComponent::UpdateChildTransforms()
 {
+	if (AttachChildren.Num() > 0 && GTransformPropagationDepth == 0 && UpdateChildTransformsBatched())
+	{
+		return;
+	}
+
+	++GTransformPropagationDepth;
 	for(int32 i=0; i<AttachChildren.Num(); i++)
 	{
 		USceneComponent* ChildComp = AttachChildren[i];
@@ -1243,6 +1276,258 @@ void USceneComponent::UpdateChildTransforms()
 			ChildComp->UpdateComponentToWorld();
 		}
 	}
+	--GTransformPropagationDepth;
+}
+
+/** A descendant visited by a batched transform propagation */
+struct FBatchedTransformUpdate
+{
+	USceneComponent* Component;
+	/** Children of the component, they are contiguous because descendants are gathered breadth first */
+	int32 FirstChild;
+	int32 NumChildren;
+	/** Whether ComponentToWorld can be computed on a worker thread, otherwise the game thread computes it with the rest of its level */
+	bool bParallelTransform;
+	/** Whether bounds are updated with the transform, or on the game thread when the batch is flushed */
+	bool bParallelBounds;
+	/** Output of the transform update */
+	bool bTransformChanged;
+
+	FBatchedTransformUpdate(USceneComponent* InComponent)
+		: Component(InComponent)
+		, FirstChild(0)
+		, NumChildren(0)
+		, bParallelTransform(false)
+		, bParallelBounds(false)
+		, bTransformChanged(false)
+	{
+	}
+};
+
+/**
+ * Whether a component class was checked to keep the USceneComponent versions of CalcNewComponentToWorld and of GetSocketTransform without socket.
+ * Exact classes only, subclasses are free to override either.
+ */
+static bool UsesDefaultComponentTransforms(const USceneComponent* Component)
+{
+	const UClass* Class = Component->GetClass();
+	return Class == USceneComponent::StaticClass() || Class == UStaticMeshComponent::StaticClass() ||
+		Class == UBoxComponent::StaticClass() || Class == USphereComponent::StaticClass() || Class == UCapsuleComponent::StaticClass();
+}
+
+/** Computes the transforms of a range of components from the same hierarchy level */
+class FBatchedTransformPropagationTask
+{
+	TArray<FBatchedTransformUpdate>& Updates;
+	int32 StartIndex;
+	int32 EndIndex;
+
+public:
+	FBatchedTransformPropagationTask(TArray<FBatchedTransformUpdate>& InUpdates, int32 InStartIndex, int32 InEndIndex)
+		: Updates(InUpdates)
+		, StartIndex(InStartIndex)
+		, EndIndex(InEndIndex)
+	{
+	}
+
+	FORCEINLINE TStatId GetStatId() const
+	{
+		RETURN_QUICK_DECLARE_CYCLE_STAT(FBatchedTransformPropagationTask, STATGROUP_TaskGraphTasks);
+	}
+
+	static ENamedThreads::Type GetDesiredThread()
+	{
+		return ENamedThreads::AnyThread;
+	}
+
+	static ESubsequentsMode::Type GetSubsequentsMode()
+	{
+		return ESubsequentsMode::TrackSubsequents;
+	}
+
+	void DoTask(ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+	{
+		Process(Updates, StartIndex, EndIndex, true);
+	}
+
+	/** Updates the components of the range computed in parallel (bParallel), or the ones left to the game thread */
+	static void Process(TArray<FBatchedTransformUpdate>& Updates, int32 StartIndex, int32 EndIndex, bool bParallel)
+	{
+		for (int32 UpdateIndex = StartIndex; UpdateIndex < EndIndex; UpdateIndex++)
+		{
+			FBatchedTransformUpdate& Update = Updates[UpdateIndex];
+			if (Update.bParallelTransform == bParallel)
+			{
+				Update.bTransformChanged = Update.Component->UpdateComponentToWorldConcurrent(Update.bParallelTransform, Update.bParallelBounds);
+			}
+		}
+	}
+};
+
+bool USceneComponent::UpdateChildTransformsBatched()
+{
+	// Editor worlds rebuild streaming data from UpdateBounds, keep them on the serial path
+	if (!IsInGameThread() || !CVarBatchedTransformPropagation.GetValueOnGameThread() || !FApp::ShouldUseThreadingForPerformance() || !World || !World->IsGameWorld())
+	{
+		return false;
+	}
+
+	// Gather descendants breadth first. A level only depends on the levels above it, so each one can be computed in parallel.
+	TArray<FBatchedTransformUpdate> Updates;
+	TArray<int32> LevelStarts;
+
+	for (int32 ChildIndex = 0; ChildIndex < AttachChildren.Num(); ChildIndex++)
+	{
+		USceneComponent* ChildComp = AttachChildren[ChildIndex];
+		if (ChildComp != NULL)
+		{
+			new(Updates) FBatchedTransformUpdate(ChildComp);
+		}
+	}
+	const int32 NumRoots = Updates.Num();
+
+	int32 LevelStart = 0;
+	while (LevelStart < Updates.Num())
+	{
+		LevelStarts.Add(LevelStart);
+
+		const int32 LevelEnd = Updates.Num();
+		for (int32 UpdateIndex = LevelStart; UpdateIndex < LevelEnd; UpdateIndex++)
+		{
+			USceneComponent* Comp = Updates[UpdateIndex].Component;
+
+			// Scoped movement changes when children are updated, let the serial path handle it
+			if (Comp->IsDeferringMovementUpdates())
+			{
+				return false;
+			}
+
+			// Socket transforms and overridden transform math may read anything, compute them on the game thread
+			Updates[UpdateIndex].bParallelTransform = Comp->AttachSocketName == NAME_None && UsesDefaultComponentTransforms(Comp) && (!Comp->AttachParent || UsesDefaultComponentTransforms(Comp->AttachParent));
+			// Bounds inherited from the parent have to wait until the parent's bounds are final
+			Updates[UpdateIndex].bParallelBounds = !(Comp->bUseAttachParentBound && Comp->AttachParent) && Comp->CanUpdateBoundsInParallel();
+
+			Updates[UpdateIndex].FirstChild = Updates.Num();
+			for (int32 ChildIndex = 0; ChildIndex < Comp->AttachChildren.Num(); ChildIndex++)
+			{
+				USceneComponent* ChildComp = Comp->AttachChildren[ChildIndex];
+				if (ChildComp != NULL)
+				{
+					new(Updates) FBatchedTransformUpdate(ChildComp);
+				}
+			}
+			Updates[UpdateIndex].NumChildren = Updates.Num() - Updates[UpdateIndex].FirstChild;
+		}
+
+		LevelStart = LevelEnd;
+	}
+
+	if (Updates.Num() < CVarBatchedTransformPropagationMinComponents.GetValueOnGameThread())
+	{
+		return false;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_BatchedTransformPropagation);
+	INC_DWORD_STAT_BY(STAT_BatchedTransformUpdates, Updates.Num());
+
+	LevelStarts.Add(Updates.Num());
+	for (int32 LevelIndex = 0; LevelIndex < LevelStarts.Num() - 1; LevelIndex++)
+	{
+		const int32 StartIndex = LevelStarts[LevelIndex];
+		const int32 EndIndex = LevelStarts[LevelIndex + 1];
+
+		FGraphEventArray UpdateEvents;
+		for (int32 TaskStart = StartIndex + BatchedTransformUpdatesPerTask; TaskStart < EndIndex; TaskStart += BatchedTransformUpdatesPerTask)
+		{
+			const int32 TaskEnd = FMath::Min(TaskStart + BatchedTransformUpdatesPerTask, EndIndex);
+			UpdateEvents.Add(TGraphTask<FBatchedTransformPropagationTask>::CreateTask(nullptr, ENamedThreads::GameThread).ConstructAndDispatchWhenReady(Updates, TaskStart, TaskEnd));
+		}
+
+		// put the game thread to work on the first range and on the components it has to update itself while the workers do the rest
+		FBatchedTransformPropagationTask::Process(Updates, StartIndex, FMath::Min(StartIndex + BatchedTransformUpdatesPerTask, EndIndex), true);
+		FBatchedTransformPropagationTask::Process(Updates, StartIndex, EndIndex, false);
+
+		if (UpdateEvents.Num() > 0)
+		{
+			FTaskGraphInterface::Get().WaitUntilTasksComplete(UpdateEvents, ENamedThreads::GameThread_Local);
+		}
+	}
+
+	// Flush depth first, in the same order as the serial path
+	++GTransformPropagationDepth;
+	for (int32 UpdateIndex = 0; UpdateIndex < NumRoots; UpdateIndex++)
+	{
+		Updates[UpdateIndex].Component->FinishBatchedTransformUpdate(Updates, UpdateIndex);
+	}
+	--GTransformPropagationDepth;
+
+	return true;
+}
+
+bool USceneComponent::UpdateComponentToWorldConcurrent(bool bDefaultTransforms, bool bUpdateBounds)
+{
+	// Same math as UpdateComponentToWorldWithParent, the parent has been updated by the previous level
+	const FTransform RelativeTransform(RelativeRotation, RelativeLocation, RelativeScale3D);
+	FTransform NewTransform;
+	if (bDefaultTransforms)
+	{
+		// CalcNewComponentToWorld without the virtual calls, UsesDefaultComponentTransforms checked they are not overridden
+		NewTransform = AttachParent ? ComposeComponentToWorld(RelativeTransform, AttachParent->ComponentToWorld) : RelativeTransform;
+	}
+	else
+	{
+		NewTransform = CalcNewComponentToWorld(RelativeTransform, AttachParent);
+	}
+
+	const bool bTransformChanged = !ComponentToWorld.Equals(NewTransform, SMALL_NUMBER);
+	if (bTransformChanged)
+	{
+		ComponentToWorld = NewTransform;
+	}
+
+	if (bUpdateBounds)
+	{
+		UpdateBounds();
+	}
+
+	return bTransformChanged;
+}
+
+void USceneComponent::FinishBatchedTransformUpdate(const TArray<FBatchedTransformUpdate>& Updates, int32 UpdateIndex)
+{
+	const FBatchedTransformUpdate& Update = Updates[UpdateIndex];
+	bWorldToComponentUpdated = true;
+
+	if (!Update.bParallelBounds)
+	{
+		UpdateBounds();
+	}
+
+	if (Update.bTransformChanged)
+	{
+		// Always send new transform to physics
+		OnUpdateTransform(false);
+
+		// Flag render transform as dirty
+		MarkRenderTransformDirty();
+	}
+
+	// Now go and update children
+	for (int32 ChildIndex = Update.FirstChild; ChildIndex < Update.FirstChild + Update.NumChildren; ChildIndex++)
+	{
+		Updates[ChildIndex].Component->FinishBatchedTransformUpdate(Updates, ChildIndex);
+	}
+
+	if (Update.bTransformChanged)
+	{
+		// Refresh navigation
+		UpdateNavigationData();
+	}
+	else
+	{
+		// Need to flag as dirty so new bounds are sent to render thread
+		MarkRenderTransformDirty();
+	}
 }
 
 void USceneComponent::Serialize(FArchive& Ar)
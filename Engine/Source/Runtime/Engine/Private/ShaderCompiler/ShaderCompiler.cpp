@@ -78,7 +78,7 @@ static void DoReadTaskResults(TArray<FShaderCompileJob*>& QueuedJobs, FArchive&
 {
 	int32 ShaderCompileWorkerOutputVersion;
 	OutputFile << ShaderCompileWorkerOutputVersion;
-	check(ShaderCompileWorkerOutputVersion == 1);
+	check(ShaderCompileWorkerOutputVersion == 2);
 
 	int32 ErrorCode;
 	OutputFile << ErrorCode;
@@ -122,6 +122,7 @@ static void DoReadTaskResults(TArray<FShaderCompileJob*>& QueuedJobs, FArchive&
 		// Generate a hash of the output and cache it
 		// The shader processing this output will use it to search for existing FShaderResources
 		CurrentJob->Output.GenerateOutputHash();
+		CurrentJob->Output.UpdatePreprocessStats();
 		CurrentJob->bSucceeded = CurrentJob->Output.bSucceeded;
 	}
 }
@@ -346,6 +347,15 @@ struct FShaderCompileWorkerInfo
 	/** Jobs that this worker is responsible for compiling. */
 	TArray<FShaderCompileJob*> QueuedJobs;
 
+	/** Tracks whether the prefetched tasks have been issued to the worker. */
+	bool bIssuedPrefetchedTasksToWorker;
+
+	/** 
+	 * Next batch of jobs for this worker, handed out while QueuedJobs is still compiling.
+	 * The worker picks these up as soon as it finishes QueuedJobs, instead of sitting idle while its results are read back and new inputs are written.
+	 */
+	TArray<FShaderCompileJob*> PrefetchedJobs;
+
 	FShaderCompileWorkerInfo() :
 		bIssuedTasksToWorker(false),		
 		bLaunchedWorker(false),
@@ -353,7 +363,8 @@ struct FShaderCompileWorkerInfo
 #if PLATFORM_SUPPORTS_NAMED_PIPES
 		bWorkerForPipeWasLaunched(false),
 #endif
-		StartTime(0)
+		StartTime(0),
+		bIssuedPrefetchedTasksToWorker(false)
 	{
 	}
 
@@ -569,16 +580,7 @@ int32 FShaderCompileThreadRunnable::PullTasksFromQueue()
 
 				if (Manager->CompileQueue.Num() > 0)
 				{
-					bool bAddedLowLatencyTask = false;
-					int32 JobIndex = 0;
-
-					// Try to grab up to MaxShaderJobBatchSize jobs
-					// Don't put more than one low latency task into a batch
-					for (; JobIndex < Manager->MaxShaderJobBatchSize && JobIndex < Manager->CompileQueue.Num() && !bAddedLowLatencyTask; JobIndex++)
-					{
-						bAddedLowLatencyTask |= Manager->CompileQueue[JobIndex]->bOptimizeForLowLatency;
-						CurrentWorkerInfo.QueuedJobs.Add(Manager->CompileQueue[JobIndex]);
-					}
+					GrabTasksFromQueue(CurrentWorkerInfo.QueuedJobs);
 
 					// Update the worker state as having new tasks that need to be issued					
 					// don't reset worker app ID, because the shadercompilerworkers don't shutdown immediately after finishing a single job queue.
@@ -586,7 +588,6 @@ int32 FShaderCompileThreadRunnable::PullTasksFromQueue()
 					CurrentWorkerInfo.bLaunchedWorker = false;
 					CurrentWorkerInfo.StartTime = FPlatformTime::Seconds();
 					NumActiveThreads++;
-					Manager->CompileQueue.RemoveAt(0, JobIndex);
 				}
 			}
 			else
@@ -627,8 +628,36 @@ int32 FShaderCompileThreadRunnable::PullTasksFromQueue()
 					// Using atomics to update NumOutstandingJobs since it is read outside of the critical section
 					FPlatformAtomics::InterlockedAdd(&Manager->NumOutstandingJobs, -CurrentWorkerInfo.QueuedJobs.Num());
 
+					Manager->NumCompletedJobs += CurrentWorkerInfo.QueuedJobs.Num();
+
 					CurrentWorkerInfo.bComplete = false;
 					CurrentWorkerInfo.QueuedJobs.Empty();
+
+					if (CurrentWorkerInfo.PrefetchedJobs.Num() > 0)
+					{
+						// The worker has already been handed its next batch, promote it to the batch in flight.
+						// bLaunchedWorker is left alone since the same worker process will be compiling it.
+						Exchange(CurrentWorkerInfo.QueuedJobs, CurrentWorkerInfo.PrefetchedJobs);
+						CurrentWorkerInfo.bIssuedTasksToWorker = CurrentWorkerInfo.bIssuedPrefetchedTasksToWorker;
+						CurrentWorkerInfo.bIssuedPrefetchedTasksToWorker = false;
+						CurrentWorkerInfo.StartTime = FPlatformTime::Seconds();
+					}
+				}
+			}
+		}
+
+		// Jobs left in the queue at this point mean that every worker we are allowed to feed is busy.
+		// Hand each of them their next batch now, so they can start on it as soon as the current one is done.
+		if (Manager->CompileQueue.Num() > 0 && ShouldPrefetchTasks())
+		{
+			for (int32 WorkerIndex = 0; WorkerIndex < NumWorkersToFeed && Manager->CompileQueue.Num() > 0; WorkerIndex++)
+			{
+				FShaderCompileWorkerInfo& CurrentWorkerInfo = *WorkerInfos[WorkerIndex];
+
+				if (CurrentWorkerInfo.QueuedJobs.Num() > 0 && CurrentWorkerInfo.PrefetchedJobs.Num() == 0 && !CurrentWorkerInfo.bComplete)
+				{
+					GrabTasksFromQueue(CurrentWorkerInfo.PrefetchedJobs);
+					CurrentWorkerInfo.bIssuedPrefetchedTasksToWorker = false;
 				}
 			}
 		}
@@ -636,6 +665,91 @@ int32 FShaderCompileThreadRunnable::PullTasksFromQueue()
 	return NumActiveThreads;
 }
 
+void FShaderCompileThreadRunnable::GrabTasksFromQueue(TArray<FShaderCompileJob*>& OutJobs)
+{
+	bool bAddedLowLatencyTask = false;
+	int32 JobIndex = 0;
+
+	// Try to grab up to MaxShaderJobBatchSize jobs
+	// Don't put more than one low latency task into a batch
+	for (; JobIndex < Manager->MaxShaderJobBatchSize && JobIndex < Manager->CompileQueue.Num() && !bAddedLowLatencyTask; JobIndex++)
+	{
+		bAddedLowLatencyTask |= Manager->CompileQueue[JobIndex]->bOptimizeForLowLatency;
+		OutJobs.Add(Manager->CompileQueue[JobIndex]);
+	}
+
+	Manager->CompileQueue.RemoveAt(0, JobIndex);
+}
+
+bool FShaderCompileThreadRunnable::ShouldPrefetchTasks() const
+{
+	// Prefetching relies on the file based protocol, where the worker deletes its input as soon as it has been read
+	if (!Manager->bAllowCompilingThroughWorkers || !Manager->bPrefetchWorkerTasks)
+	{
+		return false;
+	}
+
+#if PLATFORM_SUPPORTS_NAMED_PIPES
+	if (GShaderPipeConfig.bUseNamedPipes)
+	{
+		return false;
+	}
+#endif
+
+	return true;
+}
+
+void FShaderCompileThreadRunnable::WriteTasksFile(int32 WorkerIndex, TArray<FShaderCompileJob*>& Jobs)
+{
+	const FString WorkingDirectory = Manager->AbsoluteShaderBaseWorkingDirectory + FString::FromInt(WorkerIndex);
+
+#if PLATFORM_MAC || PLATFORM_LINUX
+	// To make sure that the process waiting for input file won't try to read it until it's ready
+	// we use a temp file name during writing.
+	FString TransferFileName;
+	do
+	{
+		FGuid Guid;
+		FPlatformMisc::CreateGuid(Guid);
+		TransferFileName = WorkingDirectory + Guid.ToString();
+	} while (IFileManager::Get().FileSize(*TransferFileName) != INDEX_NONE);
+#else
+	const FString TransferFileName = WorkingDirectory / TEXT("WorkerInputOnly.in");
+#endif
+
+	// Write out the file that the worker app is waiting for, which has all the information needed to compile the shader.
+	// 'Only' indicates that the worker should keep checking for more tasks after this one
+	FArchive* TransferFile = NULL;
+
+	int32 RetryCount = 0;
+	// Retry over the next two seconds if we can't write out the input file
+	// Anti-virus and indexing applications can interfere and cause this write to fail
+	//@todo - switch to shared memory or some other method without these unpredictable hazards
+	while (TransferFile == NULL && RetryCount < 2000)
+	{
+		if (RetryCount > 0)
+		{
+			FPlatformProcess::Sleep(0.01f);
+		}
+		TransferFile = IFileManager::Get().CreateFileWriter(*TransferFileName, FILEWRITE_EvenIfReadOnly);
+		RetryCount++;
+	}
+	if (TransferFile == NULL)
+	{
+		TransferFile = IFileManager::Get().CreateFileWriter(*TransferFileName, FILEWRITE_EvenIfReadOnly | FILEWRITE_NoFail);
+	}
+	check(TransferFile);
+
+	DoWriteTasks(Jobs, *TransferFile);
+	delete TransferFile;
+
+#if PLATFORM_MAC || PLATFORM_LINUX
+	// Change the transfer file name to proper one
+	FString ProperTransferFileName = WorkingDirectory / TEXT("WorkerInputOnly.in");
+	IFileManager::Get().Move(*ProperTransferFileName, *TransferFileName);
+#endif
+}
+
 void FShaderCompileThreadRunnable::WriteNewTasks()
 {
 	for (int32 WorkerIndex = 0; WorkerIndex < WorkerInfos.Num(); WorkerIndex++)
@@ -647,26 +761,6 @@ void FShaderCompileThreadRunnable::WriteNewTasks()
 		{
 			CurrentWorkerInfo.bIssuedTasksToWorker = true;
 
-			const FString WorkingDirectory = Manager->AbsoluteShaderBaseWorkingDirectory + FString::FromInt(WorkerIndex);
-
-#if PLATFORM_MAC || PLATFORM_LINUX
-			// To make sure that the process waiting for input file won't try to read it until it's ready
-			// we use a temp file name during writing.
-			FString TransferFileName;
-			do
-			{
-				FGuid Guid;
-				FPlatformMisc::CreateGuid(Guid);
-				TransferFileName = WorkingDirectory + Guid.ToString();
-			} while (IFileManager::Get().FileSize(*TransferFileName) != INDEX_NONE);
-#else
-			const FString TransferFileName = WorkingDirectory / TEXT("WorkerInputOnly.in");
-#endif
-
-			// Write out the file that the worker app is waiting for, which has all the information needed to compile the shader.
-			// 'Only' indicates that the worker should keep checking for more tasks after this one
-			FArchive* TransferFile = NULL;
-
 #if PLATFORM_SUPPORTS_NAMED_PIPES
 			if (GShaderPipeConfig.bUseNamedPipes && !GShaderPipeConfig.bSingleJobPerNamedPipeProcess)
 			{
@@ -675,33 +769,18 @@ void FShaderCompileThreadRunnable::WriteNewTasks()
 			else
 #endif // PLATFORM_SUPPORTS_NAMED_PIPES
 			{
-				int32 RetryCount = 0;
-				// Retry over the next two seconds if we can't write out the input file
-				// Anti-virus and indexing applications can interfere and cause this write to fail
-				//@todo - switch to shared memory or some other method without these unpredictable hazards
-				while (TransferFile == NULL && RetryCount < 2000)
-				{
-					if (RetryCount > 0)
-					{
-						FPlatformProcess::Sleep(0.01f);
-					}
-					TransferFile = IFileManager::Get().CreateFileWriter(*TransferFileName, FILEWRITE_EvenIfReadOnly);
-					RetryCount++;
-				}
-				if (TransferFile == NULL)
-				{
-					TransferFile = IFileManager::Get().CreateFileWriter(*TransferFileName, FILEWRITE_EvenIfReadOnly | FILEWRITE_NoFail);
-				}
-				check(TransferFile);
-
-				DoWriteTasks(CurrentWorkerInfo.QueuedJobs, *TransferFile);
-				delete TransferFile;
+				WriteTasksFile(WorkerIndex, CurrentWorkerInfo.QueuedJobs);
+			}
+		}
+		else if (CurrentWorkerInfo.bIssuedTasksToWorker && !CurrentWorkerInfo.bIssuedPrefetchedTasksToWorker && CurrentWorkerInfo.PrefetchedJobs.Num() > 0)
+		{
+			// The worker deletes its input file as soon as it has read it, after which the next batch can be queued up behind the one being compiled
+			const FString InputFileNameAndPath = Manager->AbsoluteShaderBaseWorkingDirectory + FString::FromInt(WorkerIndex) + TEXT("/WorkerInputOnly.in");
 
-#if PLATFORM_MAC || PLATFORM_LINUX
-				// Change the transfer file name to proper one
-				FString ProperTransferFileName = WorkingDirectory / TEXT("WorkerInputOnly.in");
-				IFileManager::Get().Move(*ProperTransferFileName, *TransferFileName);
-#endif
+			if (!FPlatformFileManager::Get().GetPlatformFile().FileExists(*InputFileNameAndPath))
+			{
+				CurrentWorkerInfo.bIssuedPrefetchedTasksToWorker = true;
+				WriteTasksFile(WorkerIndex, CurrentWorkerInfo.PrefetchedJobs);
 			}
 		}
 	}
@@ -948,6 +1027,7 @@ void FShaderCompileThreadRunnable::CompileDirectlyThroughDll()
 				Compiler->CompileShader(Format, CurrentJob.Input, CurrentJob.Output, FString(FPlatformProcess::ShaderDir()));
 
 				CurrentJob.bSucceeded = CurrentJob.Output.bSucceeded;
+				CurrentJob.Output.UpdatePreprocessStats();
 
 				if (CurrentJob.Output.bSucceeded)
 				{
@@ -1033,6 +1113,7 @@ FShaderCompilingManager::FShaderCompilingManager() :
 #endif
 {
 	WorkersBusyTime = 0;
+	NumCompletedJobs = 0;
 	bFallBackToDirectCompiles = false;
 
 	// Threads must use absolute paths on Windows in case the current directory is changed on another thread!
@@ -1068,6 +1149,7 @@ FShaderCompilingManager::FShaderCompilingManager() :
 	verify(GConfig->GetInt( TEXT("DevOptions.Shaders"), TEXT("MaxShaderJobBatchSize"), MaxShaderJobBatchSize, GEngineIni ));
 	verify(GConfig->GetBool( TEXT("DevOptions.Shaders"), TEXT("bPromptToRetryFailedShaderCompiles"), bPromptToRetryFailedShaderCompiles, GEngineIni ));
 	verify(GConfig->GetBool( TEXT("DevOptions.Shaders"), TEXT("bLogJobCompletionTimes"), bLogJobCompletionTimes, GEngineIni ));
+	verify(GConfig->GetBool( TEXT("DevOptions.Shaders"), TEXT("bPrefetchWorkerTasks"), bPrefetchWorkerTasks, GEngineIni ));
 
 #if PLATFORM_SUPPORTS_NAMED_PIPES
 	GShaderPipeConfig.ReadFromConfigIni();
@@ -2391,6 +2473,43 @@ bool RecompileShaders(const TCHAR* Cmd, FOutputDevice& Ar)
 				}
 			}
 		}
+		else if( FCString::Stricmp(*FlagStr,TEXT("Benchmark"))==0)
+		{
+			// Recompiles a fixed set of shaders (global shaders and the engine default materials) and reports the throughput,
+			// which makes it possible to compare shader compiling setups without the variance of a project's content.
+			int32 NumJobsBefore = 0;
+			double WorkersBusyTimeBefore = 0;
+			GShaderCompilingManager->FinishAllCompilation();
+			GShaderCompilingManager->GetCompletedJobStats(NumJobsBefore, WorkersBusyTimeBefore);
+
+			const double StartTime = FPlatformTime::Seconds();
+			{
+				FRecompileShadersTimer TestTimer(TEXT("RecompileShaders Benchmark"));
+				RecompileGlobalShaders();
+
+				for (int32 Domain = 0; Domain < MD_MAX; Domain++)
+				{
+					UMaterial* Material = UMaterial::GetDefaultMaterial((EMaterialDomain)Domain);
+#if WITH_EDITOR
+					// <Pre/Post>EditChange will force a re-creation of the resource,
+					// in turn recompiling the shader.
+					Material->PreEditChange(NULL);
+					Material->PostEditChange();
+#endif // WITH_EDITOR
+				}
+
+				GShaderCompilingManager->FinishAllCompilation();
+			}
+			const double ElapsedTime = FPlatformTime::Seconds() - StartTime;
+
+			int32 NumJobsAfter = 0;
+			double WorkersBusyTimeAfter = 0;
+			GShaderCompilingManager->GetCompletedJobStats(NumJobsAfter, WorkersBusyTimeAfter);
+
+			const int32 NumJobs = NumJobsAfter - NumJobsBefore;
+			UE_LOG(LogShaderCompilers, Display, TEXT("Shader compile benchmark: %d jobs in %.3fs (%.1f jobs/s), workers busy for %.3fs"),
+				NumJobs, ElapsedTime, ElapsedTime > 0 ? NumJobs / ElapsedTime : 0.0, WorkersBusyTimeAfter - WorkersBusyTimeBefore);
+		}
 		else
 		{
 			TArray<FShaderType*> ShaderTypes = FShaderType::GetShaderTypesByFilename(*FlagStr);
@@ -2414,6 +2533,6 @@ bool RecompileShaders(const TCHAR* Cmd, FOutputDevice& Ar)
 		return 1;
 	}
 
-	UE_LOG(LogShaderCompilers, Warning, TEXT("Invalid parameter. Options are: \n'Changed', 'Global', 'Material [name]', 'All' 'Platform [name]'\nNote: Platform implies Changed, and requires the proper target platform modules to be compiled."));
+	UE_LOG(LogShaderCompilers, Warning, TEXT("Invalid parameter. Options are: \n'Changed', 'Global', 'Material [name]', 'All', 'Benchmark' 'Platform [name]'\nNote: Platform implies Changed, and requires the proper target platform modules to be compiled."));
 	return 1;
 }
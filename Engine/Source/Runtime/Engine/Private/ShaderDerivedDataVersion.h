@@ -9,5 +9,5 @@
 // In case of merge conflicts with DDC versions, you MUST generate a new GUID and set this new
 // guid as version
 
-#define GLOBALSHADERMAP_DERIVEDDATA_VER			TEXT("af1606fcec114373844d2b6cf9df71c8")
-#define MATERIALSHADERMAP_DERIVEDDATA_VER		TEXT("85dd00daf10d45c79d4ed0306af2628b")
+#define GLOBALSHADERMAP_DERIVEDDATA_VER			TEXT("2ac0917488d74b5aa81a2b30d97ed0ad")
+#define MATERIALSHADERMAP_DERIVEDDATA_VER		TEXT("5792d46ac0284f2cb172b2f20f32d700")
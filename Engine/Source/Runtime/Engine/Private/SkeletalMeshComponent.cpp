@@ -25,8 +25,14 @@
 #endif
 #include "PhysicsEngine/PhysicsSettings.h"
 #include "PhysicsEngine/PhysicsAsset.h"
+#include "Animation/SkeletalMeshActor.h"
 
 TAutoConsoleVariable<int32> CVarUseParallelAnimationEvaluation(TEXT("a.ParallelAnimEvaluation"), 1, TEXT("If 1, animation evaluation will be run across the task graph system. If 0, evaluation will run purely on the game thread"));
+TAutoConsoleVariable<int32> CVarBatchParallelAnimationCompletion(TEXT("a.ParallelAnimEvaluation.Batched"), 1, TEXT("If 1, components evaluated in parallel during the same tick group hand their results back to the game thread in a single bulk sync. If 0, each component schedules its own game thread completion task"));
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Anim Eval Batches"), STAT_AnimEvalBatches, STATGROUP_Anim);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Batched Anim Evaluations"), STAT_BatchedAnimEvaluations, STATGROUP_Anim);
+DECLARE_CYCLE_STAT(TEXT("Complete Anim Eval Batch"), STAT_CompleteAnimEvalBatch, STATGROUP_Anim);
 
 class FParallelAnimationEvaluationTask
 {
@@ -92,6 +98,175 @@ public:
 	}
 };
 
+/** Components whose animation is being evaluated in parallel and whose results are handed back to the game thread together */
+struct FParallelAnimationEvaluationBatch
+{
+	TArray<TWeakObjectPtr<USkeletalMeshComponent>> Components;
+	FGraphEventArray EvaluationEvents;
+};
+
+class FParallelAnimationBatchCompletionTask
+{
+	TSharedPtr<FParallelAnimationEvaluationBatch> Batch;
+
+public:
+	FParallelAnimationBatchCompletionTask(TSharedPtr<FParallelAnimationEvaluationBatch> InBatch)
+		: Batch(InBatch)
+	{
+	}
+
+	FORCEINLINE TStatId GetStatId() const
+	{
+		RETURN_QUICK_DECLARE_CYCLE_STAT(FParallelAnimationBatchCompletionTask, STATGROUP_TaskGraphTasks);
+	}
+	static ENamedThreads::Type GetDesiredThread()
+	{
+		return ENamedThreads::GameThread;
+	}
+	static ESubsequentsMode::Type GetSubsequentsMode()
+	{
+		return ESubsequentsMode::TrackSubsequents;
+	}
+
+	void DoTask(ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+	{
+		SCOPE_CYCLE_COUNTER(STAT_CompleteAnimEvalBatch);
+
+		// Results are applied in the order the components ticked
+		for (const TWeakObjectPtr<USkeletalMeshComponent>& Component : Batch->Components)
+		{
+			if (USkeletalMeshComponent* Comp = Component.Get())
+			{
+				Comp->CompleteParallelAnimationEvaluation();
+			}
+		}
+	}
+};
+
+/** Batch that components are currently being added to. Only accessed on the game thread. */
+static TSharedPtr<FParallelAnimationEvaluationBatch> GOpenAnimationEvaluationBatch;
+/** Fires once every component in GOpenAnimationEvaluationBatch has had its results applied */
+static FGraphEventRef GOpenAnimationEvaluationBatchEvent;
+
+/**
+ * Closes the open batch. Runs on the game thread after the ticks that were already queued when the batch was opened,
+ * so it does not depend on anything that is waiting on the batch.
+ */
+class FParallelAnimationBatchCloseTask
+{
+	TSharedPtr<FParallelAnimationEvaluationBatch> Batch;
+
+public:
+	FParallelAnimationBatchCloseTask(TSharedPtr<FParallelAnimationEvaluationBatch> InBatch)
+		: Batch(InBatch)
+	{
+	}
+
+	FORCEINLINE TStatId GetStatId() const
+	{
+		RETURN_QUICK_DECLARE_CYCLE_STAT(FParallelAnimationBatchCloseTask, STATGROUP_TaskGraphTasks);
+	}
+	static ENamedThreads::Type GetDesiredThread()
+	{
+		return ENamedThreads::GameThread;
+	}
+	static ESubsequentsMode::Type GetSubsequentsMode()
+	{
+		return ESubsequentsMode::TrackSubsequents;
+	}
+
+	void DoTask(ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+	{
+		check(GOpenAnimationEvaluationBatch == Batch);
+		GOpenAnimationEvaluationBatch.Reset();
+		GOpenAnimationEvaluationBatchEvent = NULL;
+
+		INC_DWORD_STAT(STAT_AnimEvalBatches);
+
+		// One game thread sync for every component that joined the batch
+		FGraphEventRef BatchCompletionEvent = TGraphTask<FParallelAnimationBatchCompletionTask>::CreateTask(&Batch->EvaluationEvents, CurrentThread).ConstructAndDispatchWhenReady(Batch);
+		MyCompletionGraphEvent->DontCompleteUntil(BatchCompletionEvent);
+	}
+};
+
+/** Adds a component whose evaluation task has been dispatched to the open batch, opening one if needed. Returns the event to hold the component's tick on. */
+static FGraphEventRef AddToParallelAnimationEvaluationBatch(USkeletalMeshComponent* Component, const FGraphEventRef& EvaluationEvent)
+{
+	check(IsInGameThread());
+
+	if (!GOpenAnimationEvaluationBatch.IsValid())
+	{
+		GOpenAnimationEvaluationBatch = MakeShareable(new FParallelAnimationEvaluationBatch());
+		GOpenAnimationEvaluationBatchEvent = TGraphTask<FParallelAnimationBatchCloseTask>::CreateTask(NULL, ENamedThreads::GameThread).ConstructAndDispatchWhenReady(GOpenAnimationEvaluationBatch);
+	}
+
+	GOpenAnimationEvaluationBatch->Components.Add(Component);
+	GOpenAnimationEvaluationBatch->EvaluationEvents.Add(EvaluationEvent);
+	INC_DWORD_STAT(STAT_BatchedAnimEvaluations);
+
+	return GOpenAnimationEvaluationBatchEvent;
+}
+
+#if !UE_BUILD_SHIPPING
+/** Spawns copies of an animated skeletal mesh in the world so parallel evaluation can be profiled with 'stat anim' under load */
+static void SpawnAnimationStressTest(const TArray<FString>& Args, UWorld* InWorld)
+{
+	const int32 NumToSpawn = (Args.Num() > 0) ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 300;
+
+	USkeletalMeshComponent* Template = NULL;
+	for (TObjectIterator<USkeletalMeshComponent> It; It; ++It)
+	{
+		if (It->GetWorld() == InWorld && It->IsRegistered() && !It->IsPendingKill() && It->SkeletalMesh && It->AnimScriptInstance)
+		{
+			Template = *It;
+			break;
+		}
+	}
+
+	if (!Template)
+	{
+		UE_LOG(LogAnimation, Warning, TEXT("a.ParallelAnimEvaluation.StressTest: no animated skeletal mesh in the world to copy."));
+		return;
+	}
+
+	const int32 GridSize = FMath::CeilToInt(FMath::Sqrt(NumToSpawn));
+	const float Spacing = FMath::Max(Template->Bounds.SphereRadius * 2.f, 100.f);
+	const FVector Origin = Template->GetComponentLocation();
+
+	FActorSpawnParameters SpawnInfo;
+	SpawnInfo.bNoCollisionFail = true;
+
+	int32 NumSpawned = 0;
+	for (int32 Index = 0; Index < NumToSpawn; ++Index)
+	{
+		const FVector Location = Origin + FVector((Index % GridSize + 1) * Spacing, (Index / GridSize) * Spacing, 0.f);
+		ASkeletalMeshActor* Actor = InWorld->SpawnActor<ASkeletalMeshActor>(Location, Template->GetComponentRotation(), SpawnInfo);
+		if (Actor)
+		{
+			USkeletalMeshComponent* Comp = Actor->GetSkeletalMeshComponent();
+			Comp->SetSkeletalMesh(Template->SkeletalMesh);
+			if (Template->GetAnimationMode() == EAnimationMode::AnimationBlueprint)
+			{
+				Comp->SetAnimInstanceClass(Template->AnimBlueprintGeneratedClass);
+			}
+			else if (Template->AnimationData.AnimToPlay)
+			{
+				Comp->PlayAnimation(Template->AnimationData.AnimToPlay, true);
+			}
+			++NumSpawned;
+		}
+	}
+
+	UE_LOG(LogAnimation, Log, TEXT("a.ParallelAnimEvaluation.StressTest: spawned %d copies of %s. Compare 'stat anim' with a.ParallelAnimEvaluation and a.ParallelAnimEvaluation.Batched toggled."), NumSpawned, *GetNameSafe(Template->SkeletalMesh));
+}
+
+FAutoConsoleCommandWithWorldAndArgs SpawnAnimationStressTestCommand(
+	TEXT("a.ParallelAnimEvaluation.StressTest"),
+	TEXT("Spawns copies (default 300) of the first animated skeletal mesh in the world to stress animation evaluation. Usage: a.ParallelAnimEvaluation.StressTest [Count]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(SpawnAnimationStressTest)
+	);
+#endif
+
 USkeletalMeshComponent::USkeletalMeshComponent(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
@@ -954,6 +1129,11 @@ void USkeletalMeshComponent::RefreshBoneTransforms(FActorComponentTickFunction*
 	AnimEvaluationContext.bDoInterpolation = bDoUpdateRateOptimization && !bInvalidCachedBones && AnimUpdateRateParams.ShouldInterpolateSkippedFrames();
 	AnimEvaluationContext.bDuplicateToCacheBones = bInvalidCachedBones || (bDoUpdateRateOptimization && AnimEvaluationContext.bDoEvaluation && !AnimEvaluationContext.bDoInterpolation);
 
+	if (!AnimEvaluationContext.bDoEvaluation)
+	{
+		INC_DWORD_STAT(STAT_AnimSkippedEvaluations);
+	}
+
 	if (!bDoUpdateRateOptimization)
 	{
 		//If we aren't optimizing clear the cached local atoms
@@ -975,12 +1155,20 @@ void USkeletalMeshComponent::RefreshBoneTransforms(FActorComponentTickFunction*
 		// start parallel work
 		FGraphEventRef EvaluationTickEvent = TGraphTask<FParallelAnimationEvaluationTask>::CreateTask().ConstructAndDispatchWhenReady(this);
 
-		// set up a task to run on the game thread to accept the results
-		FGraphEventArray Prerequistes;
-		Prerequistes.Add(EvaluationTickEvent);
-		FGraphEventRef TickCompletionEvent = TGraphTask<FParallelAnimationCompletionTask>::CreateTask(&Prerequistes).ConstructAndDispatchWhenReady(this);
+		if (CVarBatchParallelAnimationCompletion.GetValueOnGameThread())
+		{
+			// accept the results together with every other component evaluated in this tick group
+			TickFunction->GetCompletionHandle()->DontCompleteUntil(AddToParallelAnimationEvaluationBatch(this, EvaluationTickEvent));
+		}
+		else
+		{
+			// set up a task to run on the game thread to accept the results
+			FGraphEventArray Prerequistes;
+			Prerequistes.Add(EvaluationTickEvent);
+			FGraphEventRef TickCompletionEvent = TGraphTask<FParallelAnimationCompletionTask>::CreateTask(&Prerequistes).ConstructAndDispatchWhenReady(this);
 
-		TickFunction->GetCompletionHandle()->DontCompleteUntil(TickCompletionEvent);
+			TickFunction->GetCompletionHandle()->DontCompleteUntil(TickCompletionEvent);
+		}
 	}
 	else
 	{
@@ -1003,7 +1191,6 @@ void USkeletalMeshComponent::RefreshBoneTransforms(FActorComponentTickFunction*
 
 		PostAnimEvaluation(AnimEvaluationContext);
 	}
-
 }
 
 void USkeletalMeshComponent::PostAnimEvaluation(FAnimationEvaluationContext& EvaluationContext)
@@ -1025,8 +1212,10 @@ void USkeletalMeshComponent::PostAnimEvaluation(FAnimationEvaluationContext& Eva
 	if (EvaluationContext.bDoInterpolation)
 	{
 		SCOPE_CYCLE_COUNTER(STAT_InterpolateSkippedFrames);
+		INC_DWORD_STAT(STAT_AnimInterpolatedFrames);
 
-		const float Alpha = 0.25f + (1.f / float(FMath::Max(AnimUpdateRateParams.GetEvaluationRate(), 2) * 2));
+		// Walk linearly from the pose displayed when the last evaluation happened to the evaluated pose, reaching it right before the next evaluation.
+		const float Alpha = AnimUpdateRateParams.GetInterpolationAlpha();
 		FAnimationRuntime::LerpBoneTransforms(LocalAtoms, CachedLocalAtoms, Alpha, RequiredBones);
 		if (bDoubleBufferedBlendSpaces)
 		{
@@ -26,6 +26,10 @@ FAutoConsoleVariableRef CVarSkeletalMeshLODBias(
 	ECVF_Scalability
 	);
 
+static TAutoConsoleVariable<int32> CVarForceFullUpdateRate(TEXT("a.URO.ForceFullRate"), 0, TEXT("If 1, update rate optimizations are bypassed and every animated mesh is updated and evaluated every frame."));
+static TAutoConsoleVariable<int32> CVarMaxEvaluationRate(TEXT("a.URO.MaxEvaluationRate"), 4, TEXT("Highest evaluation rate (evaluate once every N frames) update rate optimizations may pick for a visible mesh."));
+static TAutoConsoleVariable<int32> CVarDrawUpdateRateOptimizations(TEXT("a.URO.Draw"), 0, TEXT("If 1, draws the update rate of every mesh using update rate optimizations. See bDisplayDebugUpdateRateOptimizations for the color legend."));
+
 void USkinnedMeshComponent::OnRegister()
 {
 	// The reason this happens before register
@@ -233,8 +237,8 @@ void USkinnedMeshComponent::TickUpdateRate()
 				AnimUpdateRateTick();
 			}
 
-			// debug -- @todo: hook this up to a console command.
-			if (bDisplayDebugUpdateRateOptimizations)
+			// debug
+			if (bDisplayDebugUpdateRateOptimizations || CVarDrawUpdateRateOptimizations.GetValueOnGameThread())
 			{
 				FColor DrawColor;
 				switch (AnimUpdateRateParams.GetUpdateRate())
@@ -267,6 +271,7 @@ void USkinnedMeshComponent::TickComponent(float DeltaTime, enum ELevelTick TickT
 	{
 		if (bEnableUpdateRateOptimizations && AnimUpdateRateParams.ShouldSkipUpdate())
 		{
+			INC_DWORD_STAT(STAT_AnimSkippedUpdates);
 			SkippedTickDeltaTime += DeltaTime;
 			if( !bRecentlyRendered )
 			{
@@ -1759,7 +1764,9 @@ void USkinnedMeshComponent::AnimUpdateRateTick()
 	// Go through components and figure out if they've been recently rendered, and the biggest MaxDistanceFactor
 	bool bRecentlyRendered = false;
 	bool bPlayingRootMotion = false;
+	bool bForceFullRate = false;
 	float MaxDistanceFactor = 0.f;
+	int32 MinLODLevel = PredictedLODLevel;
 
 	// Gather Actor's components
 	TArray<USceneComponent *> ComponentStack;
@@ -1778,6 +1785,8 @@ void USkinnedMeshComponent::AnimUpdateRateTick()
 				bRecentlyRendered = bRecentlyRendered || (SkinMeshComp->LastRenderTime > (GetWorld()->TimeSeconds - 1.f));
 				MaxDistanceFactor = FMath::Max(MaxDistanceFactor, SkinMeshComp->MaxDistanceFactor);
 				bPlayingRootMotion = bPlayingRootMotion || SkinMeshComp->IsPlayingRootMotion();
+				bForceFullRate = bForceFullRate || SkinMeshComp->bForceFullUpdateRate;
+				MinLODLevel = FMath::Min(MinLODLevel, SkinMeshComp->PredictedLODLevel);
 			}
 		}
 
@@ -1785,10 +1794,10 @@ void USkinnedMeshComponent::AnimUpdateRateTick()
 	}
 
 	// Figure out which update rate should be used.
-	AnimUpdateRateSetParams(bRecentlyRendered, MaxDistanceFactor, bPlayingRootMotion);
+	AnimUpdateRateSetParams(bRecentlyRendered, MaxDistanceFactor, bPlayingRootMotion, MinLODLevel, bForceFullRate);
 }
 
-void USkinnedMeshComponent::AnimUpdateRateSetParams(const bool & bRecentlyRendered, const float& MaxDistanceFactor, const bool & bPlayingRootMotion)
+void USkinnedMeshComponent::AnimUpdateRateSetParams(const bool & bRecentlyRendered, const float& MaxDistanceFactor, const bool & bPlayingRootMotion, const int32& MinLODLevel, const bool & bForceFullRate)
 {
 	// default rules for setting update rates
 
@@ -1802,8 +1811,13 @@ void USkinnedMeshComponent::AnimUpdateRateSetParams(const bool & bRecentlyRender
 	AController * Controller = Owner->GetInstigatorController();
 	const bool bHumanControlled = Controller && (Cast<APlayerController>(Controller) != NULL);
 
+	// Gameplay (or debugging) asked for exact poses.
+	if (bForceFullRate || CVarForceFullUpdateRate.GetValueOnGameThread())
+	{
+		AnimUpdateRateParams.Set(*Owner, 1, 1, false);
+	}
 	// Not rendered, including dedicated servers. we can skip the Evaluation part.
-	if (!bRecentlyRendered)
+	else if (!bRecentlyRendered)
 	{
 		AnimUpdateRateParams.Set(*Owner, (bHumanControlled ? 1 : 4), 4, false);
 	}
@@ -1830,6 +1844,10 @@ void USkinnedMeshComponent::AnimUpdateRateSetParams(const bool & bRecentlyRender
 			DesiredEvaluationRate = 3;
 		}
 
+		// Lower LODs drop bones and detail, so skipped frames are even less noticeable on them.
+		DesiredEvaluationRate = FMath::Max(DesiredEvaluationRate, MinLODLevel + 1);
+		DesiredEvaluationRate = FMath::Clamp(DesiredEvaluationRate, 1, FMath::Max(CVarMaxEvaluationRate.GetValueOnGameThread(), 1));
+
 		AnimUpdateRateParams.Set(*Owner, DesiredEvaluationRate, DesiredEvaluationRate, true);
 	}
 }
@@ -1872,10 +1890,12 @@ void FAnimUpdateRateParameters::Set(class AActor& Owner, const int32& NewUpdateR
 	EvaluationRate = FMath::Max((NewEvaluationRate / UpdateRate) * UpdateRate, 1);
 	bInterpolateSkippedFrames = bNewInterpSkippedFrames;
 
-	// Make sure we don't overflow. we don't need very large numbers.
-	const uint32 Counter = (GFrameCounter % MAX_uint8) + (Owner.GetAnimUpdateRateShiftTag() % MAX_uint8);
+	// Owners are handed out consecutive shift tags, which staggers actors sharing the same rate evenly across frames.
+	// Keep the full 64 bit frame counter, wrapping it to a small range would periodically break the cadence.
+	const uint64 Counter = GFrameCounter + Owner.GetAnimUpdateRateShiftTag();
 
 	bSkipUpdate = ((Counter % UpdateRate) > 0);
-	bSkipEvaluation = ((Counter % EvaluationRate) > 0);
+	FramesSinceEvaluation = int32(Counter % EvaluationRate);
+	bSkipEvaluation = (FramesSinceEvaluation > 0);
 }
 
@@ -14,6 +14,10 @@ DECLARE_CYCLE_STAT(TEXT("Queue Ticks Wait"),STAT_QueueTicksWait,STATGROUP_Game);
 DECLARE_CYCLE_STAT(TEXT("Queue Tick Task"),STAT_QueueTickTask,STATGROUP_Game);
 DECLARE_CYCLE_STAT(TEXT("Post Queue Tick Task"),STAT_PostTickTask,STATGROUP_Game);
 DECLARE_DWORD_COUNTER_STAT(TEXT("Ticks Queued"),STAT_TicksQueued,STATGROUP_Game);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Ticks Batched"),STAT_TicksBatched,STATGROUP_Game);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Tick Batches"),STAT_TickBatches,STATGROUP_Game);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Tick Tasks Saved By Batching"),STAT_TickTasksSaved,STATGROUP_Game);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Ticks Cooling Down"),STAT_TicksCoolingDown,STATGROUP_Game);
 
 static TAutoConsoleVariable<int32> CVarLogTicks(
 	TEXT("LogTicks"),0,
@@ -24,6 +28,16 @@ static TAutoConsoleVariable<int32> CVarAllowAsyncComponentTicks(
 	0,
 	TEXT("Used to control async component ticks."));
 
+static TAutoConsoleVariable<int32> CVarAllowBatchedTicks(
+	TEXT("AllowBatchedTicks"),
+	1,
+	TEXT("If true, tick functions that allow batching and have no prerequisites are ticked in batches, one task per batch."));
+
+static TAutoConsoleVariable<int32> CVarTickBatchSize(
+	TEXT("TickBatchSize"),
+	64,
+	TEXT("Maximum number of tick functions ticked by a single batch task."));
+
 struct FTickContext
 {
 	/** Delta time to tick **/
@@ -76,6 +90,26 @@ class FTickTaskSequencer
 	/** If true, log each tick **/
 	bool				bLogTicks; 
 
+	/** If true, tick functions that allow it are queued in batches **/
+	bool				bAllowBatchedTicks;
+
+	/** Maximum number of tick functions in a batch **/
+	int32				MaxTickBatchSize;
+
+	/** Tick functions gathered for a single batch task, which is dispatched when the batch is full or its tick group is released **/
+	struct FTickFunctionBatch
+	{
+		/** Tick functions of the batch **/
+		TArray<FTickFunction*>	TickFunctions;
+		/** Completion event shared by all tick functions of the batch, fired once the batch task ticked all of them **/
+		FGraphEventRef			CompletionEvent;
+		/** tick context, here thread is desired execution thread **/
+		FTickContext			Context;
+	};
+
+	/** Batches being gathered for each tick group, on the game thread and on any thread **/
+	FTickFunctionBatch	OpenTickBatches[TG_MAX][2];
+
 public:
 
 	/**
@@ -121,6 +155,17 @@ public:
 		TickFunction->CompletionHandle = TGraphTask<FTickFunctionTask>::CreateTask(Prerequisites, TickContext.Thread).ConstructAndDispatchWhenReady(TickFunction, &UseContext, bLogTicks);
 	}
 
+	/**
+	 * Return the delta time to tick a tick function with
+	 * @param	TickFunction - the tick function about to tick
+	 * @param	Context - tick context of the frame
+	 */
+	FORCEINLINE static float GetTickDeltaSeconds(const FTickFunction* TickFunction, const FTickContext& TickContext)
+	{
+		// tick functions with an interval get the time elapsed since their previous tick
+		return TickFunction->TickIntervalDeltaSeconds > 0.0f ? TickFunction->TickIntervalDeltaSeconds : TickContext.DeltaSeconds;
+	}
+
 	/** Add a completion handle to a tick group **/
 	FORCEINLINE void AddTickTaskCompletion(ETickingGroup TickGroup, const FGraphEventRef& CompletionHandle)
 	{
@@ -147,6 +192,50 @@ public:
 		AddTickTaskCompletion(TickFunction->ActualTickGroup, TickFunction->CompletionHandle);
 	}
 
+	/** Return true if tick functions that allow it should be queued with QueueBatchedTickTask this frame **/
+	FORCEINLINE bool ShouldBatchTicks() const
+	{
+		return bAllowBatchedTicks;
+	}
+
+	/**
+	 * Add a tick function without prerequisites to the open batch of its tick group, instead of starting a task for it
+	 *
+	 * @param	TickFunction - the tick function to queue
+	 * @param	Context - tick context to tick in. Thread here is the current thread.
+	 */
+	void QueueBatchedTickTask(FTickFunction* TickFunction, const FTickContext& TickContext)
+	{
+		checkSlow(TickContext.Thread == ENamedThreads::GameThread);
+		checkSlow(TickFunction->ActualTickGroup >=0 && TickFunction->ActualTickGroup < TG_MAX);
+
+		const bool bIsOriginalTickGroup = (TickFunction->ActualTickGroup == TickFunction->TickGroup);
+		const bool bRunOnAnyThread = TickFunction->bRunOnAnyThread && bAllowConcurrentTicks && bIsOriginalTickGroup;
+
+		FTickFunctionBatch& Batch = OpenTickBatches[TickFunction->ActualTickGroup][bRunOnAnyThread ? 1 : 0];
+		if (!Batch.CompletionEvent.GetReference())
+		{
+			Batch.CompletionEvent = FGraphEvent::CreateGraphEvent();
+			Batch.Context = TickContext;
+			Batch.Context.Thread = bRunOnAnyThread ? ENamedThreads::AnyThread : ENamedThreads::GameThread;
+			AddTickTaskCompletion(TickFunction->ActualTickGroup, Batch.CompletionEvent);
+			INC_DWORD_STAT(STAT_TickBatches);
+		}
+		else
+		{
+			INC_DWORD_STAT(STAT_TickTasksSaved);
+		}
+		INC_DWORD_STAT(STAT_TicksBatched);
+
+		Batch.TickFunctions.Add(TickFunction);
+		TickFunction->CompletionHandle = Batch.CompletionEvent;
+
+		if (Batch.TickFunctions.Num() >= MaxTickBatchSize)
+		{
+			DispatchTickBatch(Batch, TickFunction->ActualTickGroup, TickContext.Thread);
+		}
+	}
+
 	/** return the start event for a given tick group **/
 	FORCEINLINE FGraphEventRef& GetTickGroupStartEvent(ETickingGroup TickGroup)
 	{
@@ -168,6 +257,15 @@ public:
 		checkSlow(WorldTickGroup >=0 && WorldTickGroup < TG_MAX);
 		check(TickGroupStartEvents[WorldTickGroup].GetReference()); // the start event should exist
 
+		// the batches of this tick group can't grow anymore, they have to be waiting on the start event when it fires
+		for (int32 ThreadIndex = 0; ThreadIndex < 2; ThreadIndex++)
+		{
+			if (OpenTickBatches[WorldTickGroup][ThreadIndex].CompletionEvent.GetReference())
+			{
+				DispatchTickBatch(OpenTickBatches[WorldTickGroup][ThreadIndex], WorldTickGroup, ENamedThreads::GameThread);
+			}
+		}
+
 		if (SingleThreadedMode())
 		{
 			TickGroupStartEvents[WorldTickGroup]->DispatchSubsequents(ENamedThreads::GameThread); // start this tick group
@@ -232,6 +330,8 @@ public:
 		{
 			bAllowConcurrentTicks = !!CVarAllowAsyncComponentTicks.GetValueOnGameThread();
 		}
+		bAllowBatchedTicks = !!CVarAllowBatchedTicks.GetValueOnGameThread();
+		MaxTickBatchSize = FMath::Max(CVarTickBatchSize.GetValueOnGameThread(), 1);
 		for (int32 Index = 0; Index < TG_MAX; Index++)
 		{
 			check(!TickCompletionEvents[Index].Num());  // we should not be adding to these outside of a ticking proper and they were already cleared after they were ticked
@@ -254,6 +354,7 @@ public:
 		{
 			check(!TickCompletionEvents[Index].Num());  // we should not be adding to these outside of a ticking proper and they were already cleared after they were ticked
 			check(!TickGroupStartEvents[Index].GetReference()); // this should have been NULL'ed out after it was released
+			check(!OpenTickBatches[Index][0].CompletionEvent.GetReference() && !OpenTickBatches[Index][1].CompletionEvent.GetReference()); // batches are dispatched when their tick group is released
 		}
 	}
 private:
@@ -261,7 +362,24 @@ private:
 	FTickTaskSequencer()
 		: bAllowConcurrentTicks(false)
 		, bLogTicks(false)
+		, bAllowBatchedTicks(false)
+		, MaxTickBatchSize(1)
+	{
+	}
+
+	/**
+	 * Start the task ticking a batch and close the batch
+	 * @param Batch - batch to dispatch
+	 * @param TickGroup - tick group of the batch
+	 * @param CurrentThread - thread we are dispatching from
+	 */
+	void DispatchTickBatch(FTickFunctionBatch& Batch, ETickingGroup TickGroup, ENamedThreads::Type CurrentThread)
 	{
+		FGraphEventArray Prerequisites;
+		Prerequisites.Add(GetTickGroupStartEvent(TickGroup));
+		TGraphTask<FTickFunctionBatchTask>::CreateTask(&Prerequisites, CurrentThread).ConstructAndDispatchWhenReady(&Batch, bLogTicks);
+		check(!Batch.TickFunctions.Num()); // the task took the tick functions
+		Batch.CompletionEvent = NULL;
 	}
 
 	void DispatchTickGroup(ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent,ETickingGroup WorldTickGroup)
@@ -318,19 +436,104 @@ private:
 			{
 				UE_LOG(LogTick, Log, TEXT("tick %6d %2d %s"),GFrameCounter, (int32)CurrentThread, *Target->DiagnosticMessage());
 			}
-			Target->ExecuteTick(Context.DeltaSeconds, Context.TickType, CurrentThread, MyCompletionGraphEvent);
+			Target->ExecuteTick(GetTickDeltaSeconds(Target, Context), Context.TickType, CurrentThread, MyCompletionGraphEvent);
 			Target->CompletionHandle = NULL; // Allow the old completion handle to be recycled
 		}
 	};
+
+	/** Helper class define the task of ticking a batch of tick functions without prerequisites **/
+	class FTickFunctionBatchTask
+	{
+		/** Functions to tick **/
+		TArray<FTickFunction*>	Targets;
+		/** Completion event shared by the targets, this is what the tick group and other tick functions wait on **/
+		FGraphEventRef			BatchCompletionEvent;
+		/** tick context, here thread is desired execution thread **/
+		FTickContext			Context;
+		/** If true, log each tick **/
+		bool					bLogTick;
+	public:
+		/** Constructor
+		 * @param InBatch - Batch to tick, its tick functions are moved to the task
+		 * @param InbLogTick - If true, log each tick
+		**/
+		FTickFunctionBatchTask(FTickFunctionBatch* InBatch, bool InbLogTick)
+			: BatchCompletionEvent(InBatch->CompletionEvent)
+			, Context(InBatch->Context)
+			, bLogTick(InbLogTick)
+		{
+			Exchange(Targets, InBatch->TickFunctions);
+		}
+		FORCEINLINE TStatId GetStatId() const
+		{
+			RETURN_QUICK_DECLARE_CYCLE_STAT(FTickFunctionBatchTask, STATGROUP_TaskGraphTasks);
+		}
+		/** return the thread for this task **/
+		ENamedThreads::Type GetDesiredThread()
+		{
+			return Context.Thread;
+		}
+		static ESubsequentsMode::Type GetSubsequentsMode()
+		{
+			return ESubsequentsMode::TrackSubsequents;
+		}
+		/**
+		 *	Tick all the targets, then fire the completion event of the batch.
+		 *	@param	CurrentThread; the thread we are running on
+		 *	@param	MyCompletionGraphEvent; my completion event. Nothing waits on it, the targets hand out the batch completion event instead.
+		 **/
+		void DoTask(ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+		{
+			for (int32 Index = 0; Index < Targets.Num(); Index++)
+			{
+				FTickFunction* Target = Targets[Index];
+				if (bLogTick)
+				{
+					UE_LOG(LogTick, Log, TEXT("tick %6d %2d %s (batched)"),GFrameCounter, (int32)CurrentThread, *Target->DiagnosticMessage());
+				}
+				// a target delaying its completion with DontCompleteUntil delays the whole batch
+				Target->ExecuteTick(GetTickDeltaSeconds(Target, Context), Context.TickType, CurrentThread, BatchCompletionEvent);
+				Target->CompletionHandle = NULL; // Allow the old completion handle to be recycled
+			}
+			BatchCompletionEvent->DispatchSubsequents(CurrentThread);
+		}
+	};
 };
 
 
 class FTickTaskLevel
 {
+	/** Next tick time of a tick function with a tick interval, ordered by due time **/
+	struct FTickScheduleDetails
+	{
+		/** Tick function to schedule, only valid while Serial matches the one in ScheduledTickFunctions **/
+		FTickFunction*	TickFunction;
+		/** Level time at which the tick function is due **/
+		double			DueTime;
+		/** Level time of the previous tick, or of the scheduling when it did not tick yet **/
+		double			LastTickTime;
+		/** Identifies this scheduling of the tick function, entries left behind by removed tick functions don't match anymore **/
+		uint32			Serial;
+
+		FTickScheduleDetails(FTickFunction* InTickFunction, double InDueTime, double InLastTickTime, uint32 InSerial)
+			: TickFunction(InTickFunction)
+			, DueTime(InDueTime)
+			, LastTickTime(InLastTickTime)
+			, Serial(InSerial)
+		{
+		}
+		bool operator<(const FTickScheduleDetails& Other) const
+		{
+			return DueTime < Other.DueTime;
+		}
+	};
+
 public:
 	/** Constructor, grabs, the sequencer singleton **/
 	FTickTaskLevel()
 		: TickTaskSequencer(FTickTaskSequencer::Get())
+		, LevelTime(0.0)
+		, LastScheduleSerial(0)
 		, bTickNewlySpawned(false)
 	{
 	}
@@ -344,6 +547,11 @@ public:
 		{
 			(*It)->bRegistered = false;
 		}
+		for (TMap<FTickFunction *, uint32>::TIterator It(ScheduledTickFunctions); It; ++It)
+		{
+			It.Key()->bRegistered = false;
+			It.Key()->bTickCoolingDown = false;
+		}
 	}
 
 	/**
@@ -359,7 +567,24 @@ public:
 		Context.TickType = InContext.TickType;
 		Context.Thread = ENamedThreads::GameThread;
 		bTickNewlySpawned = true;
-		return AllEnabledTickFunctions.Num();
+
+		// only the tick functions whose interval elapsed are taken out of the schedule, the others are not touched this frame
+		check(!TickFunctionsDueThisFrame.Num());
+		LevelTime += InContext.DeltaSeconds;
+		while (AllCoolingDownTickFunctions.Num() && AllCoolingDownTickFunctions.HeapTop().DueTime <= LevelTime)
+		{
+			FTickScheduleDetails Details = AllCoolingDownTickFunctions.HeapTop();
+			AllCoolingDownTickFunctions.HeapPopDiscard();
+			if (IsScheduleCurrent(Details))
+			{
+				Details.TickFunction->bTickCoolingDown = false;
+				Details.TickFunction->TickIntervalDeltaSeconds = float(LevelTime - Details.LastTickTime);
+				TickFunctionsDueThisFrame.Add(Details);
+			}
+		}
+		INC_DWORD_STAT_BY(STAT_TicksCoolingDown, ScheduledTickFunctions.Num() - TickFunctionsDueThisFrame.Num());
+
+		return AllEnabledTickFunctions.Num() + TickFunctionsDueThisFrame.Num();
 	}
 	/* Queue all tick functions for execution */
 	void QueueAllTicks()
@@ -368,11 +593,42 @@ public:
 		{
 			(*It)->QueueTickFunction(Context);
 		}
+		for (int32 Index = 0; Index < TickFunctionsDueThisFrame.Num(); Index++)
+		{
+			TickFunctionsDueThisFrame[Index].TickFunction->QueueTickFunction(Context);
+		}
+	}
+	/**
+	 * Gather all tick functions to queue this frame
+	 * @param OutTickFunctions - array the tick functions are added to
+	 */
+	void GetTickFunctionsToQueue(TArray<FTickFunction*>& OutTickFunctions)
+	{
+		for (TSet<FTickFunction *>::TIterator It(AllEnabledTickFunctions); It; ++It)
+		{
+			OutTickFunctions.Add(*It);
+		}
+		for (int32 Index = 0; Index < TickFunctionsDueThisFrame.Num(); Index++)
+		{
+			OutTickFunctions.Add(TickFunctionsDueThisFrame[Index].TickFunction);
+		}
 	}
-	/* Retrieve the tick set */
-	TSet<FTickFunction *>& GetTickSet()
+	/** Put the tick functions that were due this frame back in the schedule, once they have been queued **/
+	void RescheduleTickFunctionsDueThisFrame()
 	{
-		return AllEnabledTickFunctions;
+		for (int32 Index = 0; Index < TickFunctionsDueThisFrame.Num(); Index++)
+		{
+			const FTickScheduleDetails& Details = TickFunctionsDueThisFrame[Index];
+			// tick functions removed since StartFrame are not in the schedule anymore
+			if (IsScheduleCurrent(Details))
+			{
+				// keep the phase given by ScheduleTickFunction, but never fall behind by more than a frame
+				const double DueTime = FMath::Max(Details.DueTime + Details.TickFunction->TickInterval, LevelTime);
+				Details.TickFunction->bTickCoolingDown = true;
+				AllCoolingDownTickFunctions.HeapPush(FTickScheduleDetails(Details.TickFunction, DueTime, LevelTime, Details.Serial));
+			}
+		}
+		TickFunctionsDueThisFrame.Reset();
 	}
 	/**
 	 * Queues the newly spawned ticks for this level
@@ -411,6 +667,18 @@ public:
 				TickFunction->CompletionHandle = NULL; // Allow the old completion handle to be recycled
 			}
 		}
+		// the schedule doesn't advance during pause frames, tick functions with an interval that tick when paused do it every frame
+		for (TMap<FTickFunction *, uint32>::TIterator It(ScheduledTickFunctions); It; ++It)
+		{
+			FTickFunction* TickFunction = It.Key();
+			if (TickFunction->bTickEvenWhenPaused && (!TickFunction->EnableParent || TickFunction->EnableParent->bTickEnabled))
+			{
+				TickFunction->TickVisitedGFrameCounter = GFrameCounter;
+				TickFunction->TickQueuedGFrameCounter = GFrameCounter;
+				TickFunction->ExecuteTick(InContext.DeltaSeconds, InContext.TickType, ENamedThreads::GameThread, FGraphEventRef());
+				TickFunction->CompletionHandle = NULL; // Allow the old completion handle to be recycled
+			}
+		}
 		check(!NewlySpawnedTickFunctions.Num()); // We don't support new spawns during pause ticks
 	}
 
@@ -425,14 +693,19 @@ public:
 	/** Return true if this tick function is in the master list **/
 	bool HasTickFunction(FTickFunction* TickFunction)
 	{
-		return AllEnabledTickFunctions.Contains(TickFunction) || AllDisabledTickFunctions.Contains(TickFunction);
+		return AllEnabledTickFunctions.Contains(TickFunction) || AllDisabledTickFunctions.Contains(TickFunction) || ScheduledTickFunctions.Contains(TickFunction);
 	}
 	/** Add the tick function to the master list **/
 	void AddTickFunction(FTickFunction* TickFunction)
 	{
 		check(!HasTickFunction(TickFunction));
-		if (TickFunction->bTickEnabled)
+		if (TickFunction->bTickEnabled && TickFunction->TickInterval > 0.0f)
+		{
+			ScheduleTickFunction(TickFunction);
+		}
+		else if (TickFunction->bTickEnabled)
 		{
+			TickFunction->TickIntervalDeltaSeconds = 0.0f;
 			AllEnabledTickFunctions.Add(TickFunction);
 			if (bTickNewlySpawned)
 			{
@@ -481,7 +754,14 @@ public:
 				DumpTickFunction(Ar, *It, TickGroupEnum);
 			}
 		}
-		EnabledCount += AllEnabledTickFunctions.Num();
+		if (bEnabled)
+		{
+			for (TMap<FTickFunction *, uint32>::TIterator It(ScheduledTickFunctions); It; ++It)
+			{
+				DumpTickFunction(Ar, It.Key(), TickGroupEnum);
+			}
+		}
+		EnabledCount += AllEnabledTickFunctions.Num() + ScheduledTickFunctions.Num();
 		if (bDisabled)
 		{
 			for (TSet<FTickFunction *>::TIterator It(AllDisabledTickFunctions); It; ++It)
@@ -495,7 +775,13 @@ public:
 	/** Remove the tick function from the master list **/
 	void RemoveTickFunction(FTickFunction* TickFunction)
 	{
-		if (TickFunction->bTickEnabled)
+		if (ScheduledTickFunctions.Remove(TickFunction))
+		{
+			// enabled tick functions with an interval are in the schedule rather than in the master list,
+			// their schedule entries are dropped when they come up
+			TickFunction->bTickCoolingDown = false;
+		}
+		else if (TickFunction->bTickEnabled)
 		{
 			verify(AllEnabledTickFunctions.Remove(TickFunction) == 1); // otherwise you changed bEnabled while the tick function was registered. Call SetTickFunctionEnable instead.
 		}
@@ -511,6 +797,30 @@ public:
 
 private:
 
+	/**
+	 * Add an enabled tick function with a tick interval to the schedule. Its first tick is spread over the interval,
+	 * so tick functions registered on the same frame with the same interval don't all tick on the same frames.
+	 */
+	void ScheduleTickFunction(FTickFunction* TickFunction)
+	{
+		if (++LastScheduleSerial == 0)
+		{
+			++LastScheduleSerial; // 0 is never a valid serial
+		}
+		const double GoldenRatioSequence = LastScheduleSerial * 0.6180339887;
+		const double StaggerFraction = GoldenRatioSequence - FMath::FloorToDouble(GoldenRatioSequence); // evenly spread whatever the number of tick functions
+		TickFunction->bTickCoolingDown = true;
+		TickFunction->TickIntervalDeltaSeconds = 0.0f;
+		ScheduledTickFunctions.Add(TickFunction, LastScheduleSerial);
+		AllCoolingDownTickFunctions.HeapPush(FTickScheduleDetails(TickFunction, LevelTime + TickFunction->TickInterval * StaggerFraction, LevelTime, LastScheduleSerial));
+	}
+
+	/** Return true if the tick function of a schedule entry is still registered and scheduled by it, without touching the tick function **/
+	FORCEINLINE bool IsScheduleCurrent(const FTickScheduleDetails& Details) const
+	{
+		return ScheduledTickFunctions.FindRef(Details.TickFunction) == Details.Serial;
+	}
+
 	/** Global Sequencer														*/
 	FTickTaskSequencer&							TickTaskSequencer;
 	/** Master list of enabled tick functions **/
@@ -519,6 +829,16 @@ private:
 	TSet<FTickFunction *>						AllDisabledTickFunctions;
 	/** List of tick functions added during a tick phase; these items are also duplicated in AllLiveTickFunctions for future frames **/
 	TSet<FTickFunction *>						NewlySpawnedTickFunctions;
+	/** Enabled tick functions with a tick interval, with the serial of their current schedule entry **/
+	TMap<FTickFunction *, uint32>				ScheduledTickFunctions;
+	/** Heap of the schedule entries waiting for their due time, the first one due on top. May hold entries of removed tick functions **/
+	TArray<FTickScheduleDetails>				AllCoolingDownTickFunctions;
+	/** Tick functions with a tick interval taken out of the schedule to tick this frame **/
+	TArray<FTickScheduleDetails>				TickFunctionsDueThisFrame;
+	/** Time the schedule is based on, advanced by the delta time of every frame. Double, so it keeps frame precision on long running servers **/
+	double										LevelTime;
+	/** Serial of the last schedule entry, also used to stagger tick functions **/
+	uint32										LastScheduleSerial;
 	/** tick context **/
 	FTickContext								Context;
 	/** true during the tick phase, when true, tick function adds also go to the newly spawned list. **/
@@ -621,13 +941,22 @@ public:
 			{
 				LevelList[LevelIndex]->QueueAllTicks();
 			}
+			for( int32 LevelIndex = 0; LevelIndex < LevelList.Num(); LevelIndex++ )
+			{
+				LevelList[LevelIndex]->RescheduleTickFunctionsDueThisFrame();
+			}
 		}
 		else
 		{
 			// parallel case
 
 			// build a list of all tick functions
-			AllTickFunctions.AddZeroed(TotalTickFunctions);
+			AllTickFunctions.Reserve(TotalTickFunctions);
+			for( int32 LevelIndex = 0; LevelIndex < LevelList.Num(); LevelIndex++ )
+			{
+				LevelList[LevelIndex]->GetTickFunctionsToQueue(AllTickFunctions);
+			}
+			check(AllTickFunctions.Num() == TotalTickFunctions);
 			AllCompletionEvents.AddZeroed(TotalTickFunctions);
 
 			// split the array into parts for a bunch of concurrent tasks
@@ -640,32 +969,18 @@ public:
 			
 			check(NumTasks > 1); // assumption, below relating to the remainder
 			int32 NumThisTask = NumPerTask;
-			int32 NumTicksSoFar = 0;
-			int32 Task = 0;
 
-			for( int32 LevelIndex = 0; LevelIndex < LevelList.Num(); LevelIndex++ )
+			for (int32 Task = 0; Task < NumTasks; Task++)
 			{
-				for (TSet<FTickFunction *>::TIterator TickIt(LevelList[LevelIndex]->GetTickSet()); TickIt; ++TickIt)
+				if (Task + 1 == NumTasks)
 				{
-					AllTickFunctions[Start + NumTicksSoFar] = *TickIt;
-					NumTicksSoFar++;
-					if (NumTicksSoFar == NumThisTask)
-					{
-						check(Task < NumTasks);
-						FGraphEventArray Setup;
-						new (Setup) FGraphEventRef(TGraphTask<FQueueTickTasks>::CreateTask(NULL,ENamedThreads::GameThread).ConstructAndDispatchWhenReady(AllTickFunctions.GetData() + Start, AllCompletionEvents.GetData() + Start, NumThisTask, &Context));
-						new (QueueTickTasks) FGraphEventRef(TGraphTask<FPostTickTasks>::CreateTask(&Setup,ENamedThreads::GameThread).ConstructAndDispatchWhenReady(AllCompletionEvents.GetData() + Start, NumThisTask));
-						Start += NumThisTask;
-						NumTicksSoFar = 0;
-
-						Task++;
-						if (Task + 1 == NumTasks)
-						{
-							// last task needs to take an remainder
-							NumThisTask = AllTickFunctions.Num() - Start;
-						}
-					}
+					// last task needs to take an remainder
+					NumThisTask = AllTickFunctions.Num() - Start;
 				}
+				FGraphEventArray Setup;
+				new (Setup) FGraphEventRef(TGraphTask<FQueueTickTasks>::CreateTask(NULL,ENamedThreads::GameThread).ConstructAndDispatchWhenReady(AllTickFunctions.GetData() + Start, AllCompletionEvents.GetData() + Start, NumThisTask, &Context));
+				new (QueueTickTasks) FGraphEventRef(TGraphTask<FPostTickTasks>::CreateTask(&Setup,ENamedThreads::GameThread).ConstructAndDispatchWhenReady(AllCompletionEvents.GetData() + Start, NumThisTask));
+				Start += NumThisTask;
 			}
 		}
 	}
@@ -708,6 +1023,10 @@ public:
 			SCOPE_CYCLE_COUNTER(STAT_QueueTicksWait);
 			FTaskGraphInterface::Get().WaitUntilTasksComplete(QueueTickTasks, ENamedThreads::GameThread);
 			QueueTickTasks.Reset();
+			for( int32 LevelIndex = 0; LevelIndex < LevelList.Num(); LevelIndex++ )
+			{
+				LevelList[LevelIndex]->RescheduleTickFunctionsDueThisFrame();
+			}
 			AllTickFunctions.Reset();
 			AllCompletionEvents.Reset();
 		}
@@ -949,10 +1268,14 @@ FTickFunction::FTickFunction()
 	, bCanEverTick(false)
 	, bAllowTickOnDedicatedServer(true)
 	, bRunOnAnyThread(false)
+	, bAllowTickBatching(false)
+	, TickInterval(0.0f)
 	, bRegistered(false)
 	, bTickEnabled(true)
+	, bTickCoolingDown(false)
 	, TickVisitedGFrameCounter(0)
 	, TickQueuedGFrameCounter(0)
+	, TickIntervalDeltaSeconds(0.0f)
 	, ActualTickGroup(TG_PrePhysics)
 	, EnableParent(NULL)
 	, TickTaskLevel(NULL)
@@ -1051,7 +1374,8 @@ void FTickFunction::QueueTickFunction(const struct FTickContext& TickContext)
 	if (TickVisitedGFrameCounter != GFrameCounter)
 	{
 		TickVisitedGFrameCounter = GFrameCounter;
-		if (bTickEnabled && (!EnableParent || EnableParent->bTickEnabled))
+		// tick functions waiting for their tick interval to elapse are not ticked, even as a prerequisite
+		if (bTickEnabled && !bTickCoolingDown && (!EnableParent || EnableParent->bTickEnabled))
 		{
 			ETickingGroup MaxPrerequisiteTickGroup =  ETickingGroup(0);
 
@@ -1093,12 +1417,20 @@ void FTickFunction::QueueTickFunction(const struct FTickContext& TickContext)
 			}
 			ActualTickGroup = MyActualTickGroup;
 
-			// we don't need to add a tick group prerequisite if we already have a prerequisite in the correct tick group (in that case, the delay until the correct tick group is implicit)
-			if (!TaskPrerequisites.Num() || MaxPrerequisiteTickGroup < MyActualTickGroup)
+			if (!TaskPrerequisites.Num() && bAllowTickBatching && FTickTaskSequencer::Get().ShouldBatchTicks())
 			{
-				TaskPrerequisites.Add(FTickTaskSequencer::Get().GetTickGroupStartEvent(MyActualTickGroup));
+				// nothing to wait on but the tick group, so this can share a task with other such tick functions
+				FTickTaskSequencer::Get().QueueBatchedTickTask(this, TickContext);
+			}
+			else
+			{
+				// we don't need to add a tick group prerequisite if we already have a prerequisite in the correct tick group (in that case, the delay until the correct tick group is implicit)
+				if (!TaskPrerequisites.Num() || MaxPrerequisiteTickGroup < MyActualTickGroup)
+				{
+					TaskPrerequisites.Add(FTickTaskSequencer::Get().GetTickGroupStartEvent(MyActualTickGroup));
+				}
+				FTickTaskSequencer::Get().QueueTickTask(&TaskPrerequisites, this, TickContext);
 			}
-			FTickTaskSequencer::Get().QueueTickTask(&TaskPrerequisites, this, TickContext);
 		}
 		TickQueuedGFrameCounter = GFrameCounter;
 	}
@@ -1124,7 +1456,7 @@ void FTickFunction::QueueTickFunctionParallel(const FTickContext& TickContext, T
 	if (bProcessTick)
 	{
 		check(bRegistered);
-		if (bTickEnabled && (!EnableParent || EnableParent->bTickEnabled))
+		if (bTickEnabled && !bTickCoolingDown && (!EnableParent || EnableParent->bTickEnabled))
 		{
 			ETickingGroup MaxPrerequisiteTickGroup =  ETickingGroup(0);
 
@@ -6,14 +6,32 @@
 
 #include "EnginePrivate.h"
 
-void FTimerHandle::MakeValid()
+/** Length in seconds of one tick of the timer wheel, a power of two so that converting times to ticks is exact. */
+static const double TimerWheelTickTime = 1.0 / 64.0;
+
+static FORCEINLINE int64 GetTimerWheelTick(double Time)
 {
-	static int LastAssignedHandle = -1;
+	return (int64)FMath::FloorToDouble(Time / TimerWheelTickTime);
+}
 
+uint64 FTimerHandle::GenerateSerialNumber()
+{
+	// Shared by all the timer managers, so a handle never matches the timer of another manager
+	static uint64 LastAssignedSerialNumber = 0;
+
+	++LastAssignedSerialNumber;
+	if (LastAssignedSerialNumber == MaxSerialNumber)
+	{
+		LastAssignedSerialNumber = 1;
+	}
+	return LastAssignedSerialNumber;
+}
+
+void FTimerHandle::MakeValid()
+{
 	if (!IsValid())
 	{
-		++LastAssignedHandle;
-		Handle = LastAssignedHandle;
+		SetIndexAndSerialNumber(0, GenerateSerialNumber());
 	}
 
 	check(IsValid());
@@ -32,37 +50,16 @@ inline bool DEPRECATED_CompareUnifiedDelegates(const FTimerUnifiedDelegate& Lhs,
 /** Will find and return a timer if it exists, regardless whether it is paused. */ 
 FTimerData const* FTimerManager::DEPRECATED_FindTimer(FTimerUnifiedDelegate const& InDelegate, int32* OutTimerIndex) const
 {
-	int32 ActiveTimerIdx = DEPRECATED_FindTimerInList(ActiveTimerHeap, InDelegate);
-	if (ActiveTimerIdx != INDEX_NONE)
-	{
-		// found it in the active heap
-		if (OutTimerIndex)
-		{
-			*OutTimerIndex = ActiveTimerIdx;
-		}
-		return &ActiveTimerHeap[ActiveTimerIdx];
-	}
+	int32 const TimerIdx = DEPRECATED_FindTimerIndex(InDelegate);
 
-	int32 PausedTimerIdx = DEPRECATED_FindTimerInList(PausedTimerList, InDelegate);
-	if (PausedTimerIdx != INDEX_NONE)
+	// The timer being executed is not reported, it is out of the timer lists while its delegate runs
+	if (TimerIdx != INDEX_NONE && Timers[TimerIdx].Status != ETimerStatus::Executing)
 	{
-		// found it in the paused list
 		if (OutTimerIndex)
 		{
-			*OutTimerIndex = PausedTimerIdx;
+			*OutTimerIndex = TimerIdx;
 		}
-		return &PausedTimerList[PausedTimerIdx];
-	}
-
-	int32 PendingTimerIdx = DEPRECATED_FindTimerInList(PendingTimerList, InDelegate);
-	if (PendingTimerIdx != INDEX_NONE)
-	{
-		// found it in the pending list
-		if (OutTimerIndex)
-		{
-			*OutTimerIndex = PendingTimerIdx;
-		}
-		return &PendingTimerList[PendingTimerIdx];
+		return &Timers[TimerIdx];
 	}
 
 	return nullptr;
@@ -70,68 +67,45 @@ FTimerData const* FTimerManager::DEPRECATED_FindTimer(FTimerUnifiedDelegate cons
 
 FTimerData const* FTimerManager::FindTimer(FTimerHandle const& InHandle, int32* OutTimerIndex) const
 {
-	int32 ActiveTimerIdx = FindTimerInList(ActiveTimerHeap, InHandle);
-	if (ActiveTimerIdx != INDEX_NONE)
-	{
-		// found it in the active heap
-		if (OutTimerIndex)
-		{
-			*OutTimerIndex = ActiveTimerIdx;
-		}
-		return &ActiveTimerHeap[ActiveTimerIdx];
-	}
-
-	int32 PausedTimerIdx = FindTimerInList(PausedTimerList, InHandle);
-	if (PausedTimerIdx != INDEX_NONE)
-	{
-		// found it in the paused list
-		if (OutTimerIndex)
-		{
-			*OutTimerIndex = PausedTimerIdx;
-		}
-		return &PausedTimerList[PausedTimerIdx];
-	}
+	int32 const TimerIdx = FindTimerIndex(InHandle);
 
-	int32 PendingTimerIdx = FindTimerInList(PendingTimerList, InHandle);
-	if (PendingTimerIdx != INDEX_NONE)
+	// The timer being executed is not reported, it is out of the timer lists while its delegate runs
+	if (TimerIdx != INDEX_NONE && Timers[TimerIdx].Status != ETimerStatus::Executing)
 	{
-		// found it in the pending list
 		if (OutTimerIndex)
 		{
-			*OutTimerIndex = PendingTimerIdx;
+			*OutTimerIndex = TimerIdx;
 		}
-		return &PendingTimerList[PendingTimerIdx];
+		return &Timers[TimerIdx];
 	}
 
 	return nullptr;
 }
 
 
-/** Will find the given timer in the given TArray and return its index. */ 
-int32 FTimerManager::DEPRECATED_FindTimerInList(const TArray<FTimerData> &SearchArray, FTimerUnifiedDelegate const& InDelegate) const
+/** Will find the given timer in the timer storage and return its index. */ 
+int32 FTimerManager::DEPRECATED_FindTimerIndex(FTimerUnifiedDelegate const& InDelegate) const
 {
-	for (int32 Idx=0; Idx<SearchArray.Num(); ++Idx)
+	for (TSparseArray<FTimerData>::TConstIterator It(Timers); It; ++It)
 	{
-		if (!SearchArray[Idx].TimerHandle.IsValid() && DEPRECATED_CompareUnifiedDelegates(SearchArray[Idx].TimerDelegate, InDelegate))
+		if (It->bIdentifiedByDelegate && DEPRECATED_CompareUnifiedDelegates(It->TimerDelegate, InDelegate))
 		{
-			return Idx;
+			return It.GetIndex();
 		}
 	}
 
 	return INDEX_NONE;
 }
 
-/** Will find the given timer in the given TArray and return its index. */
-int32 FTimerManager::FindTimerInList(const TArray<FTimerData> &SearchArray, FTimerHandle const& InHandle) const
+/** Will find the given timer in the timer storage and return its index. */
+int32 FTimerManager::FindTimerIndex(FTimerHandle const& InHandle) const
 {
 	if (InHandle.IsValid())
 	{
-		for (int32 Idx = 0; Idx < SearchArray.Num(); ++Idx)
+		int32 const TimerIdx = InHandle.GetIndex();
+		if (TimerIdx < Timers.GetMaxIndex() && Timers.IsAllocated(TimerIdx) && Timers[TimerIdx].TimerHandle == InHandle)
 		{
-			if (SearchArray[Idx].TimerHandle == InHandle)
-			{
-				return Idx;
-			}
+			return TimerIdx;
 		}
 	}
 
@@ -143,22 +117,15 @@ FTimerHandle FTimerManager::K2_FindDynamicTimerHandle(FTimerDynamicDelegate InDy
 {
 	if (CurrentlyExecutingTimer.TimerDelegate.FuncDynDelegate == InDynamicDelegate)
 	{
-		return CurrentlyExecutingTimer.TimerHandle;
-	}
-
-	if (auto* Timer = ActiveTimerHeap.FindByPredicate([=](const FTimerData& Data){ return Data.TimerDelegate.FuncDynDelegate == InDynamicDelegate; }))
-	{
-		return Timer->TimerHandle;
-	}
-
-	if (auto* Timer = PausedTimerList.FindByPredicate([=](const FTimerData& Data){ return Data.TimerDelegate.FuncDynDelegate == InDynamicDelegate; }))
-	{
-		return Timer->TimerHandle;
+		return CurrentlyExecutingTimer.bIdentifiedByDelegate ? FTimerHandle() : CurrentlyExecutingTimer.TimerHandle;
 	}
 
-	if (auto* Timer = PendingTimerList.FindByPredicate([=](const FTimerData& Data){ return Data.TimerDelegate.FuncDynDelegate == InDynamicDelegate; }))
+	for (TSparseArray<FTimerData>::TConstIterator It(Timers); It; ++It)
 	{
-		return Timer->TimerHandle;
+		if (It->Status != ETimerStatus::Executing && It->TimerDelegate.FuncDynDelegate == InDynamicDelegate)
+		{
+			return It->bIdentifiedByDelegate ? FTimerHandle() : It->TimerHandle;
+		}
 	}
 
 	return FTimerHandle();
@@ -174,11 +141,12 @@ void FTimerManager::DEPRECATED_InternalSetTimer(FTimerUnifiedDelegate const& InD
 	// there's no data to maintain.
 	DEPRECATED_InternalClearTimer(InDelegate);
 
-	if (InRate > 0.f)
+	if (InRate > 0.f && InDelegate.IsBound())
 	{
 		// set up the new timer
 		FTimerData NewTimerData;
 		NewTimerData.TimerDelegate = InDelegate;
+		NewTimerData.bIdentifiedByDelegate = true;
 
 		InternalSetTimer(NewTimerData, InRate, InbLoop, InFirstDelay);
 	}
@@ -198,40 +166,34 @@ void FTimerManager::InternalSetTimer(FTimerHandle& InOutHandle, FTimerUnifiedDel
 
 	if (InRate > 0.f)
 	{
-		InOutHandle.MakeValid();
-
-		// set up the new timer
+		// set up the new timer, the handle is replaced by the one of the timer's new storage slot
 		FTimerData NewTimerData;
-		NewTimerData.TimerHandle = InOutHandle;
 		NewTimerData.TimerDelegate = InDelegate;
 
-		InternalSetTimer(NewTimerData, InRate, InbLoop, InFirstDelay);
+		InOutHandle = InternalSetTimer(NewTimerData, InRate, InbLoop, InFirstDelay);
 	}
 }
 
-void FTimerManager::InternalSetTimer(FTimerData& NewTimerData, float InRate, bool InbLoop, float InFirstDelay)
+FTimerHandle FTimerManager::InternalSetTimer(FTimerData& NewTimerData, float InRate, bool InbLoop, float InFirstDelay)
 {
-	if (NewTimerData.TimerHandle.IsValid() || NewTimerData.TimerDelegate.IsBound())
-	{
-		NewTimerData.Rate = InRate;
-		NewTimerData.bLoop = InbLoop;
+	NewTimerData.Rate = InRate;
+	NewTimerData.bLoop = InbLoop;
 
-		const float FirstDelay = (InFirstDelay >= 0.f) ? InFirstDelay : InRate;
+	const float FirstDelay = (InFirstDelay >= 0.f) ? InFirstDelay : InRate;
 
-		if (HasBeenTickedThisFrame())
-		{
-			NewTimerData.ExpireTime = InternalTime + FirstDelay;
-			NewTimerData.Status = ETimerStatus::Active;
-			ActiveTimerHeap.HeapPush(NewTimerData);
-		}
-		else
-		{
-			// Store time remaining in ExpireTime while pending
-			NewTimerData.ExpireTime = FirstDelay;
-			NewTimerData.Status = ETimerStatus::Pending;
-			PendingTimerList.Add(NewTimerData);
-		}
+	if (HasBeenTickedThisFrame())
+	{
+		NewTimerData.ExpireTime = InternalTime + FirstDelay;
+		NewTimerData.Status = ETimerStatus::Active;
 	}
+	else
+	{
+		// Store time remaining in ExpireTime while pending
+		NewTimerData.ExpireTime = FirstDelay;
+		NewTimerData.Status = ETimerStatus::Pending;
+	}
+
+	return AddTimer(NewTimerData);
 }
 
 void FTimerManager::InternalSetTimerForNextTick(FTimerUnifiedDelegate const& InDelegate)
@@ -243,9 +205,10 @@ void FTimerManager::InternalSetTimerForNextTick(FTimerUnifiedDelegate const& InD
 	NewTimerData.Rate = 0.f;
 	NewTimerData.bLoop = false;
 	NewTimerData.TimerDelegate = InDelegate;
+	NewTimerData.bIdentifiedByDelegate = true;
 	NewTimerData.ExpireTime = InternalTime;
 	NewTimerData.Status = ETimerStatus::Active;
-	ActiveTimerHeap.HeapPush(NewTimerData);
+	AddTimer(NewTimerData);
 }
 
 void FTimerManager::DEPRECATED_InternalClearTimer(FTimerUnifiedDelegate const& InDelegate)
@@ -253,20 +216,10 @@ void FTimerManager::DEPRECATED_InternalClearTimer(FTimerUnifiedDelegate const& I
 	// not currently threadsafe
 	check(IsInGameThread());
 
-	int32 TimerIdx;
-	FTimerData const* const TimerData = DEPRECATED_FindTimer(InDelegate, &TimerIdx);
-	if (TimerData)
+	int32 const TimerIdx = DEPRECATED_FindTimerIndex(InDelegate);
+	if (TimerIdx != INDEX_NONE)
 	{
-		InternalClearTimer(TimerIdx, TimerData->Status);
-	}
-	else
-	{
-		// Edge case. We're currently handling this timer when it got cleared.  Unbind it to prevent it firing again
-		// in case it was scheduled to fire multiple times.
-		if (!CurrentlyExecutingTimer.TimerHandle.IsValid() && DEPRECATED_CompareUnifiedDelegates(CurrentlyExecutingTimer.TimerDelegate, InDelegate))
-		{
-			CurrentlyExecutingTimer.TimerDelegate.Unbind();
-		}
+		InternalClearTimer(TimerIdx);
 	}
 }
 
@@ -275,49 +228,24 @@ void FTimerManager::InternalClearTimer(FTimerHandle const& InHandle)
 	// not currently threadsafe
 	check(IsInGameThread());
 
-	// Skip if the handle is invalid as it  would not be found by FindTimer and unbind the current handler if it also used INDEX_NONE. 
-	if (!InHandle.IsValid())
+	int32 const TimerIdx = FindTimerIndex(InHandle);
+	if (TimerIdx != INDEX_NONE)
 	{
-		return;
+		InternalClearTimer(TimerIdx);
 	}
+}
 
-	int32 TimerIdx;
-	FTimerData const* const TimerData = FindTimer(InHandle, &TimerIdx);
-	if (TimerData)
-	{
-		InternalClearTimer(TimerIdx, TimerData->Status);
-	}
-	else
+void FTimerManager::InternalClearTimer(int32 TimerIdx)
+{
+	if (Timers[TimerIdx].Status == ETimerStatus::Executing)
 	{
 		// Edge case. We're currently handling this timer when it got cleared.  Unbind it to prevent it firing again
 		// in case it was scheduled to fire multiple times.
-		if (CurrentlyExecutingTimer.TimerHandle == InHandle)
-		{
-			CurrentlyExecutingTimer.TimerDelegate.Unbind();
-			CurrentlyExecutingTimer.TimerHandle.Invalidate();
-		}
+		CurrentlyExecutingTimer.TimerDelegate.Unbind();
+		CurrentlyExecutingTimer.TimerHandle.Invalidate();
 	}
-}
 
-void FTimerManager::InternalClearTimer(int32 TimerIdx, ETimerStatus::Type TimerStatus)
-{
-	switch (TimerStatus)
-	{
-		case ETimerStatus::Pending:
-			PendingTimerList.RemoveAtSwap(TimerIdx);
-			break;
-
-		case ETimerStatus::Active:
-			ActiveTimerHeap.HeapRemoveAt(TimerIdx);
-			break;
-
-		case ETimerStatus::Paused:
-			PausedTimerList.RemoveAtSwap(TimerIdx);
-			break;
-
-		default:
-			check(false);
-	}
+	RemoveTimer(TimerIdx);
 }
 
 
@@ -325,40 +253,19 @@ void FTimerManager::InternalClearAllTimers(void const* Object)
 {
 	if (Object)
 	{
-		// search active timer heap for timers using this object and remove them
-		int32 const OldActiveHeapSize = ActiveTimerHeap.Num();
-
-		for (int32 Idx=0; Idx<ActiveTimerHeap.Num(); ++Idx)
-		{
-			if ( ActiveTimerHeap[Idx].TimerDelegate.IsBoundToObject(Object) )
-			{
-				// remove this item
-				// this will break the heap property, but we will re-heapify afterward
-				ActiveTimerHeap.RemoveAtSwap(Idx--);
-			}
-		}
-		if (OldActiveHeapSize != ActiveTimerHeap.Num())
-		{
-			// need to heapify
-			ActiveTimerHeap.Heapify();
-		}
-
-		// search paused timer list for timers using this object and remove them, too
-		for (int32 Idx=0; Idx<PausedTimerList.Num(); ++Idx)
+		// search all the timers for timers using this object and remove them
+		TArray<int32, TInlineAllocator<16>> TimersToClear;
+		for (TSparseArray<FTimerData>::TConstIterator It(Timers); It; ++It)
 		{
-			if (PausedTimerList[Idx].TimerDelegate.IsBoundToObject(Object))
+			if (It->TimerDelegate.IsBoundToObject(Object))
 			{
-				PausedTimerList.RemoveAtSwap(Idx--);
+				TimersToClear.Add(It.GetIndex());
 			}
 		}
 
-		// search pending timer list for timers using this object and remove them, too
-		for (int32 Idx=0; Idx<PendingTimerList.Num(); ++Idx)
+		for (int32 TimerIdx : TimersToClear)
 		{
-			if (PendingTimerList[Idx].TimerDelegate.IsBoundToObject(Object))
-			{
-				PendingTimerList.RemoveAtSwap(Idx--);
-			}
+			InternalClearTimer(TimerIdx);
 		}
 
 		// Edge case. We're currently handling this timer when it got cleared.  Unbind it to prevent it firing again
@@ -366,6 +273,7 @@ void FTimerManager::InternalClearAllTimers(void const* Object)
 		if (CurrentlyExecutingTimer.TimerDelegate.IsBoundToObject(Object))
 		{
 			CurrentlyExecutingTimer.TimerDelegate.Unbind();
+			CurrentlyExecutingTimer.TimerHandle.Invalidate();
 		}
 	}
 }
@@ -424,30 +332,16 @@ void FTimerManager::InternalPauseTimer( FTimerData const* TimerToPause, int32 Ti
 
 	if( TimerToPause && (TimerToPause->Status != ETimerStatus::Paused) )
 	{
-		ETimerStatus::Type PreviousStatus = TimerToPause->Status;
+		FTimerData& Timer = Timers[TimerIdx];
+		UnlinkTimer(TimerIdx);
 
-		// Add to Paused list
-		int32 NewIndex = PausedTimerList.Add(*TimerToPause);
-
-		// Set new status
-		FTimerData &NewTimer = PausedTimerList[NewIndex];
-		NewTimer.Status = ETimerStatus::Paused;
-
-		// Remove from previous TArray
-		switch( PreviousStatus )
+		if( Timer.Status == ETimerStatus::Active )
 		{
-			case ETimerStatus::Active : 
-				// Store time remaining in ExpireTime while paused
-				NewTimer.ExpireTime = NewTimer.ExpireTime - InternalTime;
-				ActiveTimerHeap.HeapRemoveAt(TimerIdx); 
-				break;
-			
-			case ETimerStatus::Pending : 
-				PendingTimerList.RemoveAtSwap(TimerIdx); 
-				break;
-
-			default : check(false);
+			// Store time remaining in ExpireTime while paused
+			Timer.ExpireTime = Timer.ExpireTime - InternalTime;
 		}
+
+		Timer.Status = ETimerStatus::Paused;
 	}
 }
 
@@ -456,30 +350,191 @@ void FTimerManager::InternalUnPauseTimer(int32 PausedTimerIdx)
 	// not currently threadsafe
 	check(IsInGameThread());
 
-	if (PausedTimerIdx != INDEX_NONE)
+	if (PausedTimerIdx != INDEX_NONE && Timers[PausedTimerIdx].Status == ETimerStatus::Paused)
 	{
-		FTimerData& TimerToUnPause = PausedTimerList[PausedTimerIdx];
-		check(TimerToUnPause.Status == ETimerStatus::Paused);
+		FTimerData& TimerToUnPause = Timers[PausedTimerIdx];
 
-		// Move it out of paused list and into proper TArray
 		if( HasBeenTickedThisFrame() )
 		{
 			// Convert from time remaining back to a valid ExpireTime
 			TimerToUnPause.ExpireTime += InternalTime;
 			TimerToUnPause.Status = ETimerStatus::Active;
-			ActiveTimerHeap.HeapPush(TimerToUnPause);
+			ScheduleTimer(PausedTimerIdx);
 		}
 		else
 		{
 			TimerToUnPause.Status = ETimerStatus::Pending;
-			PendingTimerList.Add(TimerToUnPause);
+			LinkTimer(PausedTimerIdx, PendingBucket);
+		}
+	}
+}
+
+FTimerHandle FTimerManager::AddTimer(FTimerData const& TimerData)
+{
+	int32 const TimerIdx = Timers.Add(TimerData);
+
+	FTimerData& NewTimer = Timers[TimerIdx];
+	NewTimer.TimerHandle.SetIndexAndSerialNumber(TimerIdx, FTimerHandle::GenerateSerialNumber());
+	NewTimer.Bucket = INDEX_NONE;
+
+	if (NewTimer.Status == ETimerStatus::Active)
+	{
+		ScheduleTimer(TimerIdx);
+	}
+	else
+	{
+		check(NewTimer.Status == ETimerStatus::Pending);
+		LinkTimer(TimerIdx, PendingBucket);
+	}
+
+	return NewTimer.TimerHandle;
+}
+
+void FTimerManager::RemoveTimer(int32 TimerIdx)
+{
+	UnlinkTimer(TimerIdx);
+	Timers.RemoveAt(TimerIdx);
+}
+
+void FTimerManager::ScheduleTimer(int32 TimerIdx)
+{
+	FTimerData const& Timer = Timers[TimerIdx];
+	check(Timer.Status == ETimerStatus::Active);
+
+	// Timers that are already late go in the current slot, they are fired by the next tick
+	int64 const ExpireTick = FMath::Max(GetTimerWheelTick(Timer.ExpireTime), WheelTick);
+	int64 const TicksToExpire = ExpireTick - WheelTick;
+
+	int32 Bucket = OverflowBucket;
+	for (int32 Level = 0; Level < WheelLevels; ++Level)
+	{
+		if (TicksToExpire < ((int64)1 << (WheelSlotBits * (Level + 1))))
+		{
+			Bucket = Level * WheelSlotsPerLevel + (int32)((ExpireTick >> (WheelSlotBits * Level)) & (WheelSlotsPerLevel - 1));
+			break;
+		}
+	}
+
+	LinkTimer(TimerIdx, Bucket);
+}
+
+void FTimerManager::LinkTimer(int32 TimerIdx, int32 Bucket)
+{
+	FTimerData& Timer = Timers[TimerIdx];
+	check(Timer.Bucket == INDEX_NONE);
+
+	Timer.Bucket = Bucket;
+	Timer.PrevIndex = INDEX_NONE;
+	Timer.NextIndex = BucketHeads[Bucket];
+	if (Timer.NextIndex != INDEX_NONE)
+	{
+		Timers[Timer.NextIndex].PrevIndex = TimerIdx;
+	}
+	BucketHeads[Bucket] = TimerIdx;
+}
+
+void FTimerManager::UnlinkTimer(int32 TimerIdx)
+{
+	FTimerData& Timer = Timers[TimerIdx];
+	if (Timer.Bucket != INDEX_NONE)
+	{
+		if (Timer.PrevIndex != INDEX_NONE)
+		{
+			Timers[Timer.PrevIndex].NextIndex = Timer.NextIndex;
+		}
+		else
+		{
+			BucketHeads[Timer.Bucket] = Timer.NextIndex;
 		}
 
-		// remove from paused list
-		PausedTimerList.RemoveAtSwap(PausedTimerIdx);
+		if (Timer.NextIndex != INDEX_NONE)
+		{
+			Timers[Timer.NextIndex].PrevIndex = Timer.PrevIndex;
+		}
+
+		Timer.Bucket = INDEX_NONE;
+		Timer.PrevIndex = INDEX_NONE;
+		Timer.NextIndex = INDEX_NONE;
 	}
 }
 
+void FTimerManager::RescheduleBucket(int32 Bucket)
+{
+	// Detach the whole list first, timers may be linked back into the same bucket
+	int32 TimerIdx = BucketHeads[Bucket];
+	BucketHeads[Bucket] = INDEX_NONE;
+
+	while (TimerIdx != INDEX_NONE)
+	{
+		FTimerData& Timer = Timers[TimerIdx];
+		int32 const NextIdx = Timer.NextIndex;
+		Timer.Bucket = INDEX_NONE;
+		ScheduleTimer(TimerIdx);
+		TimerIdx = NextIdx;
+	}
+}
+
+void FTimerManager::CollectExpiredTimers(TArray<FTimerHandle>& OutExpiredTimers)
+{
+	int64 const CurrentTick = GetTimerWheelTick(InternalTime);
+
+	if (CurrentTick - WheelTick > WheelSlotsPerLevel * WheelSlotsPerLevel)
+	{
+		// After a long hitch it is cheaper to relink every timer than to turn the wheel one tick at a time
+		WheelTick = CurrentTick;
+		for (int32 Bucket = 0; Bucket <= OverflowBucket; ++Bucket)
+		{
+			RescheduleBucket(Bucket);
+		}
+	}
+
+	while (WheelTick <= CurrentTick)
+	{
+		// Every timer in the slot of a tick the clock went past has expired, the slot of the current tick can also hold timers that expire later this tick
+		int32 TimerIdx = BucketHeads[WheelTick & (WheelSlotsPerLevel - 1)];
+		while (TimerIdx != INDEX_NONE)
+		{
+			FTimerData const& Timer = Timers[TimerIdx];
+			int32 const NextIdx = Timer.NextIndex;
+			if (WheelTick < CurrentTick || InternalTime > Timer.ExpireTime)
+			{
+				OutExpiredTimers.Add(Timer.TimerHandle);
+				UnlinkTimer(TimerIdx);
+			}
+			TimerIdx = NextIdx;
+		}
+
+		if (WheelTick == CurrentTick)
+		{
+			break;
+		}
+
+		++WheelTick;
+
+		// Each time a level completes a turn, spread the next slot of the level above it over the lower levels
+		int32 Level = 1;
+		for (; Level < WheelLevels; ++Level)
+		{
+			int64 const LevelShift = WheelSlotBits * Level;
+			if ((WheelTick & (((int64)1 << LevelShift) - 1)) != 0)
+			{
+				break;
+			}
+			RescheduleBucket(Level * WheelSlotsPerLevel + (int32)((WheelTick >> LevelShift) & (WheelSlotsPerLevel - 1)));
+		}
+		if (Level == WheelLevels)
+		{
+			RescheduleBucket(OverflowBucket);
+		}
+	}
+
+	// Fire timers in expiration order, as the wheel slots are not sorted
+	OutExpiredTimers.Sort([this](const FTimerHandle& A, const FTimerHandle& B)
+	{
+		return Timers[A.GetIndex()].ExpireTime < Timers[B.GetIndex()].ExpireTime;
+	});
+}
+
 // ---------------------------------
 // Public members
 // ---------------------------------
@@ -491,70 +546,80 @@ void FTimerManager::Tick(float DeltaTime)
 
 	InternalTime += DeltaTime;
 
-	while (ActiveTimerHeap.Num() > 0)
+	TArray<FTimerHandle> ExpiredTimers;
+	CollectExpiredTimers(ExpiredTimers);
+
+	for (FTimerHandle const& ExpiredHandle : ExpiredTimers)
 	{
-		FTimerData& Top = ActiveTimerHeap.HeapTop();
-		if (InternalTime > Top.ExpireTime)
+		// Skip the timers cleared, paused or reset by the delegates fired before them
+		int32 const TimerIdx = FindTimerIndex(ExpiredHandle);
+		if (TimerIdx == INDEX_NONE || Timers[TimerIdx].Status != ETimerStatus::Active || Timers[TimerIdx].Bucket != INDEX_NONE)
 		{
-			// Timer has expired! Fire the delegate, then handle potential looping.
-
-			// Remove it from the heap and store it while we're executing
-			ActiveTimerHeap.HeapPop(CurrentlyExecutingTimer); 
-
-			// Determine how many times the timer may have elapsed (e.g. for large DeltaTime on a short looping timer)
-			int32 const CallCount = CurrentlyExecutingTimer.bLoop ? 
-				FMath::TruncToInt( (InternalTime - CurrentlyExecutingTimer.ExpireTime) / CurrentlyExecutingTimer.Rate ) + 1
-				: 1;
-
-			// Now call the function
-			for (int32 CallIdx=0; CallIdx<CallCount; ++CallIdx)
-			{ 
-				CurrentlyExecutingTimer.TimerDelegate.Execute();
-
-				// If timer was cleared in the delegate execution, don't execute further 
-				if( !CurrentlyExecutingTimer.TimerHandle.IsValid() && !CurrentlyExecutingTimer.TimerDelegate.IsBound() )
-				{
-					break;
-				}
-			}
+			continue;
+		}
+
+		// Timer has expired! Fire the delegate, then handle potential looping.
+
+		// Keep its storage while we're executing, so its handle stays the same if it loops
+		Timers[TimerIdx].Status = ETimerStatus::Executing;
+		CurrentlyExecutingTimer = Timers[TimerIdx];
 
-			if( CurrentlyExecutingTimer.bLoop && 
-				(CurrentlyExecutingTimer.TimerHandle.IsValid() ||
-				 CurrentlyExecutingTimer.TimerDelegate.IsBound()) && 							// did not get cleared during execution
-				(CurrentlyExecutingTimer.TimerHandle.IsValid() ? 
-					(FindTimer(CurrentlyExecutingTimer.TimerHandle) == nullptr) : 
-					(DEPRECATED_FindTimer(CurrentlyExecutingTimer.TimerDelegate) == nullptr)) // did not get manually re-added during execution			  
-				)
+		// Determine how many times the timer may have elapsed (e.g. for large DeltaTime on a short looping timer)
+		int32 const CallCount = CurrentlyExecutingTimer.bLoop ? 
+			FMath::TruncToInt( (InternalTime - CurrentlyExecutingTimer.ExpireTime) / CurrentlyExecutingTimer.Rate ) + 1
+			: 1;
+
+		// Now call the function
+		for (int32 CallIdx=0; CallIdx<CallCount; ++CallIdx)
+		{ 
+			CurrentlyExecutingTimer.TimerDelegate.Execute();
+
+			// If timer was cleared in the delegate execution, don't execute further 
+			if( !CurrentlyExecutingTimer.TimerHandle.IsValid() )
 			{
-				// Put this timer back on the heap
-				CurrentlyExecutingTimer.ExpireTime += CallCount * CurrentlyExecutingTimer.Rate;
-				ActiveTimerHeap.HeapPush(CurrentlyExecutingTimer);
+				break;
 			}
-
-			CurrentlyExecutingTimer.TimerDelegate.Unbind();
 		}
-		else
+
+		// Clearing or resetting the timer during execution invalidated the handle and freed its storage
+		if( CurrentlyExecutingTimer.TimerHandle.IsValid() )
 		{
-			// no need to go further down the heap, we can be finished
-			break;
+			if( CurrentlyExecutingTimer.bLoop )
+			{
+				// Put this timer back in the wheel
+				FTimerData& LoopingTimer = Timers[TimerIdx];
+				LoopingTimer.ExpireTime += CallCount * CurrentlyExecutingTimer.Rate;
+				LoopingTimer.Status = ETimerStatus::Active;
+				ScheduleTimer(TimerIdx);
+			}
+			else
+			{
+				RemoveTimer(TimerIdx);
+			}
 		}
+
+		CurrentlyExecutingTimer.TimerDelegate.Unbind();
+		CurrentlyExecutingTimer.TimerHandle.Invalidate();
 	}
 
 	// Timer has been ticked.
 	LastTickedFrame = GFrameCounter;
 
-	// If we have any Pending Timers, add them to the Active Queue.
-	if( PendingTimerList.Num() > 0 )
+	// If we have any Pending Timers, add them to the wheel.
+	int32 PendingTimerIdx = BucketHeads[PendingBucket];
+	BucketHeads[PendingBucket] = INDEX_NONE;
+	while (PendingTimerIdx != INDEX_NONE)
 	{
-		for(int32 Index=0; Index<PendingTimerList.Num(); Index++)
-		{
-			FTimerData& TimerToActivate = PendingTimerList[Index];
-			// Convert from time remaining back to a valid ExpireTime
-			TimerToActivate.ExpireTime += InternalTime;
-			TimerToActivate.Status = ETimerStatus::Active;
-			ActiveTimerHeap.HeapPush( TimerToActivate );
-		}
-		PendingTimerList.Empty();
+		FTimerData& TimerToActivate = Timers[PendingTimerIdx];
+		int32 const NextIdx = TimerToActivate.NextIndex;
+
+		// Convert from time remaining back to a valid ExpireTime
+		TimerToActivate.ExpireTime += InternalTime;
+		TimerToActivate.Status = ETimerStatus::Active;
+		TimerToActivate.Bucket = INDEX_NONE;
+		ScheduleTimer(PendingTimerIdx);
+
+		PendingTimerIdx = NextIdx;
 	}
 }
 
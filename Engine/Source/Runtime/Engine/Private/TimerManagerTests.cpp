@@ -264,6 +264,125 @@ bool TimerManagerTest_LoopingTimers_DifferentHandles(UWorld* World, FAutomationT
 	return true;
 }
 
+void TimerTest_TickManager(FTimerManager& TimerManager, float Time, float Step = 0.1f)
+{
+	while (Time > 0.f)
+	{
+		TimerManager.Tick(FMath::Min(Time, Step));
+		Time -= Step;
+		GFrameCounter++;
+	}
+}
+
+class FTimerOrderRecorder
+{
+public:
+	void Callback(int32 TimerId) { FiredTimers.Add(TimerId); }
+
+	TArray<int32> FiredTimers;
+};
+
+// Make sure timers spread over every level of the timer wheel fire once, in order, whether the clock moves in small steps or jumps
+bool TimerManagerTest_LongTimers(FAutomationTestBase* Test)
+{
+	const float Delays[] = { 0.25f, 3.f, 100.f, 5000.f, 300000.f };
+	const int32 NumDelays = ARRAY_COUNT(Delays);
+
+	FTimerManager TimerManager;
+	FTimerOrderRecorder Recorder;
+	TimerTest_TickManager(TimerManager, KINDA_SMALL_NUMBER);
+
+	// Set in reverse order so the firing order doesn't follow the order the timers were added in
+	TArray<FTimerHandle> Handles;
+	Handles.AddZeroed(NumDelays);
+	for (int32 TimerId = NumDelays - 1; TimerId >= 0; --TimerId)
+	{
+		TimerManager.SetTimer(Handles[TimerId], FTimerDelegate::CreateRaw(&Recorder, &FTimerOrderRecorder::Callback, TimerId), Delays[TimerId], false);
+	}
+
+	// Small steps turn the lower levels of the wheel
+	TimerTest_TickManager(TimerManager, 120.f);
+	Test->TestTrue(TIMER_TEST_TEXT("Short timers fired while stepping"), Recorder.FiredTimers.Num() == 3);
+	Test->TestTrue(TIMER_TEST_TEXT("Long timer is still active"), TimerManager.IsTimerActive(Handles[3]));
+	Test->TestTrue(TIMER_TEST_TEXT("Long timer remaining time"), FMath::IsNearlyEqual(TimerManager.GetTimerRemaining(Handles[3]), Delays[3] - 120.f, 0.5f));
+
+	// Large steps spread the upper levels and the overflow list
+	TimerTest_TickManager(TimerManager, 400000.f, 1000.f);
+	Test->TestTrue(TIMER_TEST_TEXT("All timers fired"), Recorder.FiredTimers.Num() == NumDelays);
+	for (int32 Index = 0; Index < Recorder.FiredTimers.Num(); ++Index)
+	{
+		Test->TestTrue(TIMER_TEST_TEXT("Timer %d fired in order", Index), Recorder.FiredTimers[Index] == Index);
+		Test->TestFalse(TIMER_TEST_TEXT("Timer %d no longer exists", Index), TimerManager.TimerExists(Handles[Index]));
+	}
+
+	// A single hitch longer than the wheel fires everything in order too
+	Recorder.FiredTimers.Empty();
+	for (int32 TimerId = NumDelays - 1; TimerId >= 0; --TimerId)
+	{
+		TimerManager.SetTimer(Handles[TimerId], FTimerDelegate::CreateRaw(&Recorder, &FTimerOrderRecorder::Callback, TimerId), Delays[TimerId], false);
+	}
+	TimerTest_TickManager(TimerManager, KINDA_SMALL_NUMBER);
+	TimerTest_TickManager(TimerManager, 400000.f, 400000.f);
+	Test->TestTrue(TIMER_TEST_TEXT("All timers fired after a hitch"), Recorder.FiredTimers.Num() == NumDelays);
+	for (int32 Index = 0; Index < Recorder.FiredTimers.Num(); ++Index)
+	{
+		Test->TestTrue(TIMER_TEST_TEXT("Timer %d fired in order after a hitch", Index), Recorder.FiredTimers[Index] == Index);
+	}
+
+	return true;
+}
+
+// Make sure every handle still finds its own timer when there are many timers spread over the wheel
+bool TimerManagerTest_ManyTimers(FAutomationTestBase* Test)
+{
+	const int32 NumTimers = 10000;
+
+	FTimerManager TimerManager;
+	FDummy Dummy;
+	FRandomStream Stream(NumTimers);
+	TimerTest_TickManager(TimerManager, KINDA_SMALL_NUMBER);
+
+	TArray<FTimerHandle> Handles;
+	Handles.AddZeroed(NumTimers);
+	for (int32 Index = 0; Index < NumTimers; ++Index)
+	{
+		TimerManager.SetTimer(Handles[Index], FTimerDelegate::CreateRaw(&Dummy, &FDummy::Callback), Stream.FRandRange(1.f, 600.f), Stream.FRand() < 0.5f);
+	}
+
+	int32 NumActive = 0;
+	for (int32 Index = 0; Index < NumTimers; ++Index)
+	{
+		NumActive += TimerManager.IsTimerActive(Handles[Index]) ? 1 : 0;
+	}
+	Test->TestTrue(TIMER_TEST_TEXT("All %d timers are active", NumTimers), NumActive == NumTimers);
+
+	int32 NumPaused = 0;
+	for (int32 Index = 0; Index < NumTimers; ++Index)
+	{
+		TimerManager.PauseTimer(Handles[Index]);
+		NumPaused += TimerManager.IsTimerPaused(Handles[Index]) ? 1 : 0;
+		TimerManager.UnPauseTimer(Handles[Index]);
+	}
+	Test->TestTrue(TIMER_TEST_TEXT("All %d timers could be paused", NumTimers), NumPaused == NumTimers);
+
+	TimerTest_TickManager(TimerManager, 60.f, 1.f / 30.f);
+
+	for (int32 Index = 0; Index < NumTimers; ++Index)
+	{
+		TimerManager.ClearTimer(Handles[Index]);
+	}
+	for (int32 Index = 0; Index < NumTimers; ++Index)
+	{
+		if (TimerManager.TimerExists(Handles[Index]))
+		{
+			Test->AddError(TIMER_TEST_TEXT("Timer %d still exists after being cleared", Index));
+			break;
+		}
+	}
+
+	return true;
+}
+
 bool FTimerManagerTest::RunTest(const FString& Parameters)
 {
 	UWorld *World = UWorld::CreateWorld(EWorldType::Game, false);
@@ -279,6 +398,8 @@ bool FTimerManagerTest::RunTest(const FString& Parameters)
 	TimerManagerTest_ValidTimer_HandleWithDelegate(World, this);
 	TimerManagerTest_ValidTimer_HandleLoopingSetDuringExecute(World, this);
 	TimerManagerTest_LoopingTimers_DifferentHandles(World, this);
+	TimerManagerTest_LongTimers(this);
+	TimerManagerTest_ManyTimers(this);
 
 	GEngine->DestroyWorldContext(World);
 	World->DestroyWorld(false);
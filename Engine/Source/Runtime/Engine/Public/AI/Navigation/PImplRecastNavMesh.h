@@ -43,6 +43,9 @@ public:
 
 	const dtQueryFilter* GetAsDetourQueryFilter() const { return this; }
 
+	/** Detour settings of this filter, compared as a whole like IsEqual does */
+	const dtQueryFilterData& GetFilterData() const { return data; }
+
 	/** note that it results in loosing all area cost setup. Call it before setting anything else */
 	void SetIsVirtual(bool bIsVirtual);
 };
@@ -56,6 +59,52 @@ struct ENGINE_API FRecastSpeciaLinkFilter : public dtQuerySpecialLinkFilter
 	const UObject* SearchOwner;
 };
 
+/** Navmesh query used outside of game thread, one per thread. Keeps its node pool between
+ *  queries instead of allocating a new one for each path found on worker threads */
+class FRecastNavQueryThreadCache : public TThreadSingleton<FRecastNavQueryThreadCache>
+{
+	friend class TThreadSingleton<FRecastNavQueryThreadCache>;
+
+public:
+	dtNavMeshQuery NavQuery;
+};
+
+/** Identifies path corridors cached by FPImplRecastNavMesh. Agent properties are implied, since every navmesh serves a single agent */
+struct FRecastPathCacheKey
+{
+	NavNodeRef StartPolyID;
+	NavNodeRef EndPolyID;
+	uint32 FilterHash;
+	int32 MaxSearchNodes;
+
+	FRecastPathCacheKey(NavNodeRef InStartPolyID, NavNodeRef InEndPolyID, const FRecastQueryFilter& Filter, int32 InMaxSearchNodes)
+		: StartPolyID(InStartPolyID)
+		, EndPolyID(InEndPolyID)
+		, FilterHash(FCrc::MemCrc32(&Filter.GetFilterData(), sizeof(dtQueryFilterData)))
+		, MaxSearchNodes(InMaxSearchNodes)
+	{}
+
+	bool operator==(const FRecastPathCacheKey& Other) const
+	{
+		return StartPolyID == Other.StartPolyID && EndPolyID == Other.EndPolyID
+			&& FilterHash == Other.FilterHash && MaxSearchNodes == Other.MaxSearchNodes;
+	}
+
+	friend uint32 GetTypeHash(const FRecastPathCacheKey& Key)
+	{
+		return HashCombine(HashCombine(GetTypeHash(Key.StartPolyID), GetTypeHash(Key.EndPolyID)), HashCombine(Key.FilterHash, uint32(Key.MaxSearchNodes)));
+	}
+};
+
+/** Path corridor found for a FRecastPathCacheKey */
+struct FRecastCachedPathCorridor
+{
+	/** full filter settings, in case two filters end up with the same hash */
+	dtQueryFilterData FilterData;
+	TArray<NavNodeRef> PathCorridor;
+	TArray<float> PathCorridorCost;
+};
+
 /** Engine Private! - Private Implementation details of ARecastNavMesh */
 class ENGINE_API FPImplRecastNavMesh
 {
@@ -198,6 +247,12 @@ public:
 
 	float GetTotalDataSize() const;
 
+	/** Drops cached path corridors going through any of given tiles */
+	void InvalidateCachedPaths(const TArray<uint32>& ChangedTiles);
+
+	/** Drops all cached path corridors */
+	void ClearCachedPaths();
+
 	/** Called on world origin changes */
 	void ApplyWorldOffset(const FVector& InOffset, bool bWorldShift);
 
@@ -231,10 +286,29 @@ public:
 		const FVector& RecastStart, FVector& RecastEnd,
 		dtQueryResult& PathResult) const;
 
+	/** Finishes path with corridor already in place: marks custom links, performs string pulling if needed */
+	void PostProcessPathCorridor(dtStatus PathfindResult, FNavMeshPath& Path,
+		const dtNavMeshQuery& Query, NavNodeRef StartNode, NavNodeRef EndNode,
+		const FVector& UnrealStart, const FVector& UnrealEnd, FVector& RecastEnd) const;
+
 	void GetDebugPolyEdges(const dtMeshTile* Tile, bool bInternalEdges, bool bNavMeshEdges, TArray<FVector>& InternalEdgeVerts, TArray<FVector>& NavMeshEdgeVerts) const;
 
 	/** workhorse function finding portal edges between corridor polys */
 	void GetEdgesForPathCorridorImpl(const TArray<NavNodeRef>* PathCorridor, TArray<FNavigationPortalEdge>* PathCorridorEdges, const dtNavMeshQuery& NavQuery) const;
+
+	/** Looks for corridor cached for given key, copying it to Path if it's not NULL */
+	bool FindCachedPathCorridor(const FRecastPathCacheKey& Key, const FRecastQueryFilter& Filter, FNavMeshPath* Path) const;
+
+	/** Stores complete corridor of Path under given key */
+	void AddCachedPathCorridor(const FRecastPathCacheKey& Key, const FRecastQueryFilter& Filter, const FNavMeshPath& Path) const;
+
+	/** corridors of paths found so far, used when owner's bCachePathCorridors is set. Accessed from pathfinding threads, guarded by CachedPathsLock */
+	mutable TMap<FRecastPathCacheKey, FRecastCachedPathCorridor> CachedPaths;
+
+	/** keys of cached corridors going through each tile */
+	mutable TMultiMap<uint32, FRecastPathCacheKey> CachedPathsByTile;
+
+	mutable FCriticalSection CachedPathsLock;
 };
 
 #endif	// WITH_RECAST
@@ -147,6 +147,9 @@ public:
 	FORCEINLINE bool IsFullyRegenerated() const { return bRegenerateCompressedLayers; }
 	/** Whether tile task has anything to build */
 	bool HasDataToBuild() const;
+	/** Requests the worker to stop at the next step, results of a cancelled generator are never added to navmesh */
+	void Cancel() { bCancelled = true; }
+	bool IsCancelled() const { return bCancelled; }
 
 	TArray<FNavMeshTileData> GetCompressedLayers() const { return CompressedLayers; }
 	TArray<FNavMeshTileData> GetNavigationData() const { return NavigationData; }
@@ -174,6 +177,14 @@ protected:
 	/** builds NavigationData array (layers + obstacles) */
 	bool GenerateNavigationData(FNavMeshBuildContext& BuildContext);
 
+#if WITH_EDITOR
+	/** DDC key of CompressedLayers, based on tile's geometry and generation params */
+	FString GetCompressedLayersCacheKey() const;
+	/** reads CompressedLayers from DDC, returns false if they were not cached */
+	bool LoadCompressedLayers(const FString& CacheKey);
+	void StoreCompressedLayers(const FString& CacheKey) const;
+#endif // WITH_EDITOR
+
 	void ApplyVoxelFilter(struct rcHeightfield* SolidHF, float WalkableRadius);
 
 	/** apply areas from DynamicAreas to layer */
@@ -194,6 +205,11 @@ protected:
 	uint32 bSucceeded : 1;
 	uint32 bRegenerateCompressedLayers : 1;
 	uint32 bFullyEncapsulatedByInclusionBounds : 1;
+	/** Whether compressed layers should be shared through derived data cache */
+	uint32 bUseDerivedDataCache : 1;
+
+	/** Set from game thread when the tile got dirty again while being generated */
+	FThreadSafeBool bCancelled;
 	
 	int32 TileX;
 	int32 TileY;
@@ -256,6 +272,8 @@ struct FPendingTileElement
 	float		SeedDistance; 
 	/** Whether we need a full rebuild for this tile grid cell */
 	bool		bRebuildGeometry;
+	/** time when the tile was first marked dirty, used for latency stats */
+	double		DirtyTime;
 	/** We need to store dirty area bounds to check which cached layers needs to be regenerated
 	 *  In case geometry is changed cached layers data will be fully regenerated without using dirty areas list
 	 */
@@ -265,6 +283,7 @@ struct FPendingTileElement
 		: Coord(FIntPoint::NoneValue)
 		, SeedDistance(MAX_flt)
 		, bRebuildGeometry(false)
+		, DirtyTime(0.)
 	{
 	}
 
@@ -290,6 +309,8 @@ struct FRunningTileElement
 		: Coord(FIntPoint::NoneValue)
 		, bShouldDiscard(false)
 		, AsyncTask(nullptr)
+		, bRebuildGeometry(false)
+		, DirtyTime(0.)
 	{
 	}
 	
@@ -297,6 +318,8 @@ struct FRunningTileElement
 		: Coord(InCoord)
 		, bShouldDiscard(false)
 		, AsyncTask(nullptr)
+		, bRebuildGeometry(false)
+		, DirtyTime(0.)
 	{
 	}
 
@@ -310,6 +333,12 @@ struct FRunningTileElement
 	/** whether generated results should be discarded */
 	bool						bShouldDiscard; 
 	FRecastTileGeneratorTask*	AsyncTask;
+	/** generator owned by AsyncTask, kept here so it can be cancelled while the task is running */
+	TSharedPtr<FRecastTileGenerator> TileGenerator;
+	/** dirty state the task was started with, moved back to pending list when the task gets cancelled */
+	bool						bRebuildGeometry;
+	double						DirtyTime;
+	TArray<FBox>				DirtyAreas;
 };
 
 struct FTileTimestamp
@@ -377,6 +406,9 @@ public:
 
 	const FRecastNavMeshCachedData& GetAdditionalCachedData() const { return AdditionalCachedData; }
 
+	/** Whether tile generators should look for compressed layers in derived data cache before rasterizing geometry */
+	bool ShouldUseDerivedDataCache() const { return bUseDerivedDataCache; }
+
 	bool HasDirtyTiles() const;
 
 	FBox GrowBoundingBox(const FBox& BBox, bool bIncludeAgentHeight) const;
@@ -475,6 +507,8 @@ private:
 
 	uint32 bInitialized:1;
 
+	uint32 bUseDerivedDataCache:1;
+
 	/** Runtime generator's version, increased every time all tile generators get invalidated
 	 *	like when navmesh size changes */
 	uint32 Version;
@@ -0,0 +1,203 @@
+// Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
+
+/*=============================================================================
+	AnimEncoding_InterleavedKeyLerp.h: Key-frame interleaved compression.
+=============================================================================*/
+
+#pragma once
+
+#include "AnimEncoding.h"
+
+/**
+ * Header stored at the start of the compressed byte stream of an AKF_InterleavedKeyLerp sequence.
+ *
+ * The stream is laid out as:
+ *	- this header
+ *	- constant block: one FQuatFloat96NoW per constant rotation track, then one FVector per constant translation track, then one FVector per constant scale track
+ *	- NumKeys frame records of FrameStride bytes each, starting at FrameDataOffset. Each record holds one FQuatFixed48NoW per animated
+ *	  rotation track, padding to four bytes, then one FVector per animated translation track and one FVector per animated scale track.
+ *
+ * All the keys needed to sample every bone at a given frame are therefore contiguous in memory.
+ */
+struct FInterleavedKeyLerpHeader
+{
+	/** Number of frame records in the stream (every animated track has exactly this many keys) */
+	int32 NumKeys;
+	/** Byte offset of the first frame record */
+	int32 FrameDataOffset;
+	/** Size in bytes of a single frame record */
+	int32 FrameStride;
+	/** Number of FQuatFixed48NoW keys in each frame record */
+	int32 NumAnimatedRotations;
+	/** Number of translation FVector keys in each frame record */
+	int32 NumAnimatedTranslations;
+	/** Number of scale FVector keys in each frame record */
+	int32 NumAnimatedScales;
+};
+
+/**
+ * Offsets stored in CompressedTrackOffsets (two per track, translation then rotation) and CompressedScaleOffsets (one per track).
+ * An animated component stores its byte offset within a frame record, a constant component stores its byte offset
+ * within the compressed byte stream encoded as a negative number.
+ */
+namespace InterleavedKeyLerp
+{
+	FORCEINLINE int32 EncodeConstantOffset(int32 StreamOffset)
+	{
+		return -1 - StreamOffset;
+	}
+
+	FORCEINLINE int32 DecodeConstantOffset(int32 Offset)
+	{
+		return -1 - Offset;
+	}
+
+	FORCEINLINE bool IsConstantOffset(int32 Offset)
+	{
+		return Offset < 0;
+	}
+}
+
+/**
+ * Decompression codec for the key-frame interleaved compressor.
+ * A single codec instance decodes rotation, translation and scale, and can solve a whole pose in one pass over the two bracketing frame records.
+ */
+class AEFInterleavedKeyLerp : public AnimEncoding
+{
+public:
+	/**
+	 * Handles Byte-swapping incoming animation data from a MemoryReader
+	 *
+	 * @param	Seq					An Animation Sequence to contain the read data.
+	 * @param	MemoryReader		The MemoryReader object to read from.
+	 */
+	virtual void ByteSwapIn(UAnimSequence& Seq, FMemoryReader& MemoryReader) override;
+
+	/**
+	 * Handles Byte-swapping outgoing animation data to an array of BYTEs
+	 *
+	 * @param	Seq					An Animation Sequence to write.
+	 * @param	SerializedData		The output buffer.
+	 * @param	ForceByteSwapping	true is byte swapping is not optional.
+	 */
+	virtual void ByteSwapOut(
+		UAnimSequence& Seq,
+		TArray<uint8>& SerializedData,
+		bool ForceByteSwapping) override;
+
+	/**
+	 * Extracts a single BoneAtom from an Animation Sequence.
+	 *
+	 * @param	OutAtom			The BoneAtom to fill with the extracted result.
+	 * @param	Seq				An Animation Sequence to extract the BoneAtom from.
+	 * @param	TrackIndex		The index of the track desired in the Animation Sequence.
+	 * @param	Time			The time (in seconds) to calculate the BoneAtom for.
+	 */
+	virtual void GetBoneAtom(
+		FTransform& OutAtom,
+		const UAnimSequence& Seq,
+		int32 TrackIndex,
+		float Time) override;
+
+#if USE_ANIMATION_CODEC_BATCH_SOLVER
+
+	/**
+	 * Decompress all requested rotation components from an Animation Sequence
+	 *
+	 * @param	Atoms			The FTransform array to fill in.
+	 * @param	DesiredPairs	Array of requested bone information
+	 * @param	Seq				The animation sequence to use.
+	 * @param	Time			Current time to solve for.
+	 * @return					None.
+	 */
+	virtual void GetPoseRotations(
+		FTransformArray& Atoms,
+		const BoneTrackArray& DesiredPairs,
+		const UAnimSequence& Seq,
+		float Time) override;
+
+	/**
+	 * Decompress all requested translation components from an Animation Sequence
+	 *
+	 * @param	Atoms			The FTransform array to fill in.
+	 * @param	DesiredPairs	Array of requested bone information
+	 * @param	Seq				The animation sequence to use.
+	 * @param	Time			Current time to solve for.
+	 * @return					None.
+	 */
+	virtual void GetPoseTranslations(
+		FTransformArray& Atoms,
+		const BoneTrackArray& DesiredPairs,
+		const UAnimSequence& Seq,
+		float Time) override;
+
+	/**
+	 * Decompress all requested Scale components from an Animation Sequence
+	 *
+	 * @param	Atoms			The FTransform array to fill in.
+	 * @param	DesiredPairs	Array of requested bone information
+	 * @param	Seq				The animation sequence to use.
+	 * @param	Time			Current time to solve for.
+	 * @return					None.
+	 */
+	virtual void GetPoseScales(
+		FTransformArray& Atoms,
+		const BoneTrackArray& DesiredPairs,
+		const UAnimSequence& Seq,
+		float Time) override;
+
+	/**
+	 * Decompress every requested component of a pose at once. The key indices and blend alpha are solved a single time
+	 * and all bones are then read from the two bracketing frame records, which are contiguous in memory.
+	 *
+	 * @param	Atoms				The FTransform array to fill in.
+	 * @param	RotationPairs		Array of requested bone information for rotations.
+	 * @param	TranslationPairs	Array of requested bone information for translations.
+	 * @param	ScalePairs			Array of requested bone information for scales.
+	 * @param	Seq					The animation sequence to use.
+	 * @param	Time				Current time to solve for.
+	 */
+	static void GetPose(
+		FTransformArray& Atoms,
+		const BoneTrackArray& RotationPairs,
+		const BoneTrackArray& TranslationPairs,
+		const BoneTrackArray& ScalePairs,
+		const UAnimSequence& Seq,
+		float Time);
+#endif
+
+protected:
+	/** The two frame records bracketing a sample time, and the alpha to blend them with */
+	struct FFrameSample
+	{
+		const uint8* RESTRICT Frame0;
+		const uint8* RESTRICT Frame1;
+		VectorRegister Alpha;
+	};
+
+	/**
+	 * Finds the two frame records to interpolate for the given time.
+	 *
+	 * @param	Seq				The animation sequence to use.
+	 * @param	Time			Current time to solve for.
+	 * @param	OutSample		Receives the frame records and blend alpha.
+	 */
+	static void GetFrameSample(const UAnimSequence& Seq, float Time, FFrameSample& OutSample);
+
+	/** Decompress the rotation stored at Offset (see InterleavedKeyLerp) */
+	static void DecompressRotation(FTransform& OutAtom, const UAnimSequence& Seq, const FFrameSample& Sample, int32 Offset);
+
+	/** Decompress the translation stored at Offset (see InterleavedKeyLerp) */
+	static void DecompressTranslation(FTransform& OutAtom, const UAnimSequence& Seq, const FFrameSample& Sample, int32 Offset);
+
+	/** Decompress the scale stored at Offset (see InterleavedKeyLerp) */
+	static void DecompressScale(FTransform& OutAtom, const UAnimSequence& Seq, const FFrameSample& Sample, int32 Offset);
+
+	/**
+	 * Handles Byte-swapping the whole compressed byte stream from a MemoryReader or to a MemoryWriter
+	 *
+	 * @param	Seq					The Animation Sequence being operated on.
+	 * @param	MemoryStream		The MemoryReader or MemoryWriter object to read from/write to.
+	 */
+	static void ByteSwapStream(UAnimSequence& Seq, FMemoryArchive& MemoryStream);
+};
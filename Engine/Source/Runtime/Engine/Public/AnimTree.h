@@ -27,6 +27,9 @@ DECLARE_CYCLE_STAT_EXTERN(TEXT("Copy Pose"), STAT_AnimNativeCopyPoses, STATGROUP
 DECLARE_CYCLE_STAT_EXTERN(TEXT("StateMachine Eval"), STAT_AnimStateMachineEvaluate, STATGROUP_Anim, );
 DECLARE_CYCLE_STAT_EXTERN(TEXT("FillSpaceBases"), STAT_SkelComposeTime, STATGROUP_Anim, );
 DECLARE_CYCLE_STAT_EXTERN(TEXT("InterpolateSkippedFrames"), STAT_InterpolateSkippedFrames, STATGROUP_Anim, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Skipped Anim Updates"), STAT_AnimSkippedUpdates, STATGROUP_Anim, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Skipped Anim Evaluations"), STAT_AnimSkippedEvaluations, STATGROUP_Anim, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Interpolated Anim Frames"), STAT_AnimInterpolatedFrames, STATGROUP_Anim, );
 DECLARE_CYCLE_STAT_EXTERN(TEXT("UpdateKinematicBonesToPhysics"), STAT_UpdateRBBones, STATGROUP_Anim, );
 DECLARE_CYCLE_STAT_EXTERN(TEXT("UpdateRBJointsMotors"), STAT_UpdateRBJoints, STATGROUP_Anim, );
 DECLARE_CYCLE_STAT_EXTERN(TEXT("UpdateLocalToWorldAndOverlaps"), STAT_UpdateLocalToWorldAndOverlaps, STATGROUP_Anim, );
@@ -47,6 +47,21 @@ public:
 		const FBoneContainer& RequiredBones,
 		/*out*/ FTransformArrayA2& ResultAtoms);
 
+	/**
+	 * Blends together a set of poses over an explicit list of bone indices.
+	 * Each bone is accumulated across all poses and normalized while held in registers, so ResultAtoms is written once per bone
+	 * instead of once per pose plus a separate normalization pass.
+	 *
+	 * @param	ResultAtoms			Output array of relative bone transforms. May alias one of the source poses.
+	 * @param	RequiredBoneIndices	Indices of bones to blend. Bones not in this array are not modified.
+	 */
+	static void BlendPosesTogether(
+		int32 NumPoses,
+		const FTransformArrayA2* const* SourcePoses,
+		const float* SourceWeights,
+		const TArray<FBoneIndexType>& RequiredBoneIndices,
+		/*out*/ FTransformArrayA2& ResultAtoms);
+
 	/**
 	 * Blends together a set of poses, each with a given weight.
 	 * This function is lightweight, it does not cull out nearly zero weights or check to make sure weights sum to 1.0, the caller should take care of that if needed.
@@ -190,6 +205,14 @@ public:
 		const FBoneContainer& RequiredBones, 
 		/*out*/ FTransformArrayA2& ResultAtoms);
 
+	/** Same as above over an explicit list of bone indices. Rotations are normalized as each bone is written rather than in a second pass. */
+	static void BlendAdditivePose(
+		const FTransformArrayA2& SourcePoses, 
+		const FTransformArrayA2& AdditiveBlendPoses, 
+		const float BlendWeight, 
+		const TArray<FBoneIndexType>& RequiredBoneIndices, 
+		/*out*/ FTransformArrayA2& ResultAtoms);
+
 	/** Lerp for BoneTransforms. Stores results in A. Performs A = Lerp(A, B, Alpha);
 	 * @param A : In/Out transform array.
 	 * @param B : B In transform array.
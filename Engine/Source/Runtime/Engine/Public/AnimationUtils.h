@@ -163,6 +163,7 @@ public:
 	 * @param	bTryPerTrackBitwiseCompression			If true, the per-track compressor techniques will be tried
 	 * @param	bTryLinearKeyRemovalCompression			If true, the linear key removal techniques will be tried
 	 * @param	bTryIntervalKeyRemoval					If true, the resampling techniques will be tried
+	 * @param	bTryInterleavedKeyLerp					If true, the key-frame interleaved technique will be tried
 	 *
 	 * @return	None.
 	 */
@@ -176,7 +177,8 @@ public:
 		bool bTryFixedBitwiseCompression,
 		bool bTryPerTrackBitwiseCompression,
 		bool bTryLinearKeyRemovalCompression,
-		bool bTryIntervalKeyRemoval);
+		bool bTryIntervalKeyRemoval,
+		bool bTryInterleavedKeyLerp);
 
 	/**
 	 * Tests for a missing or invalid mesh on the animation sequence, warning if one or more were found
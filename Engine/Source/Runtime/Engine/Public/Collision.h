@@ -19,6 +19,8 @@ DECLARE_CYCLE_STAT_EXTERN(TEXT("GeomOverlapAny"),STAT_Collision_GeomOverlapAny,S
 DECLARE_CYCLE_STAT_EXTERN(TEXT("GeomOverlapSingle"),STAT_Collision_GeomOverlapSingle,STATGROUP_Collision, );
 DECLARE_CYCLE_STAT_EXTERN(TEXT("GeomOverlapMultiple"),STAT_Collision_GeomOverlapMultiple,STATGROUP_Collision, );
 DECLARE_CYCLE_STAT_EXTERN(TEXT("GeomComputePenetration"), STAT_Collision_GeomComputePenetration, STATGROUP_Collision, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("SceneQueryBatch"), STAT_Collision_SceneQueryBatch, STATGROUP_Collision, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("SceneQueryBatch Queries"), STAT_Collision_SceneQueryBatchQueries, STATGROUP_Collision, );
 
 /** Enable collision analyzer support */
 #if (1 && !(UE_BUILD_SHIPPING || UE_BUILD_TEST) && WITH_EDITOR && WITH_UNREAL_DEVELOPER_TOOLS && WITH_PHYSX)
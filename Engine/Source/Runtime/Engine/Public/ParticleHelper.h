@@ -180,6 +180,66 @@ struct FBaseParticle
 	FLinearColor	BaseColor;				// Base color of the particle
 };
 
+/*-----------------------------------------------------------------------------
+	FParticleStreams
+-----------------------------------------------------------------------------*/
+/**
+ *	Structure of arrays copy of the FBaseParticle members touched by the common update modules.
+ *	FParticleEmitterInstance::Tick_ModuleUpdate gathers the active particles into it for runs of modules that
+ *	support it (see UParticleModule::CanUpdateStreams), so their updates can process four particles per instruction.
+ *	Every stream holds NumParticles entries in ParticleIndices order, padded with zeros to a multiple of four.
+ */
+struct ENGINE_API FParticleStreams
+{
+	/** Number of particles in the streams */
+	int32 NumParticles;
+	/** Number of particles the streams were allocated for */
+	int32 Capacity;
+
+	/** FBaseParticle::RelativeTime, read only */
+	float* RelativeTime;
+	/** FBaseParticle::Velocity, one stream per component */
+	float* Velocity[3];
+	/** FBaseParticle::BaseVelocity, one stream per component */
+	float* BaseVelocity[3];
+	/** FBaseParticle::Size, one stream per component */
+	float* Size[3];
+	/** FBaseParticle::Color, one stream per component */
+	float* Color[4];
+	/** Per particle values for the module currently updating, typically distributions sampled at RelativeTime. Not preserved between modules. */
+	float* Scratch[3];
+
+	FParticleStreams();
+
+	/**
+	 *	Copies particles into the streams, allocating them from MemStack the first time or when there are more particles than before.
+	 *
+	 *	@param	MemStack			The stack to allocate the streams from; they are valid until it is popped.
+	 *	@param	ParticleData		The particles, as stored by FParticleEmitterInstance.
+	 *	@param	ParticleStride		The size of a particle, including payloads.
+	 *	@param	ParticleIndices		The indices of the particles to copy.
+	 *	@param	InNumParticles		The number of particles to copy.
+	 */
+	void Gather(FMemStackBase& MemStack, const uint8* ParticleData, uint32 ParticleStride, const uint16* ParticleIndices, int32 InNumParticles);
+
+	/**
+	 *	Copies the streams back into the particles they were gathered from. Frozen particles are left untouched, as in BEGIN_UPDATE_LOOP.
+	 */
+	void Scatter(uint8* ParticleData, uint32 ParticleStride, const uint16* ParticleIndices) const;
+
+	/** Velocity += DeltaVelocity and BaseVelocity += DeltaVelocity */
+	void AddVelocity(const FVector& DeltaVelocity);
+
+	/** Velocity and BaseVelocity += Velocity * -Scratch[0] * DeltaTime */
+	void ApplyDrag(float DeltaTime);
+
+	/** Size *= Scratch, for the components requested */
+	void MultiplySize(bool bMultiplyX, bool bMultiplyY, bool bMultiplyZ);
+
+	/** Velocity = Transform.TransformVector(Scratch) * Scale, or Velocity *= that value if bMultiply */
+	void SetVelocity(const FMatrix& Transform, const FVector& Scale, bool bMultiply);
+};
+
 /*-----------------------------------------------------------------------------
 	Particle State Flags
 -----------------------------------------------------------------------------*/
@@ -230,9 +290,13 @@ DECLARE_CYCLE_STAT_EXTERN(TEXT("Particle Packing Time"),STAT_ParticlePackingTime
 DECLARE_CYCLE_STAT_EXTERN(TEXT("SetTemplate Time"),STAT_ParticleSetTemplateTime,STATGROUP_Particles, );
 DECLARE_CYCLE_STAT_EXTERN(TEXT("Initialize Time"),STAT_ParticleInitializeTime,STATGROUP_Particles, );
 DECLARE_CYCLE_STAT_EXTERN(TEXT("Activate Time"),STAT_ParticleActivateTime,STATGROUP_Particles, );
-DECLARE_CYCLE_STAT_EXTERN(TEXT("Async Work Time"),STAT_ParticleAsyncTime,STATGROUP_Particles, );           // regardless of if it is actually performed on other threads or not
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Async Work Time"),STAT_ParticleAsyncTime,STATGROUP_Particles, );           // only the compute time that actually ran off the game thread
 DECLARE_CYCLE_STAT_EXTERN(TEXT("Wait For ASync Time"),STAT_ParticleAsyncWaitTime,STATGROUP_Particles, );   // can be either performed on this thread or a true wait
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("PSys Ticked Async"),STAT_ParticleSystemsTickedAsync,STATGROUP_Particles, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("PSys Ticked On GT"),STAT_ParticleSystemsTickedSync,STATGROUP_Particles, );
 DECLARE_CYCLE_STAT_EXTERN(TEXT("Update Bounds Time"),STAT_ParticleUpdateBounds,STATGROUP_Particles, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Stream Update Time"),STAT_ParticleStreamUpdateTime,STATGROUP_Particles, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Ptcls Stream Updated"),STAT_ParticleStreamUpdated,STATGROUP_Particles, );
 
 DECLARE_CYCLE_STAT_EXTERN(TEXT("Particle Memory Time"),STAT_ParticleMemTime,STATGROUP_ParticleMem, );
 DECLARE_MEMORY_STAT_EXTERN(TEXT("Ptcls Data GT Mem"),STAT_GTParticleData,STATGROUP_ParticleMem, );
@@ -94,9 +94,18 @@ private:
 	 */
 	int32 PullTasksFromQueue();
 
-	/** Used when compiling through workers, writes out the worker inputs for any new tasks in WorkerInfos.QueuedJobs. */
+	/** Moves the next batch of jobs from Manager->CompileQueue into OutJobs.  Manager->CompileQueueSection must be locked. */
+	void GrabTasksFromQueue(TArray<FShaderCompileJob*>& OutJobs);
+
+	/** Returns true if workers can be handed their next batch while they are still compiling the current one. */
+	bool ShouldPrefetchTasks() const;
+
+	/** Used when compiling through workers, writes out the worker inputs for any new tasks in WorkerInfos.QueuedJobs and WorkerInfos.PrefetchedJobs. */
 	void WriteNewTasks();
 
+	/** Writes out the input file for the given worker, containing the given jobs. */
+	void WriteTasksFile(int32 WorkerIndex, TArray<FShaderCompileJob*>& Jobs);
+
 	/** Used when compiling through workers, launches worker processes if needed. */
 	bool LaunchWorkersIfNeeded();
 
@@ -194,6 +203,8 @@ private:
 	bool bPromptToRetryFailedShaderCompiles;
 	/** Whether to log out shader job completion times on the worker thread.  Useful for tracking down which global shader is taking a long time. */
 	bool bLogJobCompletionTimes;
+	/** Whether to hand workers their next batch of jobs while they are still compiling the current one, so they don't idle between batches. */
+	bool bPrefetchWorkerTasks;
 	/** Target execution time for ProcessAsyncResults.  Larger values speed up async shader map processing but cause more hitchiness while async compiling is happening. */
 	float ProcessGameThreadTargetTime;
 	/** Base directory where temporary files are written out during multi core shader compiling. */
@@ -213,6 +224,9 @@ private:
 	 */
 	double WorkersBusyTime;
 
+	/** Total number of jobs that have been compiled since startup, only modified with CompileQueueSection locked. */
+	int32 NumCompletedJobs;
+
 	/** Launches the worker, returns the launched process handle. */
 	FProcHandle LaunchWorker(const FString& WorkingDirectory, uint32 ProcessId, uint32 ThreadId, const FString& WorkerInputFile, const FString& WorkerOutputFile, bool bUseNamedPipes, bool bSingleConnectionPipe);
 
@@ -265,6 +279,16 @@ public:
 		return NumOutstandingJobs;
 	}
 
+	/** 
+	 * Returns the total number of jobs compiled since startup, and the total time workers have been busy.
+	 * Note: This is updated from another thread, so the results are non-deterministic while compiling.
+	 */
+	void GetCompletedJobStats(int32& OutNumCompletedJobs, double& OutWorkersBusyTime) const
+	{
+		OutNumCompletedJobs = NumCompletedJobs;
+		OutWorkersBusyTime = WorkersBusyTime;
+	}
+
 	const FString& GetAbsoluteShaderDebugInfoDirectory() const
 	{
 		return AbsoluteShaderDebugInfoDirectory;
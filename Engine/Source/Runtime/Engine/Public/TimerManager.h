@@ -70,28 +70,25 @@ struct FTimerUnifiedDelegate
 };
 
 // Unique handle that can be used to distinguish timers that have identical delegates.
+// Holds the index of the timer in the FTimerManager storage along with a serial number, so lookups don't need to search.
 struct FTimerHandle
 {
-	FTimerHandle()
-	: Handle(INDEX_NONE)
-	{
-
-	}
+	friend class FTimerManager;
 
-	FTimerHandle(int32 InHandle)
-		: Handle(InHandle)
+	FTimerHandle()
+	: Handle(0)
 	{
 
 	}
 
 	bool IsValid() const
 	{
-		return Handle != INDEX_NONE;
+		return Handle != 0;
 	}
 
 	void Invalidate()
 	{
-		Handle = INDEX_NONE;
+		Handle = 0;
 	}
 
 	void MakeValid();
@@ -108,11 +105,33 @@ struct FTimerHandle
 
 	FString ToString() const
 	{
-		return FString::Printf(TEXT("%d"), Handle);
+		return FString::Printf(TEXT("%llu"), Handle);
 	}
 
 private:
-	int32 Handle;
+	static const uint32 IndexBits        = 24;
+	static const uint32 SerialNumberBits = 40;
+
+	static_assert(IndexBits + SerialNumberBits == 64, "The timer handle index and serial number should use all 64 bits");
+
+	static const int32  MaxIndex        = (int32)1 << IndexBits;
+	static const uint64 MaxSerialNumber = (uint64)1 << SerialNumberBits;
+
+	static uint64 GenerateSerialNumber();
+
+	void SetIndexAndSerialNumber(int32 Index, uint64 SerialNumber)
+	{
+		check(Index >= 0 && Index < MaxIndex);
+		check(SerialNumber < MaxSerialNumber);
+		Handle = (SerialNumber << IndexBits) | (uint64)(uint32)Index;
+	}
+
+	FORCEINLINE int32 GetIndex() const
+	{
+		return (int32)(Handle & (uint64)(MaxIndex - 1));
+	}
+
+	uint64 Handle;
 };
 
 namespace ETimerStatus
@@ -121,7 +140,8 @@ namespace ETimerStatus
 	{
 		Pending,
 		Active,
-		Paused
+		Paused,
+		Executing
 	};
 }
 
@@ -146,14 +166,27 @@ struct FTimerData
 	/** Holds the delegate to call. */
 	FTimerUnifiedDelegate TimerDelegate;
 
+	/** Handle of this timer, always valid once the timer is stored in the FTimerManager. */
 	FTimerHandle TimerHandle;
 
+	/** If true, this timer was set without a handle and is looked up by its delegate instead. */
+	bool bIdentifiedByDelegate;
+
+	/** Timer wheel slot (or pending list) this timer is linked into, INDEX_NONE if it is not in any. */
+	int32 Bucket;
+
+	/** Previous and next timers linked into the same bucket. */
+	int32 PrevIndex;
+	int32 NextIndex;
+
 	FTimerData()
 		: bLoop(false), Status(ETimerStatus::Active)
 		, Rate(0), ExpireTime(0)
+		, bIdentifiedByDelegate(false)
+		, Bucket(INDEX_NONE), PrevIndex(INDEX_NONE), NextIndex(INDEX_NONE)
 	{}
 
-	/** Operator less, used to sort the heap based on time until execution. **/
+	/** Operator less, orders timers based on time until execution. **/
 	bool operator<(const FTimerData& Other) const
 	{
 		return ExpireTime < Other.ExpireTime;
@@ -163,6 +196,12 @@ struct FTimerData
 
 /** 
  * Class to globally manage timers.
+ *
+ * Timers are stored in a sparse array indexed by their handle, so finding, pausing and clearing a timer doesn't
+ * depend on how many timers are set.  Active timers are linked into a hierarchical timer wheel: each level has
+ * WheelSlotsPerLevel slots, a slot of the first level spans one wheel tick and a slot of every other level spans
+ * a whole turn of the level below it.  Slots of the upper levels are spread over the lower ones as the wheel turns,
+ * and only the slots the clock went through are visited by Tick.
  */
 class ENGINE_API FTimerManager : public FNoncopyable
 {
@@ -179,9 +218,15 @@ public:
 	// Timer API
 
 	FTimerManager()
-		: InternalTime(0.0)
+		: WheelTick(0)
+		, InternalTime(0.0)
 		, LastTickedFrame(static_cast<uint64>(-1))
-	{}
+	{
+		for (int32 Bucket = 0; Bucket < NumBuckets; ++Bucket)
+		{
+			BucketHeads[Bucket] = INDEX_NONE;
+		}
+	}
 
 
 	/**
@@ -393,14 +438,16 @@ public:
 	DELEGATE_DEPRECATED("This overload of UnPauseTimer is deprecated, use UnPauseTimer(FTimerHandle InHandle) instead.")
 	FORCEINLINE void UnPauseTimer(UserClass* inObj, typename FTimerDelegate::TUObjectMethodDelegate< UserClass >::FMethodPtr inTimerMethod)
 	{
-		int32 TimerIdx = DEPRECATED_FindTimerInList( PausedTimerList, FTimerUnifiedDelegate( FTimerDelegate::CreateUObject(inObj, inTimerMethod) ) );
+		int32 TimerIdx = INDEX_NONE;
+		DEPRECATED_FindTimer( FTimerUnifiedDelegate( FTimerDelegate::CreateUObject(inObj, inTimerMethod) ), &TimerIdx );
 		InternalUnPauseTimer(TimerIdx);
 	}
 	template< class UserClass >
 	DELEGATE_DEPRECATED("This overload of UnPauseTimer is deprecated, use UnPauseTimer(FTimerHandle InHandle) instead.")
 	FORCEINLINE void UnPauseTimer(UserClass* inObj, typename FTimerDelegate::TUObjectMethodDelegate_Const< UserClass >::FMethodPtr inTimerMethod)
 	{
-		int32 TimerIdx = DEPRECATED_FindTimerInList( PausedTimerList, FTimerUnifiedDelegate( FTimerDelegate::CreateUObject(inObj, inTimerMethod) ) );
+		int32 TimerIdx = INDEX_NONE;
+		DEPRECATED_FindTimer( FTimerUnifiedDelegate( FTimerDelegate::CreateUObject(inObj, inTimerMethod) ), &TimerIdx );
 		InternalUnPauseTimer(TimerIdx);
 	}
 
@@ -408,20 +455,23 @@ public:
 	DELEGATE_DEPRECATED("This overload of UnPauseTimer is deprecated, use UnPauseTimer(FTimerHandle InHandle) instead.")
 	FORCEINLINE void UnPauseTimer(FTimerDelegate const& InDelegate)
 	{
-		int32 TimerIdx = DEPRECATED_FindTimerInList( PausedTimerList, FTimerUnifiedDelegate(InDelegate) );
+		int32 TimerIdx = INDEX_NONE;
+		DEPRECATED_FindTimer( FTimerUnifiedDelegate(InDelegate), &TimerIdx );
 		InternalUnPauseTimer(TimerIdx);
 	}
 	/** Version that takes a dynamic delegate (e.g. for UFunctions). */
 	DELEGATE_DEPRECATED("This overload of UnPauseTimer is deprecated, use UnPauseTimer(FTimerHandle InHandle) instead.")
 	FORCEINLINE void UnPauseTimer(FTimerDynamicDelegate const& InDynDelegate)
 	{
-		int32 TimerIdx = DEPRECATED_FindTimerInList( PausedTimerList, FTimerUnifiedDelegate(InDynDelegate) );
+		int32 TimerIdx = INDEX_NONE;
+		DEPRECATED_FindTimer( FTimerUnifiedDelegate(InDynDelegate), &TimerIdx );
 		InternalUnPauseTimer(TimerIdx);
 	}
 	/** Version that takes a handle */
 	FORCEINLINE void UnPauseTimer(FTimerHandle InHandle)
 	{
-		int32 TimerIdx = FindTimerInList(PausedTimerList, InHandle);
+		int32 TimerIdx = INDEX_NONE;
+		FindTimer(InHandle, &TimerIdx);
 		InternalUnPauseTimer(TimerIdx);
 	}
 
@@ -756,17 +806,21 @@ private:
 
 	void DEPRECATED_InternalSetTimer( FTimerUnifiedDelegate const& InDelegate, float InRate, bool InbLoop, float InFirstDelay );
 	void InternalSetTimer( FTimerHandle& InOutHandle, FTimerUnifiedDelegate const& InDelegate, float InRate, bool InbLoop, float InFirstDelay );
-	void InternalSetTimer( FTimerData& NewTimerData, float InRate, bool InbLoop, float InFirstDelay );
+	FTimerHandle InternalSetTimer( FTimerData& NewTimerData, float InRate, bool InbLoop, float InFirstDelay );
 	void InternalSetTimerForNextTick( FTimerUnifiedDelegate const& InDelegate );
 	void DEPRECATED_InternalClearTimer( FTimerUnifiedDelegate const& InDelegate );
 	void InternalClearTimer( FTimerHandle const& InDelegate );
-	void InternalClearTimer( int32 TimerIdx, ETimerStatus::Type TimerStatus );
+	void InternalClearTimer( int32 TimerIdx );
 	void InternalClearAllTimers( void const* Object );
 
-	/** Will find a timer in the active, paused, or pending list. */
+	/** Will find an active, paused, or pending timer. */
 	FTimerData const* DEPRECATED_FindTimer( FTimerUnifiedDelegate const& InDelegate, int32* OutTimerIndex=nullptr ) const;
 	FTimerData const* FindTimer( FTimerHandle const& InHandle, int32* OutTimerIndex = nullptr ) const;
 
+	/** Will find the given timer in the timer storage and return its index, including the timer currently being executed. */
+	int32 DEPRECATED_FindTimerIndex( FTimerUnifiedDelegate const& InDelegate ) const;
+	int32 FindTimerIndex( FTimerHandle const& InHandle ) const;
+
 	void InternalPauseTimer( FTimerData const* TimerToPause, int32 TimerIdx );
 	void InternalUnPauseTimer( int32 PausedTimerIdx );
 	
@@ -774,16 +828,36 @@ private:
 	float InternalGetTimerElapsed( FTimerData const* const TimerData ) const;
 	float InternalGetTimerRemaining( FTimerData const* const TimerData ) const;
 
-	/** Will find the given timer in the given TArray and return its index. */ 
-	int32 DEPRECATED_FindTimerInList( const TArray<FTimerData> &SearchArray, FTimerUnifiedDelegate const& InDelegate ) const;
-	int32 FindTimerInList( const TArray<FTimerData> &SearchArray, FTimerHandle const& InHandle ) const;
-
-	/** Heap of actively running timers. */
-	TArray<FTimerData> ActiveTimerHeap;
-	/** Unordered list of paused timers. */
-	TArray<FTimerData> PausedTimerList;
-	/** List of timers added this frame, to be added after timer has been ticked */
-	TArray<FTimerData> PendingTimerList;
+	/** Stores a new timer, links it into the wheel or the pending list depending on its status and returns its handle. */
+	FTimerHandle AddTimer( FTimerData const& TimerData );
+	/** Unlinks a timer and frees its storage. */
+	void RemoveTimer( int32 TimerIdx );
+
+	/** Links an active timer into the wheel slot of its expire time. */
+	void ScheduleTimer( int32 TimerIdx );
+	void LinkTimer( int32 TimerIdx, int32 Bucket );
+	void UnlinkTimer( int32 TimerIdx );
+	/** Relinks every timer of a bucket into the slots matching the current wheel tick. */
+	void RescheduleBucket( int32 Bucket );
+	/** Turns the wheel up to the current time, unlinking every timer that expired into OutExpiredTimers. */
+	void CollectExpiredTimers( TArray<FTimerHandle>& OutExpiredTimers );
+
+	/** Number of bits of the slot index of each level of the timer wheel. */
+	static const int32 WheelSlotBits = 6;
+	static const int32 WheelSlotsPerLevel = 1 << WheelSlotBits;
+	static const int32 WheelLevels = 4;
+	/** Timers too far in the future for the wheel, looked at again every time the last level turns. */
+	static const int32 OverflowBucket = WheelLevels * WheelSlotsPerLevel;
+	/** Timers added this frame, to be activated after the timer has been ticked. */
+	static const int32 PendingBucket = OverflowBucket + 1;
+	static const int32 NumBuckets = PendingBucket + 1;
+
+	/** Storage of every timer, indexed by the timer handles. */
+	TSparseArray<FTimerData> Timers;
+	/** Index of the first timer linked into each bucket. */
+	int32 BucketHeads[NumBuckets];
+	/** Wheel tick the wheel has been turned to, no timer in the wheel expires before it. */
+	int64 WheelTick;
 
 	/** An internally consistent clock, independent of World.  Advances during ticking. */
 	double InternalTime;
@@ -345,6 +345,11 @@ dtCrowd::dtCrowd() :
 	m_activeAgents(0),
 	m_agentAnims(0),
 	m_obstacleQuery(0),
+	m_parallelObstacleQueries(0),
+	m_numParallelObstacleQueries(0),
+	m_maxAvoidedNeighbors(0),
+	m_maxAvoidedWalls(0),
+	m_maxAvoidancePatterns(0),
 	m_grid(0),
 	m_pathResult(0),
 	m_maxPathResult(0),
@@ -384,6 +389,8 @@ void dtCrowd::purge()
 	dtFreeProximityGrid(m_grid);
 	m_grid = 0;
 
+	freeParallelAvoidance();
+
 	dtFreeObstacleAvoidanceQuery(m_obstacleQuery);
 	m_obstacleQuery = 0;
 	
@@ -391,6 +398,15 @@ void dtCrowd::purge()
 	m_navquery = 0;
 }
 
+void dtCrowd::freeParallelAvoidance()
+{
+	for (int i = 0; i < m_numParallelObstacleQueries; ++i)
+		dtFreeObstacleAvoidanceQuery(m_parallelObstacleQueries[i]);
+	dtFree(m_parallelObstacleQueries);
+	m_parallelObstacleQueries = 0;
+	m_numParallelObstacleQueries = 0;
+}
+
 /// @par
 ///
 /// May be called more than once to purge and re-initialize the crowd.
@@ -469,6 +485,10 @@ bool dtCrowd::initAvoidance(const int maxNeighbors, const int maxWalls, const in
 	if (!m_obstacleQuery->init(maxNeighbors, maxWalls, maxCustomPatterns))
 		return false;
 
+	m_maxAvoidedNeighbors = maxNeighbors;
+	m_maxAvoidedWalls = maxWalls;
+	m_maxAvoidancePatterns = maxCustomPatterns;
+
 	// Init obstacle query params.
 	memset(m_obstacleQueryParams, 0, sizeof(m_obstacleQueryParams));
 	for (int i = 0; i < DT_CROWD_MAX_OBSTAVOIDANCE_PARAMS; ++i)
@@ -489,6 +509,41 @@ bool dtCrowd::initAvoidance(const int maxNeighbors, const int maxWalls, const in
 	return true;
 }
 
+bool dtCrowd::initParallelAvoidance(const int numQueries)
+{
+	freeParallelAvoidance();
+	if (!m_obstacleQuery)
+		return false;
+	if (numQueries <= 1)
+		return true;
+
+	m_parallelObstacleQueries = (dtObstacleAvoidanceQuery**)dtAlloc(sizeof(dtObstacleAvoidanceQuery*)*(numQueries - 1), DT_ALLOC_PERM);
+	if (!m_parallelObstacleQueries)
+		return false;
+
+	float angles[DT_MAX_CUSTOM_SAMPLES];
+	float radii[DT_MAX_CUSTOM_SAMPLES];
+	for (int i = 0; i < numQueries - 1; ++i)
+	{
+		dtObstacleAvoidanceQuery* query = dtAllocObstacleAvoidanceQuery();
+		if (!query)
+			return false;
+
+		m_parallelObstacleQueries[m_numParallelObstacleQueries++] = query;
+		if (!query->init(m_maxAvoidedNeighbors, m_maxAvoidedWalls, m_maxAvoidancePatterns))
+			return false;
+
+		for (int patternIdx = 0; patternIdx < m_maxAvoidancePatterns; ++patternIdx)
+		{
+			int nsamples = 0;
+			if (m_obstacleQuery->getCustomSamplingPattern(patternIdx, angles, radii, &nsamples))
+				query->setCustomSamplingPattern(patternIdx, angles, radii, nsamples);
+		}
+	}
+
+	return true;
+}
+
 void dtCrowd::setObstacleAvoidanceParams(const int idx, const dtObstacleAvoidanceParams* params)
 {
 	if (idx >= 0 && idx < DT_CROWD_MAX_OBSTAVOIDANCE_PARAMS)
@@ -505,6 +560,8 @@ const dtObstacleAvoidanceParams* dtCrowd::getObstacleAvoidanceParams(const int i
 void dtCrowd::setObstacleAvoidancePattern(int idx, const float* angles, const float* radii, int nsamples)
 {
 	m_obstacleQuery->setCustomSamplingPattern(idx, angles, radii, nsamples);
+	for (int i = 0; i < m_numParallelObstacleQueries; ++i)
+		m_parallelObstacleQueries[i]->setCustomSamplingPattern(idx, angles, radii, nsamples);
 }
 
 bool dtCrowd::getObstacleAvoidancePattern(int idx, float* angles, float* radii, int* nsamples)
@@ -1244,7 +1301,13 @@ void dtCrowd::updateStepPaths(const float dt, dtCrowdAgentDebugInfo*)
 	updateTopologyOptimization(m_activeAgents, m_numActiveAgents, dt);
 }
 
-void dtCrowd::updateStepProximityData(const float dt, dtCrowdAgentDebugInfo*)
+void dtCrowd::updateStepProximityData(const float dt, dtCrowdAgentDebugInfo* debug)
+{
+	updateStepBoundaries(dt, debug);
+	updateStepNeighbours(0, m_numActiveAgents);
+}
+
+void dtCrowd::updateStepBoundaries(const float dt, dtCrowdAgentDebugInfo*)
 {
 	// Register agents to proximity grid.
 	m_grid->clear();
@@ -1256,7 +1319,7 @@ void dtCrowd::updateStepProximityData(const float dt, dtCrowdAgentDebugInfo*)
 		m_grid->addItem((unsigned short)i, p[0] - r, p[2] - r, p[0] + r, p[2] + r);
 	}
 
-	// Get nearby navmesh segments and agents to collide with.
+	// Get nearby navmesh segments to collide with.
 	for (int i = 0; i < m_numActiveAgents; ++i)
 	{
 		dtCrowdAgent* ag = m_activeAgents[i];
@@ -1307,6 +1370,18 @@ void dtCrowd::updateStepProximityData(const float dt, dtCrowdAgentDebugInfo*)
 
 			m_raycastFilter.setAreaCost(allowedArea, DT_UNWALKABLE_POLY_COST);
 		}
+	}
+}
+
+void dtCrowd::updateStepNeighbours(const int startIdx, const int endIdx)
+{
+	// Get nearby agents to collide with.
+	for (int i = startIdx; i < endIdx; ++i)
+	{
+		dtCrowdAgent* ag = m_activeAgents[i];
+		if (ag->state != DT_CROWDAGENT_STATE_WALKING)
+			continue;
+
 		// Query neighbour agents
 		ag->nneis = getNeighbours(ag->npos, ag->params.height, ag->params.collisionQueryRange,
 			ag, ag->neis, DT_CROWDAGENT_MAX_NEIGHBOURS,
@@ -1516,12 +1591,18 @@ void dtCrowd::updateStepSteering(const float dt, dtCrowdAgentDebugInfo*)
 }
 
 void dtCrowd::updateStepAvoidance(const float dt, dtCrowdAgentDebugInfo* debug)
+{
+	m_velocitySampleCount = updateStepAvoidanceRange(0, m_numActiveAgents, 0, debug);
+}
+
+int dtCrowd::updateStepAvoidanceRange(const int startIdx, const int endIdx, const int queryIdx, dtCrowdAgentDebugInfo* debug)
 {
 	const int debugIdx = debug ? debug->idx : -1;
-	m_velocitySampleCount = 0;
+	dtObstacleAvoidanceQuery* obstacleQuery = getObstacleQuery(queryIdx);
+	int velocitySampleCount = 0;
 
 	// Velocity planning.	
-	for (int i = 0; i < m_numActiveAgents; ++i)
+	for (int i = startIdx; i < endIdx; ++i)
 	{
 		dtCrowdAgent* ag = m_activeAgents[i];
 
@@ -1530,13 +1611,13 @@ void dtCrowd::updateStepAvoidance(const float dt, dtCrowdAgentDebugInfo* debug)
 
 		if (ag->params.updateFlags & DT_CROWD_OBSTACLE_AVOIDANCE)
 		{
-			m_obstacleQuery->reset();
+			obstacleQuery->reset();
 
 			// Add neighbours as obstacles.
 			for (int j = 0; j < ag->nneis; ++j)
 			{
 				const dtCrowdAgent* nei = &m_agents[ag->neis[j].idx];
-				m_obstacleQuery->addCircle(nei->npos, nei->params.radius, nei->vel, nei->dvel);
+				obstacleQuery->addCircle(nei->npos, nei->params.radius, nei->vel, nei->dvel);
 			}
 
 			// Append neighbour segments as obstacles.
@@ -1545,7 +1626,7 @@ void dtCrowd::updateStepAvoidance(const float dt, dtCrowdAgentDebugInfo* debug)
 				const float* s = ag->boundary.getSegment(j);
 				if (dtTriArea2D(ag->npos, s, s + 3) < 0.0f)
 					continue;
-				m_obstacleQuery->addSegment(s, s + 3);
+				obstacleQuery->addSegment(s, s + 3);
 			}
 
 			dtObstacleAvoidanceDebugData* vod = 0;
@@ -1555,11 +1636,11 @@ void dtCrowd::updateStepAvoidance(const float dt, dtCrowdAgentDebugInfo* debug)
 
 			// Sample new safe velocity.
 			const dtObstacleAvoidanceParams* params = &m_obstacleQueryParams[ag->params.obstacleAvoidanceType];
-			const int ns = m_obstacleQuery->sampleVelocity(
+			const int ns = obstacleQuery->sampleVelocity(
 					ag->npos, ag->params.radius, ag->desiredSpeed,
 					ag->vel, ag->dvel, ag->nvel, params, vod);
 
-			m_velocitySampleCount += ns;
+			velocitySampleCount += ns;
 		}
 		else
 		{
@@ -1567,6 +1648,8 @@ void dtCrowd::updateStepAvoidance(const float dt, dtCrowdAgentDebugInfo* debug)
 			dtVcopy(ag->nvel, ag->dvel);
 		}
 	}
+
+	return velocitySampleCount;
 }
 
 void dtCrowd::updateStepMove(const float dt, dtCrowdAgentDebugInfo*)
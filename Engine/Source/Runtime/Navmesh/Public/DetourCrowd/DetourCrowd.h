@@ -224,6 +224,15 @@ class NAVMESH_API dtCrowd
 
 	dtObstacleAvoidanceParams m_obstacleQueryParams[DT_CROWD_MAX_OBSTAVOIDANCE_PARAMS];
 	dtObstacleAvoidanceQuery* m_obstacleQuery;
+
+	// [UE4] additional avoidance queries, used by updateStepAvoidanceRange running on other threads
+	dtObstacleAvoidanceQuery** m_parallelObstacleQueries;
+	int m_numParallelObstacleQueries;
+
+	// [UE4] initAvoidance params, used when allocating additional avoidance queries
+	int m_maxAvoidedNeighbors;
+	int m_maxAvoidedWalls;
+	int m_maxAvoidancePatterns;
 	
 	dtProximityGrid* m_grid;
 	
@@ -257,6 +266,13 @@ class NAVMESH_API dtCrowd
 	bool requestMoveTargetReplan(const int idx, dtPolyRef ref, const float* pos);
 
 	void purge();
+	void freeParallelAvoidance();
+
+	// [UE4] avoidance query used by updateStepAvoidanceRange, 0 = main query
+	dtObstacleAvoidanceQuery* getObstacleQuery(const int queryIdx) const
+	{
+		return queryIdx > 0 ? m_parallelObstacleQueries[queryIdx - 1] : m_obstacleQuery;
+	}
 	
 public:
 	dtCrowd();
@@ -275,6 +291,15 @@ public:
 	///  @param[in]		maxCustomPatterns	The maximum number of custom sampling patterns
 	/// @return True if the initialization succeeded.
 	bool initAvoidance(const int maxNeighbors, const int maxWalls, const int maxCustomPatterns);
+
+	/// [UE4] Allocates additional avoidance queries, so agent ranges can be processed by updateStepAvoidanceRange
+	/// on separate threads. Must be called after initAvoidance, custom sampling patterns are shared by all queries.
+	///  @param[in]		numQueries	The total number of avoidance queries, including main one. [Limit: >= 1]
+	/// @return True if the initialization succeeded.
+	bool initParallelAvoidance(const int numQueries);
+
+	/// [UE4] Gets number of avoidance queries that can be used by updateStepAvoidanceRange
+	inline int getNumAvoidanceQueries() const { return m_obstacleQuery ? m_numParallelObstacleQueries + 1 : 0; }
 	
 	/// Sets the shared avoidance configuration for the specified index.
 	///  @param[in]		idx		The index. [Limits: 0 <= value < #DT_CROWD_MAX_OBSTAVOIDANCE_PARAMS]
@@ -393,6 +418,17 @@ public:
 	/// @param[in]		nagents	Number of active agents
 	void updateStepProximityData(const float dt, dtCrowdAgentDebugInfo* debug);
 
+	/// [UE4] Split proximity data update: proximity grid and collision boundaries
+	/// must be followed by updateStepNeighbours on all active agents
+	/// @param[in]		dt		Delta time in seconds
+	void updateStepBoundaries(const float dt, dtCrowdAgentDebugInfo* debug);
+
+	/// [UE4] Split proximity data update: neighbors of active agents from given range,
+	/// only reads proximity grid and can be called for separate ranges from different threads
+	/// @param[in]		startIdx	First active agent
+	/// @param[in]		endIdx		Last active agent + 1
+	void updateStepNeighbours(const int startIdx, const int endIdx);
+
 	/// [UE4] Split update into several smaller components: next corner for move, trigger offmesh links
 	/// @param[in]		dt		Delta time in seconds
 	/// @param[in]		nagents	Number of active agents
@@ -408,6 +444,17 @@ public:
 	/// @param[in]		nagents	Number of active agents
 	void updateStepAvoidance(const float dt, dtCrowdAgentDebugInfo* debug);
 
+	/// [UE4] Avoidance of active agents from given range, can be called for separate ranges
+	/// from different threads as long as each one uses different avoidance query
+	/// @param[in]		startIdx	First active agent
+	/// @param[in]		endIdx		Last active agent + 1
+	/// @param[in]		queryIdx	Avoidance query to use [Limits: 0 <= value < #getNumAvoidanceQueries()]
+	/// @return Number of velocity samples taken
+	int updateStepAvoidanceRange(const int startIdx, const int endIdx, const int queryIdx, dtCrowdAgentDebugInfo* debug);
+
+	/// [UE4] Sets velocity sample count after running updateStepAvoidanceRange instead of updateStepAvoidance
+	inline void setVelocitySampleCount(const int count) { m_velocitySampleCount = count; }
+
 	/// [UE4] Split update into several smaller components: integrate velocities and handle collisions
 	/// @param[in]		dt		Delta time in seconds
 	/// @param[in]		nagents	Number of active agents
@@ -12,6 +12,15 @@ DECLARE_CYCLE_STAT(TEXT("All Command List Execute"), STAT_ImmedCmdListExecuteTim
 DECLARE_DWORD_COUNTER_STAT(TEXT("Immed. Command List memory"), STAT_ImmedCmdListMemory, STATGROUP_RHICMDLIST);
 DECLARE_DWORD_COUNTER_STAT(TEXT("Immed. Command count"), STAT_ImmedCmdListCount, STATGROUP_RHICMDLIST);
 
+#if USE_RHICOMMAND_STATE_REDUCTION
+DECLARE_DWORD_COUNTER_STAT(TEXT("Filtered shader parameters"), STAT_RHICmdFilteredShaderParameters, STATGROUP_RHICMDLIST);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Filtered uniform buffers"), STAT_RHICmdFilteredUniformBuffers, STATGROUP_RHICMDLIST);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Filtered textures"), STAT_RHICmdFilteredTextures, STATGROUP_RHICMDLIST);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Filtered SRVs"), STAT_RHICmdFilteredSRVs, STATGROUP_RHICMDLIST);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Filtered samplers"), STAT_RHICmdFilteredSamplers, STATGROUP_RHICMDLIST);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Filtered bound shader states"), STAT_RHICmdFilteredBoundShaderStates, STATGROUP_RHICMDLIST);
+#endif
+
 #if PLATFORM_SUPPORTS_RHI_THREAD
 /***
 Requirements for RHI thread
@@ -40,6 +49,15 @@ static TAutoConsoleVariable<int32> CVarRHICmdUseParallelAlgorithms(
 	1,
 	TEXT("True to use parallel algorithms. Ignored if r.RHICmdBypass is 1."));
 
+#if USE_RHICOMMAND_STATE_REDUCTION
+static TAutoConsoleVariable<int32> CVarRHICmdStateReduction(
+	TEXT("r.RHICmdStateReduction"),
+	0,
+	TEXT("Whether command lists shadow the bound shader state, shader parameters, uniform buffers, textures, SRVs and samplers\n")
+	TEXT("and drop redundant set commands before they are enqueued. Takes effect the next time a command list is reset.\n")
+	TEXT("0: Disable, 1: Enable"));
+#endif
+
 TAutoConsoleVariable<int32> CVarRHICmdWidth(
 	TEXT("r.RHICmdWidth"), 
 	8,
@@ -481,6 +499,10 @@ void FRHICommandListExecutor::WaitOnRHIThreadFence(FGraphEventRef& Fence)
 
 FRHICommandListBase::FRHICommandListBase()
 	: MemManager(0)
+#if USE_RHICOMMAND_STATE_REDUCTION
+	, StateCache(nullptr) // Reset reports the stats of the previous state cache, there is none yet
+	, bUseStateCache(false)
+#endif
 {
 	GRHICommandList.OutstandingCmdListCount.Increment();
 	Reset();
@@ -499,6 +521,18 @@ const int32 FRHICommandListBase::GetUsedMemory() const
 
 void FRHICommandListBase::Reset()
 {
+#if USE_RHICOMMAND_STATE_REDUCTION
+	// the state cache lives in MemManager, so report it before the memory goes away
+	if (StateCache)
+	{
+		INC_DWORD_STAT_BY(STAT_RHICmdFilteredShaderParameters, StateCache->NumFilteredShaderParameters);
+		INC_DWORD_STAT_BY(STAT_RHICmdFilteredUniformBuffers, StateCache->NumFilteredUniformBuffers);
+		INC_DWORD_STAT_BY(STAT_RHICmdFilteredTextures, StateCache->NumFilteredTextures);
+		INC_DWORD_STAT_BY(STAT_RHICmdFilteredSRVs, StateCache->NumFilteredShaderResourceViews);
+		INC_DWORD_STAT_BY(STAT_RHICmdFilteredSamplers, StateCache->NumFilteredSamplers);
+		INC_DWORD_STAT_BY(STAT_RHICmdFilteredBoundShaderStates, StateCache->NumFilteredBoundShaderStates);
+	}
+#endif
 	bExecuting = false;
 	check(!RTTasks.Num());
 	MemManager.Flush();
@@ -513,10 +547,21 @@ void FRHICommandListBase::Reset()
 #endif
 #if USE_RHICOMMAND_STATE_REDUCTION
 	StateCache = nullptr;
+	bUseStateCache = CVarRHICmdStateReduction.GetValueOnAnyThread() > 0;
 #endif
 	UID = GRHICommandList.UIDCounter.Increment();
 }
 
+#if USE_RHICOMMAND_STATE_REDUCTION
+void FRHICommandListBase::FlushStateCache()
+{
+	if (StateCache)
+	{
+		StateCache->FlushAll();
+	}
+}
+#endif
+
 
 #if PLATFORM_SUPPORTS_PARALLEL_RHI_EXECUTE
 DECLARE_CYCLE_STAT(TEXT("Parallel Async Chain Translate"), STAT_ParallelChainTranslate, STATGROUP_RHICMDLIST);
@@ -653,6 +698,10 @@ struct FRHICommandWaitForAndSubmitSubList : public FRHICommand<FRHICommandWaitFo
 void FRHICommandListBase::QueueParallelAsyncCommandListSubmit(FGraphEventRef* AnyThreadCompletionEvents, FRHICommandList** CmdLists, int32 Num)
 {
 	check(IsInRenderingThread() && IsImmediate() && Num);
+#if USE_RHICOMMAND_STATE_REDUCTION
+	// the sublist will change the bound state when it executes
+	FlushStateCache();
+#endif
 	if (GRHIThread)
 	{
 		FRHICommandListExecutor::GetImmediateCommandList().ImmediateFlush(EImmediateFlushType::DispatchToRHIThread); // we should start on the stuff before this async list
@@ -741,6 +790,10 @@ void FRHICommandListBase::QueueParallelAsyncCommandListSubmit(FGraphEventRef* An
 void FRHICommandListBase::QueueAsyncCommandListSubmit(FGraphEventRef& AnyThreadCompletionEvent, class FRHICommandList* CmdList)
 {
 	check(IsInRenderingThread() && IsImmediate());
+#if USE_RHICOMMAND_STATE_REDUCTION
+	// the sublist will change the bound state when it executes
+	FlushStateCache();
+#endif
 	if (GRHIThread)
 	{
 		FRHICommandListExecutor::GetImmediateCommandList().ImmediateFlush(EImmediateFlushType::DispatchToRHIThread); // we should start on the stuff before this async list
@@ -807,6 +860,10 @@ struct FRHICommandWaitForAndSubmitRTSubList : public FRHICommand<FRHICommandWait
 void FRHICommandListBase::QueueRenderThreadCommandListSubmit(FGraphEventRef& RenderThreadCompletionEvent, class FRHICommandList* CmdList)
 {
 	check(!IsInRenderingThread() && !IsImmediate() && !IsInRHIThread());
+#if USE_RHICOMMAND_STATE_REDUCTION
+	// the sublist will change the bound state when it executes
+	FlushStateCache();
+#endif
 	RTTasks.Add(RenderThreadCompletionEvent);
 	new (AllocCommand<FRHICommandWaitForAndSubmitRTSubList>()) FRHICommandWaitForAndSubmitRTSubList(RenderThreadCompletionEvent, CmdList);
 }
@@ -829,6 +886,10 @@ struct FRHICommandSubmitSubList : public FRHICommand<FRHICommandSubmitSubList>
 
 void FRHICommandListBase::QueueCommandListSubmit(class FRHICommandList* CmdList)
 {
+#if USE_RHICOMMAND_STATE_REDUCTION
+	// the sublist will change the bound state when it executes
+	FlushStateCache();
+#endif
 	new (AllocCommand<FRHICommandSubmitSubList>()) FRHICommandSubmitSubList(CmdList);
 }
 
@@ -841,6 +902,9 @@ void FRHICommandList::BeginDrawingViewport(FViewportRHIParamRef Viewport, FTextu
 		CMD_CONTEXT(BeginDrawingViewport)(Viewport, RenderTargetRHI);
 		return;
 	}
+#if USE_RHICOMMAND_STATE_REDUCTION
+	FlushStateCache();
+#endif
 	new (AllocCommand<FRHICommandBeginDrawingViewport>()) FRHICommandBeginDrawingViewport(Viewport, RenderTargetRHI);
 }
 
@@ -853,6 +917,9 @@ void FRHICommandList::EndDrawingViewport(FViewportRHIParamRef Viewport, bool bPr
 	}
 	else
 	{
+#if USE_RHICOMMAND_STATE_REDUCTION
+		FlushStateCache();
+#endif
 		new (AllocCommand<FRHICommandEndDrawingViewport>()) FRHICommandEndDrawingViewport(Viewport, bPresent, bLockToVsync);
 		// this should be started asap
 		{
@@ -870,6 +937,9 @@ void FRHICommandList::BeginFrame()
 		CMD_CONTEXT(BeginFrame)();
 		return;
 	}
+#if USE_RHICOMMAND_STATE_REDUCTION
+	FlushStateCache();
+#endif
 	new (AllocCommand<FRHICommandBeginFrame>()) FRHICommandBeginFrame();
 }
 
@@ -880,6 +950,9 @@ void FRHICommandList::EndFrame()
 		CMD_CONTEXT(EndFrame)();
 		return;
 	}
+#if USE_RHICOMMAND_STATE_REDUCTION
+	FlushStateCache();
+#endif
 	new (AllocCommand<FRHICommandEndFrame>()) FRHICommandEndFrame();
 }
 
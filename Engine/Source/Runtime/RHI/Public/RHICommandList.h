@@ -10,7 +10,9 @@
 
 DECLARE_STATS_GROUP(TEXT("RHICmdList"), STATGROUP_RHICMDLIST, STATCAT_Advanced);
 
-#define USE_RHICOMMAND_STATE_REDUCTION (0)
+#ifndef USE_RHICOMMAND_STATE_REDUCTION
+	#define USE_RHICOMMAND_STATE_REDUCTION (1)
+#endif
 
 extern RHI_API TAutoConsoleVariable<int32> CVarRHICmdWidth;
 class FRHICommandListBase;
@@ -183,6 +185,11 @@ private:
 #if USE_RHICOMMAND_STATE_REDUCTION
 protected:
 	struct FRHICommandListStateCache* StateCache;
+	/** Latched from r.RHICmdStateReduction whenever the command list is reset */
+	bool bUseStateCache;
+
+	/** Forgets all shadowed state, e.g. when another command list has been submitted through this one. */
+	void FlushStateCache();
 private:
 #endif
 	FGraphEventArray RTTasks;
@@ -197,22 +204,124 @@ public:
 };
 
 #if USE_RHICOMMAND_STATE_REDUCTION
+/**
+ * Shadows the state bound through a command list so that redundant Set* calls can be dropped before they are enqueued.
+ * A null entry means "unknown", so the cache never filters a null binding.
+ * Only used when r.RHICmdStateReduction is enabled; allocated lazily from the command list memory.
+ */
 struct FRHICommandListStateCache
 {
 	// warning, no destructor is ever called for this struct
 
 	FRHICommandListStateCache()
+		: NumFilteredShaderParameters(0)
+		, NumFilteredUniformBuffers(0)
+		, NumFilteredTextures(0)
+		, NumFilteredShaderResourceViews(0)
+		, NumFilteredSamplers(0)
+		, NumFilteredBoundShaderStates(0)
 	{
-		FlushShaderState();
-		FlushSamplerState();
+		FlushAll();
 	}
 	enum 
 	{
 		MAX_SAMPLERS_PER_SHADER_STAGE = 32, // it is okish if this is too small, those buffers simply won't get state reduction
 		MAX_UNIFORM_BUFFERS_PER_SHADER_STAGE = 14, // it is okish if this is too small, those buffers simply won't get state reduction
+		MAX_TEXTURES_PER_SHADER_STAGE = 16, // it is okish if this is too small, those textures simply won't get state reduction
+		MAX_SRVS_PER_SHADER_STAGE = 16, // it is okish if this is too small, those views simply won't get state reduction
+		MAX_SHADER_PARAMETERS_PER_SHADER_STAGE = 16, // number of loose parameter writes remembered per stage, replaced round robin
 	};
+
+	/** A loose shader parameter write. Value points at the copy already held in the command list memory. */
+	struct FShaderParameterEntry
+	{
+		const void* Shader;
+		const void* Value;
+		uint32 BufferIndex;
+		uint32 BaseIndex;
+		uint32 NumBytes;
+	};
+
 	FSamplerStateRHIParamRef Samplers[SF_NumFrequencies][MAX_SAMPLERS_PER_SHADER_STAGE];
 	FUniformBufferRHIParamRef BoundUniformBuffers[SF_NumFrequencies][MAX_UNIFORM_BUFFERS_PER_SHADER_STAGE];
+	FTextureRHIParamRef Textures[SF_NumFrequencies][MAX_TEXTURES_PER_SHADER_STAGE];
+	FShaderResourceViewRHIParamRef ShaderResourceViews[SF_NumFrequencies][MAX_SRVS_PER_SHADER_STAGE];
+	FShaderParameterEntry ShaderParameters[SF_NumFrequencies][MAX_SHADER_PARAMETERS_PER_SHADER_STAGE];
+	uint32 NextShaderParameterEntry[SF_NumFrequencies];
+	FBoundShaderStateRHIParamRef BoundShaderState;
+
+	/** Number of commands dropped since the cache was allocated, reported to STATGROUP_RHICMDLIST when the command list is reset */
+	uint32 NumFilteredShaderParameters;
+	uint32 NumFilteredUniformBuffers;
+	uint32 NumFilteredTextures;
+	uint32 NumFilteredShaderResourceViews;
+	uint32 NumFilteredSamplers;
+	uint32 NumFilteredBoundShaderStates;
+
+	/** @return true if Value is already bound to Slots[Index] and the command can be skipped; otherwise records Value as the new binding */
+	template <typename TRHIParamRef, int32 NumSlots>
+	static FORCEINLINE bool FilterBinding(TRHIParamRef (&Slots)[NumSlots], uint32 Index, TRHIParamRef Value, uint32& NumFiltered)
+	{
+		if (Index >= NumSlots)
+		{
+			return false;
+		}
+		if (Value && Slots[Index] == Value)
+		{
+			NumFiltered++;
+			return true;
+		}
+		Slots[Index] = Value;
+		return false;
+	}
+
+	/**
+	 * Looks for an identical earlier write of a loose shader parameter.
+	 * @param OutEntryIndex - entry that should record the write if it is not filtered
+	 * @return true if the same bytes were already written to the same range of the same shader
+	 */
+	FORCEINLINE bool FilterShaderParameter(uint32 Frequency, const void* Shader, uint32 BufferIndex, uint32 BaseIndex, uint32 NumBytes, const void* NewValue, uint32& OutEntryIndex)
+	{
+		OutEntryIndex = MAX_SHADER_PARAMETERS_PER_SHADER_STAGE;
+		for (uint32 EntryIndex = 0; EntryIndex < MAX_SHADER_PARAMETERS_PER_SHADER_STAGE; EntryIndex++)
+		{
+			FShaderParameterEntry& Entry = ShaderParameters[Frequency][EntryIndex];
+			if (!Entry.Value || Entry.BufferIndex != BufferIndex)
+			{
+				continue;
+			}
+			if (Entry.Shader == Shader && Entry.BaseIndex == BaseIndex && Entry.NumBytes == NumBytes)
+			{
+				if (FMemory::Memcmp(Entry.Value, NewValue, NumBytes) == 0)
+				{
+					NumFilteredShaderParameters++;
+					return true;
+				}
+				OutEntryIndex = EntryIndex;
+			}
+			else if (Entry.BaseIndex < BaseIndex + NumBytes && BaseIndex < Entry.BaseIndex + Entry.NumBytes)
+			{
+				// a partially overlapping write makes the remembered value stale
+				Entry.Value = nullptr;
+			}
+		}
+		if (OutEntryIndex == MAX_SHADER_PARAMETERS_PER_SHADER_STAGE)
+		{
+			OutEntryIndex = NextShaderParameterEntry[Frequency];
+			NextShaderParameterEntry[Frequency] = (OutEntryIndex + 1) % MAX_SHADER_PARAMETERS_PER_SHADER_STAGE;
+		}
+		return false;
+	}
+
+	FORCEINLINE void RecordShaderParameter(uint32 Frequency, uint32 EntryIndex, const void* Shader, uint32 BufferIndex, uint32 BaseIndex, uint32 NumBytes, const void* Value)
+	{
+		FShaderParameterEntry& Entry = ShaderParameters[Frequency][EntryIndex];
+		Entry.Shader = Shader;
+		Entry.Value = Value;
+		Entry.BufferIndex = BufferIndex;
+		Entry.BaseIndex = BaseIndex;
+		Entry.NumBytes = NumBytes;
+	}
 
 	FORCEINLINE void FlushSamplerState()
 	{
@@ -225,16 +334,55 @@ struct FRHICommandListStateCache
 		}
 	}
 
+	/**
+	 * Forgets uniform buffers and loose parameters, which are only meaningful for the currently bound shaders.
+	 * Textures and SRVs go too: the RHI binds the resource tables of all uniform buffers again for new shaders.
+	 */
 	FORCEINLINE void FlushShaderState()
 	{
+		FlushResourceBindings();
 		for (int32 Index = 0; Index < SF_NumFrequencies; Index++)
 		{
 			for (int32 IndexInner = 0; IndexInner < MAX_UNIFORM_BUFFERS_PER_SHADER_STAGE; IndexInner++)
 			{
 				BoundUniformBuffers[Index][IndexInner] = nullptr;
 			}
+			for (int32 IndexInner = 0; IndexInner < MAX_SHADER_PARAMETERS_PER_SHADER_STAGE; IndexInner++)
+			{
+				ShaderParameters[Index][IndexInner].Value = nullptr;
+			}
+			NextShaderParameterEntry[Index] = 0;
 		}
 	}
+
+	/** Forgets the textures and SRVs of one stage; binding a uniform buffer may overwrite them with its resource table at the next draw. */
+	FORCEINLINE void FlushResourceBindings(uint32 Frequency)
+	{
+		for (int32 IndexInner = 0; IndexInner < MAX_TEXTURES_PER_SHADER_STAGE; IndexInner++)
+		{
+			Textures[Frequency][IndexInner] = nullptr;
+		}
+		for (int32 IndexInner = 0; IndexInner < MAX_SRVS_PER_SHADER_STAGE; IndexInner++)
+		{
+			ShaderResourceViews[Frequency][IndexInner] = nullptr;
+		}
+	}
+
+	/** Forgets textures and SRVs; the RHI may unbind them behind our back when render targets or UAVs change. */
+	FORCEINLINE void FlushResourceBindings()
+	{
+		for (int32 Index = 0; Index < SF_NumFrequencies; Index++)
+		{
+			FlushResourceBindings(Index);
+		}
+	}
+
+	FORCEINLINE void FlushAll()
+	{
+		BoundShaderState = nullptr;
+		FlushShaderState();
+		FlushSamplerState();
+	}
 };
 #endif
 
@@ -1174,14 +1322,14 @@ public:
 	void operator delete(void *RawMemory);
 
 #if USE_RHICOMMAND_STATE_REDUCTION
-	FORCEINLINE_DEBUGGABLE bool AllocStateCache()
+	/** @return the state cache of this command list, allocating it on first use, or nullptr if state reduction is disabled */
+	FORCEINLINE_DEBUGGABLE FRHICommandListStateCache* GetStateCache()
 	{
-		if (!StateCache)
+		if (!StateCache && bUseStateCache)
 		{
 			StateCache = new (Alloc<FRHICommandListStateCache>()) FRHICommandListStateCache();
-			return false;
 		}
-		return true;
+		return StateCache;
 	}
 #endif
 	FORCEINLINE_DEBUGGABLE FLocalBoundShaderState BuildLocalBoundShaderState(const FBoundShaderStateInput& BoundShaderStateInput)
@@ -1244,6 +1392,7 @@ public:
 #if USE_RHICOMMAND_STATE_REDUCTION
 		if (StateCache)
 		{
+			StateCache->BoundShaderState = nullptr;
 			StateCache->FlushShaderState();
 		}
 #endif
@@ -1278,11 +1427,15 @@ public:
 			return;
 		}
 #if USE_RHICOMMAND_STATE_REDUCTION
-		if (StateCache)
+		if (StateCache && BaseIndex < FRHICommandListStateCache::MAX_UNIFORM_BUFFERS_PER_SHADER_STAGE)
 		{
 			//local uniform buffers are rare, so we will just flush
 			StateCache->BoundUniformBuffers[TRHIShaderToEnum<TShaderRHIParamRef>::ShaderFrequency][BaseIndex] = nullptr;
 		}
+		if (StateCache)
+		{
+			StateCache->FlushResourceBindings(TRHIShaderToEnum<TShaderRHIParamRef>::ShaderFrequency);
+		}
 #endif
 		new (AllocCommand<FRHICommandSetLocalUniformBuffer<TShaderRHIParamRef> >()) FRHICommandSetLocalUniformBuffer<TShaderRHIParamRef>(this, Shader, BaseIndex, UniformBuffer);
 	}
@@ -1296,13 +1449,14 @@ public:
 			return;
 		}
 #if USE_RHICOMMAND_STATE_REDUCTION
-		if (BaseIndex < FRHICommandListStateCache::MAX_UNIFORM_BUFFERS_PER_SHADER_STAGE)
+		if (FRHICommandListStateCache* Cache = GetStateCache())
 		{
-			if (AllocStateCache() && StateCache->BoundUniformBuffers[TRHIShaderToEnum<TShaderRHI*>::ShaderFrequency][BaseIndex] == UniformBuffer)
+			if (Cache->FilterBinding(Cache->BoundUniformBuffers[TRHIShaderToEnum<TShaderRHI*>::ShaderFrequency], BaseIndex, UniformBuffer, Cache->NumFilteredUniformBuffers))
 			{
 				return;
 			}
-			StateCache->BoundUniformBuffers[TRHIShaderToEnum<TShaderRHI*>::ShaderFrequency][BaseIndex] = UniformBuffer;
+			// the resource table of the new uniform buffer is bound at the next draw, over loose textures and SRVs
+			Cache->FlushResourceBindings(TRHIShaderToEnum<TShaderRHI*>::ShaderFrequency);
 		}
 #endif
 		new (AllocCommand<FRHICommandSetShaderUniformBuffer<TShaderRHI*> >()) FRHICommandSetShaderUniformBuffer<TShaderRHI*>(Shader, BaseIndex, UniformBuffer);
@@ -1321,8 +1475,22 @@ public:
 			CMD_CONTEXT(SetShaderParameter)(Shader, BufferIndex, BaseIndex, NumBytes, NewValue);
 			return;
 		}
+#if USE_RHICOMMAND_STATE_REDUCTION
+		FRHICommandListStateCache* Cache = GetStateCache();
+		uint32 EntryIndex = 0;
+		if (Cache && Cache->FilterShaderParameter(TRHIShaderToEnum<TShaderRHI*>::ShaderFrequency, Shader, BufferIndex, BaseIndex, NumBytes, NewValue, EntryIndex))
+		{
+			return;
+		}
+#endif
 		void* UseValue = Alloc(NumBytes, 16);
 		FMemory::Memcpy(UseValue, NewValue, NumBytes);
+#if USE_RHICOMMAND_STATE_REDUCTION
+		if (Cache)
+		{
+			Cache->RecordShaderParameter(TRHIShaderToEnum<TShaderRHI*>::ShaderFrequency, EntryIndex, Shader, BufferIndex, BaseIndex, NumBytes, UseValue);
+		}
+#endif
 		new (AllocCommand<FRHICommandSetShaderParameter<TShaderRHI*> >()) FRHICommandSetShaderParameter<TShaderRHI*>(Shader, BufferIndex, BaseIndex, NumBytes, UseValue);
 	}
 	template <typename TShaderRHI>
@@ -1339,6 +1507,20 @@ public:
 			CMD_CONTEXT(SetShaderTexture)(Shader, TextureIndex, Texture);
 			return;
 		}
+#if USE_RHICOMMAND_STATE_REDUCTION
+		if (FRHICommandListStateCache* Cache = GetStateCache())
+		{
+			if (Cache->FilterBinding(Cache->Textures[TRHIShaderToEnum<TShaderRHIParamRef>::ShaderFrequency], TextureIndex, Texture, Cache->NumFilteredTextures))
+			{
+				return;
+			}
+			// textures and SRVs share resource slots on some RHIs
+			if (TextureIndex < FRHICommandListStateCache::MAX_SRVS_PER_SHADER_STAGE)
+			{
+				Cache->ShaderResourceViews[TRHIShaderToEnum<TShaderRHIParamRef>::ShaderFrequency][TextureIndex] = nullptr;
+			}
+		}
+#endif
 		new (AllocCommand<FRHICommandSetShaderTexture<TShaderRHIParamRef> >()) FRHICommandSetShaderTexture<TShaderRHIParamRef>(Shader, TextureIndex, Texture);
 	}
 
@@ -1350,6 +1532,19 @@ public:
 			CMD_CONTEXT(SetShaderResourceViewParameter)(Shader, SamplerIndex, SRV);
 			return;
 		}
+#if USE_RHICOMMAND_STATE_REDUCTION
+		if (FRHICommandListStateCache* Cache = GetStateCache())
+		{
+			if (Cache->FilterBinding(Cache->ShaderResourceViews[TRHIShaderToEnum<TShaderRHIParamRef>::ShaderFrequency], SamplerIndex, SRV, Cache->NumFilteredShaderResourceViews))
+			{
+				return;
+			}
+			if (SamplerIndex < FRHICommandListStateCache::MAX_TEXTURES_PER_SHADER_STAGE)
+			{
+				Cache->Textures[TRHIShaderToEnum<TShaderRHIParamRef>::ShaderFrequency][SamplerIndex] = nullptr;
+			}
+		}
+#endif
 		new (AllocCommand<FRHICommandSetShaderResourceViewParameter<TShaderRHIParamRef> >()) FRHICommandSetShaderResourceViewParameter<TShaderRHIParamRef>(Shader, SamplerIndex, SRV);
 	}
 
@@ -1362,13 +1557,12 @@ public:
 			return;
 		}
 #if USE_RHICOMMAND_STATE_REDUCTION
-		if (SamplerIndex < FRHICommandListStateCache::MAX_SAMPLERS_PER_SHADER_STAGE)
+		if (FRHICommandListStateCache* Cache = GetStateCache())
 		{
-			if (AllocStateCache() && StateCache->Samplers[TRHIShaderToEnum<TShaderRHIParamRef>::ShaderFrequency][SamplerIndex] == State)
+			if (Cache->FilterBinding(Cache->Samplers[TRHIShaderToEnum<TShaderRHIParamRef>::ShaderFrequency], SamplerIndex, State, Cache->NumFilteredSamplers))
 			{
 				return;
 			}
-			StateCache->Samplers[TRHIShaderToEnum<TShaderRHIParamRef>::ShaderFrequency][SamplerIndex] = State;
 		}
 #endif
 		new (AllocCommand<FRHICommandSetShaderSampler<TShaderRHIParamRef> >()) FRHICommandSetShaderSampler<TShaderRHIParamRef>(Shader, SamplerIndex, State);
@@ -1381,6 +1575,12 @@ public:
 			CMD_CONTEXT(SetUAVParameter)(Shader, UAVIndex, UAV);
 			return;
 		}
+#if USE_RHICOMMAND_STATE_REDUCTION
+		if (StateCache)
+		{
+			StateCache->FlushResourceBindings();
+		}
+#endif
 		new (AllocCommand<FRHICommandSetUAVParameter<FComputeShaderRHIParamRef> >()) FRHICommandSetUAVParameter<FComputeShaderRHIParamRef>(Shader, UAVIndex, UAV);
 	}
 
@@ -1391,6 +1591,12 @@ public:
 			CMD_CONTEXT(SetUAVParameter)(Shader, UAVIndex, UAV, InitialCount);
 			return;
 		}
+#if USE_RHICOMMAND_STATE_REDUCTION
+		if (StateCache)
+		{
+			StateCache->FlushResourceBindings();
+		}
+#endif
 		new (AllocCommand<FRHICommandSetUAVParameter_IntialCount<FComputeShaderRHIParamRef> >()) FRHICommandSetUAVParameter_IntialCount<FComputeShaderRHIParamRef>(Shader, UAVIndex, UAV, InitialCount);
 	}
 
@@ -1402,9 +1608,15 @@ public:
 			return;
 		}
 #if USE_RHICOMMAND_STATE_REDUCTION
-		if (StateCache)
+		if (FRHICommandListStateCache* Cache = GetStateCache())
 		{
-			StateCache->FlushShaderState();
+			if (BoundShaderState && Cache->BoundShaderState == BoundShaderState)
+			{
+				Cache->NumFilteredBoundShaderStates++;
+				return;
+			}
+			Cache->BoundShaderState = BoundShaderState;
+			Cache->FlushShaderState();
 		}
 #endif
 		new (AllocCommand<FRHICommandSetBoundShaderState>()) FRHICommandSetBoundShaderState(BoundShaderState);
@@ -1508,6 +1720,12 @@ public:
 				UAVs);
 			return;
 		}
+#if USE_RHICOMMAND_STATE_REDUCTION
+		if (StateCache)
+		{
+			StateCache->FlushAll();
+		}
+#endif
 		new (AllocCommand<FRHICommandSetRenderTargets>()) FRHICommandSetRenderTargets(
 			NewNumSimultaneousRenderTargets,
 			NewRenderTargetsRHI,
@@ -1523,6 +1741,12 @@ public:
 			CMD_CONTEXT(SetRenderTargetsAndClear)(RenderTargetsInfo);
 			return;
 		}
+#if USE_RHICOMMAND_STATE_REDUCTION
+		if (StateCache)
+		{
+			StateCache->FlushAll();
+		}
+#endif
 		new (AllocCommand<FRHICommandSetRenderTargetsAndClear>()) FRHICommandSetRenderTargetsAndClear(RenderTargetsInfo);
 	}
 
@@ -1609,6 +1833,7 @@ public:
 #if USE_RHICOMMAND_STATE_REDUCTION
 		if (StateCache)
 		{
+			StateCache->BoundShaderState = nullptr;
 			StateCache->FlushShaderState();
 		}
 #endif
@@ -1702,6 +1927,12 @@ public:
 			CMD_CONTEXT(ClearUAV)(UnorderedAccessViewRHI, Values);
 			return;
 		}
+#if USE_RHICOMMAND_STATE_REDUCTION
+		if (StateCache)
+		{
+			StateCache->FlushResourceBindings();
+		}
+#endif
 		new (AllocCommand<FRHICommandClearUAV>()) FRHICommandClearUAV(UnorderedAccessViewRHI, Values);
 	}
 
@@ -1712,6 +1943,12 @@ public:
 			CMD_CONTEXT(CopyToResolveTarget)(SourceTextureRHI, DestTextureRHI, bKeepOriginalSurface, ResolveParams);
 			return;
 		}
+#if USE_RHICOMMAND_STATE_REDUCTION
+		if (StateCache)
+		{
+			StateCache->FlushAll();
+		}
+#endif
 		new (AllocCommand<FRHICommandCopyToResolveTarget>()) FRHICommandCopyToResolveTarget(SourceTextureRHI, DestTextureRHI, bKeepOriginalSurface, ResolveParams);
 	}
 
@@ -1786,6 +2023,12 @@ public:
 			CMD_CONTEXT(BeginScene)();
 			return;
 		}
+#if USE_RHICOMMAND_STATE_REDUCTION
+		if (StateCache)
+		{
+			StateCache->FlushAll();
+		}
+#endif
 		new (AllocCommand<FRHICommandBeginScene>()) FRHICommandBeginScene();
 	}
 	FORCEINLINE_DEBUGGABLE void EndScene()
@@ -1795,6 +2038,12 @@ public:
 			CMD_CONTEXT(EndScene)();
 			return;
 		}
+#if USE_RHICOMMAND_STATE_REDUCTION
+		if (StateCache)
+		{
+			StateCache->FlushAll();
+		}
+#endif
 		new (AllocCommand<FRHICommandEndScene>()) FRHICommandEndScene();
 	}
 	void BeginDrawingViewport(FViewportRHIParamRef Viewport, FTextureRHIParamRef RenderTargetRHI);
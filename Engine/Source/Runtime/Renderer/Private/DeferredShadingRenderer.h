@@ -129,8 +129,9 @@ private:
 	/**
 	* Creates a projected shadow for all primitives affected by a light.
 	* @param LightSceneInfo - The light to create a shadow for.
+	* @param OutShadowsThatNeedSubjects - Receives the created shadows whose subjects must be added with GatherWholeSceneShadowSubjects.
 	*/
-	void CreateWholeSceneProjectedShadow(FLightSceneInfo* LightSceneInfo);
+	void CreateWholeSceneProjectedShadow(FLightSceneInfo* LightSceneInfo, TArray<FProjectedShadowInfo*, SceneRenderingAllocator>& OutShadowsThatNeedSubjects);
 
 	/** Updates the preshadow cache, allocating new preshadows that can fit and evicting old ones. */
 	void UpdatePreshadowCache();
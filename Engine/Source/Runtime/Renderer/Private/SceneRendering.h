@@ -626,6 +626,12 @@ protected:
 	/** Returns whether a per object shadow should be created due to the light being a stationary light. */
 	bool ShouldCreateObjectShadowForStationaryLight(const FLightSceneInfo* LightSceneInfo, const FPrimitiveSceneProxy* PrimitiveSceneProxy, bool bInteractionShadowMapped) const;
 
+	/** 
+	* Adds the shadow casting primitives affected by each light to its whole scene shadow.
+	* Culling runs as one task graph job per shadow, the results are added to the shadows in order on the rendering thread.
+	*/
+	void GatherWholeSceneShadowSubjects(const TArray<FProjectedShadowInfo*, SceneRenderingAllocator>& WholeSceneShadows, bool bStaticSceneOnly);
+
 	/** Gathers the list of primitives used to draw various shadow types */
 	void GatherShadowPrimitives(
 		const TArray<FProjectedShadowInfo*, SceneRenderingAllocator>& PreShadows,
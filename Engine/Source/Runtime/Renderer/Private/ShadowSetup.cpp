@@ -1523,7 +1523,7 @@ void FDeferredShadingSceneRenderer::CreatePerObjectProjectedShadow(
  * @param LightSceneInfo - The light to create a shadow for.
  * @return true if a whole scene shadow was created
  */
-void FDeferredShadingSceneRenderer::CreateWholeSceneProjectedShadow(FLightSceneInfo* LightSceneInfo)
+void FDeferredShadingSceneRenderer::CreateWholeSceneProjectedShadow(FLightSceneInfo* LightSceneInfo, TArray<FProjectedShadowInfo*, SceneRenderingAllocator>& OutShadowsThatNeedSubjects)
 {
 	SCOPE_CYCLE_COUNTER(STAT_CreateWholeSceneProjectedShadow);
 	FVisibleLightInfo& VisibleLightInfo = VisibleLightInfos[LightSceneInfo->Id];
@@ -1548,7 +1548,6 @@ void FDeferredShadingSceneRenderer::CreateWholeSceneProjectedShadow(FLightSceneI
 		float MaxUnclampedResolution = 0;
 		TArray<float, TInlineAllocator<2> > FadeAlphas;
 		float MaxFadeAlpha = 0;
-		bool bStaticSceneOnly = false;
 
 		for(int32 ViewIndex = 0;ViewIndex < Views.Num();ViewIndex++)
 		{
@@ -1572,8 +1571,6 @@ void FDeferredShadingSceneRenderer::CreateWholeSceneProjectedShadow(FLightSceneI
 					)
 				);
 
-			bStaticSceneOnly = bStaticSceneOnly || View.bStaticSceneOnly;
-
 			const float FadeAlpha = CalculateShadowFadeAlpha( MaxUnclampedResolution, ShadowFadeResolution, MinShadowResolution );
 			MaxFadeAlpha = FMath::Max(MaxFadeAlpha, FadeAlpha);
 			FadeAlphas.Add(FadeAlpha);
@@ -1653,23 +1650,165 @@ void FDeferredShadingSceneRenderer::CreateWholeSceneProjectedShadow(FLightSceneI
 				// Ray traced shadows use the GPU managed distance field object buffers, no CPU culling should be used
 				if (!ProjectedShadowInfo->bRayTracedDistanceFieldShadow)
 				{
-					// Add all the shadow casting primitives affected by the light to the shadow's subject primitive list.
-					for(FLightPrimitiveInteraction* Interaction = LightSceneInfo->DynamicPrimitiveList;
-						Interaction;
-						Interaction = Interaction->GetNextPrimitive())
-					{
-						if (Interaction->HasShadow() 
-							// If the primitive only wants to cast a self shadow don't include it in whole scene shadows.
-							&& !Interaction->CastsSelfShadowOnly()
-							&& (!bStaticSceneOnly || Interaction->GetPrimitiveSceneInfo()->Proxy->HasStaticLighting()))
-						{
-							ProjectedShadowInfo->AddSubjectPrimitive(Interaction->GetPrimitiveSceneInfo(), &Views);
-						}
-					}
+					// The shadow casting primitives affected by the light are added by GatherWholeSceneShadowSubjects once all lights have been set up.
+					OutShadowsThatNeedSubjects.Add(ProjectedShadowInfo);
+				}
+			}
+		}
+	}
+}
+
+static TAutoConsoleVariable<int32> CVarParallelShadowSetup(
+	TEXT("r.ParallelShadowSetup"),
+	1,
+	TEXT("Toggles culling the subjects of whole scene point and spot light shadows on task graph workers, one job per shadow."),
+	ECVF_RenderThreadSafe
+	);
+
+DECLARE_CYCLE_STAT(TEXT("Gather WholeScene Shadow Subjects"), STAT_GatherWholeSceneShadowSubjects, STATGROUP_InitViews);
+DECLARE_CYCLE_STAT(TEXT("Cull WholeScene Shadow Subjects"), STAT_CullWholeSceneShadowSubjects, STATGROUP_InitViews);
+DECLARE_CYCLE_STAT(TEXT("Wait for WholeScene Shadow Subjects"), STAT_GatherWholeSceneShadowSubjects_Wait, STATGROUP_InitViews);
+
+/** 
+ * Subjects of one whole scene shadow. 
+ * AnyThreadTask only reads the scene and writes into this packet's own array, 
+ * RenderThreadFinalize adds the surviving primitives to the shadow since that touches per view state shared by all shadows.
+ */
+class FGatherWholeSceneShadowSubjectsPacket
+{
+public:
+
+	FGatherWholeSceneShadowSubjectsPacket(FProjectedShadowInfo& InProjectedShadowInfo, TArray<FViewInfo>& InViews, bool bInStaticSceneOnly)
+		: ProjectedShadowInfo(InProjectedShadowInfo)
+		, Views(InViews)
+		, bStaticSceneOnly(bInStaticSceneOnly)
+	{
+	}
+
+	void AnyThreadTask()
+	{
+		SCOPE_CYCLE_COUNTER(STAT_CullWholeSceneShadowSubjects);
+
+		const FSphere& ShadowBounds = ProjectedShadowInfo.ShadowBounds;
+
+		for (FLightPrimitiveInteraction* Interaction = ProjectedShadowInfo.LightSceneInfo->DynamicPrimitiveList;
+			Interaction;
+			Interaction = Interaction->GetNextPrimitive())
+		{
+			FPrimitiveSceneInfo* PrimitiveSceneInfo = Interaction->GetPrimitiveSceneInfo();
+
+			if (Interaction->HasShadow() 
+				// If the primitive only wants to cast a self shadow don't include it in whole scene shadows.
+				&& !Interaction->CastsSelfShadowOnly()
+				&& (!bStaticSceneOnly || PrimitiveSceneInfo->Proxy->HasStaticLighting()))
+			{
+				const FBoxSphereBounds& PrimitiveBounds = PrimitiveSceneInfo->Proxy->GetBounds();
+
+				// The cube faces of a one pass point light shadow cover the whole sphere, otherwise only casters in the shadow frustum matter
+				const bool bInFrustum = ProjectedShadowInfo.bOnePassPointLightShadow
+					? (PrimitiveBounds.Origin - ShadowBounds.Center).SizeSquared() <= FMath::Square(ShadowBounds.W + PrimitiveBounds.SphereRadius)
+					: ProjectedShadowInfo.CasterFrustum.IntersectBox(PrimitiveBounds.Origin + ProjectedShadowInfo.PreShadowTranslation, PrimitiveBounds.BoxExtent);
+
+				if (bInFrustum)
+				{
+					Subjects.Add(PrimitiveSceneInfo);
 				}
 			}
 		}
 	}
+
+	void RenderThreadFinalize()
+	{
+		for (int32 SubjectIndex = 0; SubjectIndex < Subjects.Num(); SubjectIndex++)
+		{
+			ProjectedShadowInfo.AddSubjectPrimitive(Subjects[SubjectIndex], &Views);
+		}
+	}
+
+private:
+
+	FProjectedShadowInfo& ProjectedShadowInfo;
+	TArray<FViewInfo>& Views;
+	bool bStaticSceneOnly;
+
+	/** Heap allocated rather than SceneRenderingAllocator, since FMemStack is per thread. */
+	TArray<FPrimitiveSceneInfo*> Subjects;
+};
+
+class FGatherWholeSceneShadowSubjectsAnyThreadTask
+{
+	FGatherWholeSceneShadowSubjectsPacket& Packet;
+public:
+
+	FGatherWholeSceneShadowSubjectsAnyThreadTask(FGatherWholeSceneShadowSubjectsPacket& InPacket)
+		: Packet(InPacket)
+	{
+	}
+
+	FORCEINLINE TStatId GetStatId() const
+	{
+		RETURN_QUICK_DECLARE_CYCLE_STAT(FGatherWholeSceneShadowSubjectsAnyThreadTask, STATGROUP_TaskGraphTasks);
+	}
+
+	ENamedThreads::Type GetDesiredThread()
+	{
+		return ENamedThreads::AnyThread;
+	}
+
+	static ESubsequentsMode::Type GetSubsequentsMode() { return ESubsequentsMode::TrackSubsequents; }
+
+	void DoTask(ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+	{
+		Packet.AnyThreadTask();
+	}
+};
+
+void FSceneRenderer::GatherWholeSceneShadowSubjects(const TArray<FProjectedShadowInfo*, SceneRenderingAllocator>& WholeSceneShadows, bool bStaticSceneOnly)
+{
+	SCOPE_CYCLE_COUNTER(STAT_GatherWholeSceneShadowSubjects);
+
+	if (WholeSceneShadows.Num() == 0)
+	{
+		return;
+	}
+
+	// Reserved up front, the tasks hold references into this array
+	TArray<FGatherWholeSceneShadowSubjectsPacket> Packets;
+	Packets.Reserve(WholeSceneShadows.Num());
+
+	for (int32 ShadowIndex = 0; ShadowIndex < WholeSceneShadows.Num(); ShadowIndex++)
+	{
+		new(Packets) FGatherWholeSceneShadowSubjectsPacket(*WholeSceneShadows[ShadowIndex], Views, bStaticSceneOnly);
+	}
+
+	if (Packets.Num() > 1 && FApp::ShouldUseThreadingForPerformance() && CVarParallelShadowSetup.GetValueOnRenderThread() > 0)
+	{
+		FGraphEventArray CullEvents;
+
+		for (int32 PacketIndex = 1; PacketIndex < Packets.Num(); PacketIndex++)
+		{
+			CullEvents.Add(TGraphTask<FGatherWholeSceneShadowSubjectsAnyThreadTask>::CreateTask(nullptr, ENamedThreads::RenderThread).ConstructAndDispatchWhenReady(Packets[PacketIndex]));
+		}
+
+		// put the render thread to work on the first shadow while the workers cull the rest
+		Packets[0].AnyThreadTask();
+
+		SCOPE_CYCLE_COUNTER(STAT_GatherWholeSceneShadowSubjects_Wait);
+		FTaskGraphInterface::Get().WaitUntilTasksComplete(CullEvents, ENamedThreads::RenderThread_Local);
+	}
+	else
+	{
+		for (int32 PacketIndex = 0; PacketIndex < Packets.Num(); PacketIndex++)
+		{
+			Packets[PacketIndex].AnyThreadTask();
+		}
+	}
+
+	// Merge in shadow order so the result does not depend on task scheduling
+	for (int32 PacketIndex = 0; PacketIndex < Packets.Num(); PacketIndex++)
+	{
+		Packets[PacketIndex].RenderThreadFinalize();
+	}
 }
 
 void FSceneRenderer::InitProjectedShadowVisibility(FRHICommandListImmediate& RHICmdList)
@@ -2243,6 +2382,7 @@ void FDeferredShadingSceneRenderer::InitDynamicShadows(FRHICommandListImmediate&
 	TArray<FProjectedShadowInfo*,SceneRenderingAllocator> PreShadows;
 	TArray<FProjectedShadowInfo*,SceneRenderingAllocator> ViewDependentWholeSceneShadows;
 	TArray<FProjectedShadowInfo*,SceneRenderingAllocator> ViewDependentWholeSceneShadowsThatNeedCulling;
+	TArray<FProjectedShadowInfo*,SceneRenderingAllocator> WholeSceneShadowsThatNeedSubjects;
 	{
 		SCOPE_CYCLE_COUNTER(STAT_InitDynamicShadowsTime);
 
@@ -2300,7 +2440,7 @@ void FDeferredShadingSceneRenderer::InitDynamicShadows(FRHICommandListImmediate&
 					if (bCreateShadowForMovableLight || bCreateShadowToPreviewStaticLight || bCreateShadowForOverflowStaticShadowing)
 					{
 						// Try to create a whole scene projected shadow.
-						CreateWholeSceneProjectedShadow(LightSceneInfo);
+						CreateWholeSceneProjectedShadow(LightSceneInfo, WholeSceneShadowsThatNeedSubjects);
 					}
 
 					// Allow movable and stationary lights to create CSM, or static lights that are unbuilt
@@ -2321,6 +2461,9 @@ void FDeferredShadingSceneRenderer::InitDynamicShadows(FRHICommandListImmediate&
 			}
 		}
 
+		// Cull the subjects of the point and spot light whole scene shadows created above, one job per shadow.
+		GatherWholeSceneShadowSubjects(WholeSceneShadowsThatNeedSubjects, bStaticSceneOnly);
+
 		// Calculate visibility of the projected shadows.
 		InitProjectedShadowVisibility(RHICmdList);
 	}
@@ -328,11 +328,12 @@ void FShaderResource::Register()
 
 void FShaderResource::Serialize(FArchive& Ar)
 {
+	// The code is serialized last, so that FindOrLoadShaderResource can skip over it when the resource is already in memory
 	Ar << Target;
-	Ar << Code;
 	Ar << OutputHash;
 	Ar << NumInstructions;
 	Ar << NumTextureSamplers;
+	Ar << Code;
 	
 	if (Ar.IsLoading())
 	{
@@ -382,6 +383,88 @@ FShaderResource* FShaderResource::FindOrCreateShaderResource(const FShaderCompil
 	return Resource;
 }
 
+FShaderResource* FShaderResource::FindOrLoadShaderResource(FArchive& Ar)
+{
+	check(Ar.IsLoading());
+
+	// Matches the order of FShaderResource::Serialize
+	FShaderResourceId ResourceId;
+	uint32 LoadedNumInstructions = 0;
+	uint32 LoadedNumTextureSamplers = 0;
+	Ar << ResourceId.Target;
+	Ar << ResourceId.OutputHash;
+	Ar << LoadedNumInstructions;
+	Ar << LoadedNumTextureSamplers;
+
+	FShaderResource* Resource = FindShaderResourceById(ResourceId);
+
+	if (Resource)
+	{
+		// Reuse the resource in memory and skip over the code
+		int32 CodeSize = 0;
+		Ar << CodeSize;
+		Ar.Seek(Ar.Tell() + CodeSize);
+		INC_DWORD_STAT_BY(STAT_Shaders_NumShaderResourcesReused, 1);
+	}
+	else
+	{
+		Resource = new FShaderResource();
+		Resource->Target = ResourceId.Target;
+		Resource->OutputHash = ResourceId.OutputHash;
+		Resource->NumInstructions = LoadedNumInstructions;
+		Resource->NumTextureSamplers = LoadedNumTextureSamplers;
+		Ar << Resource->Code;
+
+		INC_DWORD_STAT_BY_FName(GetMemoryStatType((EShaderFrequency)Resource->Target.Frequency).GetName(), (int64)Resource->Code.Num());
+		INC_DWORD_STAT_BY(STAT_Shaders_ShaderResourceMemory, Resource->GetSizeBytes());
+
+		// Register the newly loaded shader resource so it can be reused by other shaders
+		Resource->Register();
+	}
+
+	return Resource;
+}
+
+/** Sorts shader resources by id, so that saving them gives the same binary result every time. */
+struct FCompareShaderResources
+{
+	FORCEINLINE bool operator()(const TRefCountPtr<FShaderResource>& A, const TRefCountPtr<FShaderResource>& B) const
+	{
+		const FShaderResourceId IdA = A->GetId();
+		const FShaderResourceId IdB = B->GetId();
+		const int32 HashCompare = FMemory::Memcmp(IdA.OutputHash.Hash, IdB.OutputHash.Hash, sizeof(IdA.OutputHash.Hash));
+		return HashCompare != 0 ? HashCompare < 0 : IdA.Target.Frequency < IdB.Target.Frequency;
+	}
+};
+
+void FShaderResource::SerializeShaderResources(FArchive& Ar, TArray<TRefCountPtr<FShaderResource> >& Resources)
+{
+	if (Ar.IsSaving())
+	{
+		Resources.Sort(FCompareShaderResources());
+	}
+
+	int32 NumResources = Resources.Num();
+	Ar << NumResources;
+
+	if (Ar.IsLoading())
+	{
+		Resources.Empty(NumResources);
+
+		for (int32 ResourceIndex = 0; ResourceIndex < NumResources; ResourceIndex++)
+		{
+			Resources.Add(FindOrLoadShaderResource(Ar));
+		}
+	}
+	else
+	{
+		for (int32 ResourceIndex = 0; ResourceIndex < NumResources; ResourceIndex++)
+		{
+			Resources[ResourceIndex]->Serialize(Ar);
+		}
+	}
+}
+
 void FShaderResource::GetAllShaderResourceId(TArray<FShaderResourceId>& Ids)
 {
 	ShaderResourceIdMap.GetKeys(Ids);
@@ -826,25 +909,8 @@ bool FShader::SerializeBase(FArchive& Ar, bool bShadersInline)
 
 		if (Ar.IsLoading())
 		{
-			// Load the inlined shader resource
-			FShaderResource* ShaderResource = new FShaderResource();
-			ShaderResource->Serialize(Ar);
-
-			FShaderResource* ExistingResource = FShaderResource::FindShaderResourceById(ShaderResource->GetId());
-
-			// Reuse an existing shader resource if a matching one already exists in memory
-			if (ExistingResource)
-			{
-				delete ShaderResource;
-				ShaderResource = ExistingResource;
-			}
-			else
-			{
-				// Register the newly loaded shader resource so it can be reused by other shaders
-				ShaderResource->Register();
-			}
-			
-			SetResource(ShaderResource);
+			// Load the inlined shader resource, reusing an existing shader resource if a matching one already exists in memory
+			SetResource(FShaderResource::FindOrLoadShaderResource(Ar));
 		}
 	}
 	else
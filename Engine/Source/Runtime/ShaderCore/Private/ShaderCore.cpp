@@ -73,6 +73,10 @@ DEFINE_STAT(STAT_ShaderCompiling_RHI);
 DEFINE_STAT(STAT_ShaderCompiling_HashingShaderFiles);
 DEFINE_STAT(STAT_ShaderCompiling_LoadingShaderFiles);
 DEFINE_STAT(STAT_ShaderCompiling_HLSLTranslation);
+DEFINE_STAT(STAT_ShaderCompiling_Preprocessing);
+DEFINE_STAT(STAT_ShaderCompiling_PreprocessingSaved);
+DEFINE_STAT(STAT_ShaderCompiling_NumPreprocessCacheHits);
+DEFINE_STAT(STAT_ShaderCompiling_NumPreprocessCacheMisses);
 DEFINE_STAT(STAT_ShaderCompiling_DDCLoading);
 DEFINE_STAT(STAT_ShaderCompiling_MaterialLoading);
 DEFINE_STAT(STAT_ShaderCompiling_MaterialCompiling);
@@ -90,6 +94,7 @@ DEFINE_STAT(STAT_ShaderCompiling_NumMaskedMaterialShaders);
 
 DEFINE_STAT(STAT_Shaders_NumShadersLoaded);
 DEFINE_STAT(STAT_Shaders_NumShaderResourcesLoaded);
+DEFINE_STAT(STAT_Shaders_NumShaderResourcesReused);
 DEFINE_STAT(STAT_Shaders_NumShaderMaps);
 DEFINE_STAT(STAT_Shaders_RTShaderLoadTime);
 DEFINE_STAT(STAT_Shaders_NumShadersUsedForRendering);
@@ -178,6 +183,21 @@ void FShaderCompilerOutput::GenerateOutputHash()
 	HashState.GetHash(&OutputHash.Hash[0]);
 }
 
+void FShaderCompilerOutput::UpdatePreprocessStats() const
+{
+	if (bPreprocessCacheHit)
+	{
+		INC_DWORD_STAT(STAT_ShaderCompiling_NumPreprocessCacheHits);
+		INC_FLOAT_STAT_BY(STAT_ShaderCompiling_PreprocessingSaved, PreprocessTime);
+	}
+	else if (PreprocessTime > 0)
+	{
+		// Shader formats that don't go through the preprocessor leave the time at 0
+		INC_DWORD_STAT(STAT_ShaderCompiling_NumPreprocessCacheMisses);
+		INC_FLOAT_STAT_BY(STAT_ShaderCompiling_Preprocessing, PreprocessTime);
+	}
+}
+
 
 /**
 * Add a new entry to the list of shader source files
@@ -142,6 +142,18 @@ public:
 	/** Finds a matching shader resource in memory or creates a new one with the given compiler output. */
 	SHADERCORE_API static FShaderResource* FindOrCreateShaderResource(const FShaderCompilerOutput& Output);
 
+	/** 
+	 * Finds a matching shader resource in memory or loads a new one from the archive. 
+	 * The code of resources which are already in memory is skipped over instead of being loaded again.
+	 */
+	SHADERCORE_API static FShaderResource* FindOrLoadShaderResource(FArchive& Ar);
+
+	/** 
+	 * Serializes a list of shader resources, so that resources used by several shaders are only stored once.
+	 * The shaders themselves can then be serialized without inlining their resources, as long as Resources is kept alive while they are loaded.
+	 */
+	SHADERCORE_API static void SerializeShaderResources(FArchive& Ar, TArray<TRefCountPtr<FShaderResource> >& Resources);
+
 	/** Return a list of all shader Ids currently known */
 	SHADERCORE_API static void GetAllShaderResourceId(TArray<FShaderResourceId>& Ids);
 
@@ -502,6 +514,11 @@ public:
 		return Resource->GetId();
 	}
 
+	FShaderResource* GetResource() const
+	{
+		return Resource;
+	}
+
 	uint32 GetSizeBytes() const
 	{
 		return GetTypeSize() + GetAllocatedSize();
@@ -973,6 +990,18 @@ public:
 		}
 	}
 
+	/** Adds the resources used by the shaders in this map to OutResources, skipping the ones already in the list. */
+	void GetShaderResources(TArray<TRefCountPtr<FShaderResource> >& OutResources) const
+	{
+		for (TMap<FShaderType*,TRefCountPtr<FShader> >::TConstIterator ShaderIt(Shaders);ShaderIt;++ShaderIt)
+		{
+			if (ShaderIt.Value())
+			{
+				OutResources.AddUnique(ShaderIt.Value()->GetResource());
+			}
+		}
+	}
+
 	uint32 GetMaxTextureSamplersShaderMap() const
 	{
 		uint32 MaxTextureSamplers = 0;
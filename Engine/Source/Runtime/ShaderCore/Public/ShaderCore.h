@@ -27,6 +27,10 @@ DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(TEXT("RHI Compile Time"),STAT_ShaderCompil
 DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(TEXT("Loading Shader Files"),STAT_ShaderCompiling_LoadingShaderFiles,STATGROUP_ShaderCompiling, SHADERCORE_API);
 DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(TEXT("CRCing Shader Files"),STAT_ShaderCompiling_HashingShaderFiles,STATGROUP_ShaderCompiling, SHADERCORE_API);
 DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(TEXT("HLSL Translation"),STAT_ShaderCompiling_HLSLTranslation,STATGROUP_ShaderCompiling, SHADERCORE_API);
+DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(TEXT("Preprocessing"),STAT_ShaderCompiling_Preprocessing,STATGROUP_ShaderCompiling, SHADERCORE_API);
+DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(TEXT("Preprocessing Saved By Cache"),STAT_ShaderCompiling_PreprocessingSaved,STATGROUP_ShaderCompiling, SHADERCORE_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Num Preprocess Cache Hits"),STAT_ShaderCompiling_NumPreprocessCacheHits,STATGROUP_ShaderCompiling, SHADERCORE_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Num Preprocess Cache Misses"),STAT_ShaderCompiling_NumPreprocessCacheMisses,STATGROUP_ShaderCompiling, SHADERCORE_API);
 DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(TEXT("DDC Loading"),STAT_ShaderCompiling_DDCLoading,STATGROUP_ShaderCompiling, SHADERCORE_API);
 DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(TEXT("Material Loading"),STAT_ShaderCompiling_MaterialLoading,STATGROUP_ShaderCompiling, SHADERCORE_API);
 DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(TEXT("Material Compiling"),STAT_ShaderCompiling_MaterialCompiling,STATGROUP_ShaderCompiling, SHADERCORE_API);
@@ -42,6 +46,7 @@ DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Num Masked Material Shaders"),STAT_S
 
 DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Num Shaders Loaded"),STAT_Shaders_NumShadersLoaded,STATGROUP_Shaders, SHADERCORE_API);
 DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Num Shader Resources Loaded"),STAT_Shaders_NumShaderResourcesLoaded,STATGROUP_Shaders, SHADERCORE_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Num Shader Resources Reused On Load"),STAT_Shaders_NumShaderResourcesReused,STATGROUP_Shaders, SHADERCORE_API);
 DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Num Shader Maps Registered"),STAT_Shaders_NumShaderMaps,STATGROUP_Shaders, SHADERCORE_API);
 DECLARE_CYCLE_STAT_EXTERN(TEXT("RT Shader Load Time"),STAT_Shaders_RTShaderLoadTime,STATGROUP_Shaders, SHADERCORE_API);
 DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Num Shaders Used"),STAT_Shaders_NumShadersUsedForRendering,STATGROUP_Shaders, SHADERCORE_API);
@@ -494,6 +499,8 @@ struct FShaderCompilerOutput
 	:	NumInstructions(0)
 	,	NumTextureSamplers(0)
 	,	bSucceeded(false)
+	,	PreprocessTime(0)
+	,	bPreprocessCacheHit(false)
 	{
 	}
 
@@ -505,14 +512,22 @@ struct FShaderCompilerOutput
 	uint32 NumInstructions;
 	uint32 NumTextureSamplers;
 	bool bSucceeded;
+	/** Time spent preprocessing the source, or the time saved if the preprocessed source came from the cache. */
+	float PreprocessTime;
+	/** Whether the preprocessed source came from the cache. */
+	bool bPreprocessCacheHit;
 
 	/** Generates OutputHash from the compiler output. */
 	SHADERCORE_API void GenerateOutputHash();
+
+	/** Adds the preprocessing information of this output to the shader compiling stats. */
+	SHADERCORE_API void UpdatePreprocessStats() const;
 	
 	friend FArchive& operator<<(FArchive& Ar,FShaderCompilerOutput& Output)
 	{
 		// Note: this serialize is used to pass between UE4 and the shader compile worker, recompile both when modifying
-		return Ar << Output.ParameterMap << Output.Errors << Output.Target << Output.Code << Output.NumInstructions << Output.NumTextureSamplers << Output.bSucceeded;
+		return Ar << Output.ParameterMap << Output.Errors << Output.Target << Output.Code << Output.NumInstructions << Output.NumTextureSamplers << Output.bSucceeded
+			<< Output.PreprocessTime << Output.bPreprocessCacheHit;
 	}
 };
 